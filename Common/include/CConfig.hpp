@@ -398,6 +398,8 @@ private:
   unsigned long Unst_nIntIter;      /*!< \brief Number of internal iterations (Dual time Method). */
   long Unst_RestartIter;            /*!< \brief Iteration number to restart an unsteady simulation (Dual time Method). */
   long Unst_AdjointIter;            /*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
+  unsigned long Unst_AdjCheckpoints;       /*!< \brief Number of direct solutions kept in memory by the unsteady discrete adjoint. */
+  unsigned short Unst_AdjCheckpoint_Compression; /*!< \brief Deflate level of the direct solutions kept in memory. */
   long Iter_Avg_Objective;          /*!< \brief Iteration the number of time steps to be averaged, counting from the back */
   long Dyn_RestartIter;             /*!< \brief Iteration number to restart a dynamic structural analysis. */
   su2double PhysicalTime;           /*!< \brief Physical time at the current iteration in the solver for unsteady problems. */
@@ -412,6 +414,7 @@ private:
   su2double *RK_Alpha_Step;                 /*!< \brief Runge-Kutta beta coefficients. */
 
   unsigned short nQuasiNewtonSamples;  /*!< \brief Number of samples used in quasi-Newton solution methods. */
+  unsigned short nQuasiNewtonReuseSteps; /*!< \brief Number of time steps over which the IQN-ILS FSI history is kept. */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
@@ -657,7 +660,10 @@ private:
   bool Restart,                 /*!< \brief Restart solution (for direct, adjoint, and linearized problems).*/
   Wrt_Binary_Restart,           /*!< \brief Write binary SU2 native restart files.*/
   Read_Binary_Restart,          /*!< \brief Read binary SU2 native restart files.*/
+  Wrt_Restart_Single_Prec,      /*!< \brief Store the fields not needed to restart as floats in binary restart files.*/
+  Wrt_Restart_Partitioned,      /*!< \brief Write binary restart files in partition order with an index map.*/
   Restart_Flow;                 /*!< \brief Restart flow solution for adjoint and linearized problems. */
+  unsigned short Wrt_Restart_Compression; /*!< \brief Deflate level of the data of binary restart files.*/
   unsigned short nMarker_Monitoring,  /*!< \brief Number of markers to monitor. */
   nMarker_Designing,                  /*!< \brief Number of markers for the objective function. */
   nMarker_GeoEval,                    /*!< \brief Number of markers for the objective function. */
@@ -719,6 +725,8 @@ private:
   unsigned short Analytical_Surface;  /*!< \brief Information about the analytical definition of the surface for grid adaptation. */
   unsigned short Geo_Description;     /*!< \brief Description of the geometry. */
   unsigned short Mesh_FileFormat;     /*!< \brief Mesh input format. */
+  unsigned short Mesh_Out_FileFormat; /*!< \brief Mesh output format (conversion with SU2_DEF). */
+  bool Mesh_Mapped_Read;              /*!< \brief Read SU2 ASCII meshes by memory mapping the file. */
   unsigned short Tab_FileFormat;      /*!< \brief Format of the output files. */
   unsigned short ActDisk_Jump;        /*!< \brief Format of the output files. */
   unsigned long StartWindowIteration; /*!< \brief Starting Iteration for long time Windowing apporach . */
@@ -983,6 +991,7 @@ private:
   bool RadialBasisFunction_PolynomialOption; /*!< \brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter (radius). */
   su2double RadialBasisFunction_PruneTol;    /*!< \brief Tolerance to prune the RBF interpolation matrix. */
+  unsigned long RadialBasisFunction_Neighbors; /*!< \brief Number of donors of the local RBF stencils (0 for global). */
   bool Prestretch;                           /*!< \brief Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
@@ -1092,6 +1101,10 @@ private:
   bool Jacobian_Spatial_Discretization_Only; /*!< \brief Flag to know if only the exact Jacobian of the spatial discretization must be computed. */
   bool Compute_Average;                      /*!< \brief Whether or not to compute averages for unsteady simulations in FV or DG solver. */
   unsigned short Comm_Level;                 /*!< \brief Level of MPI communications to be performed. */
+  unsigned short Kind_Partitioner;           /*!< \brief Type of partitioner used to distribute the grid. */
+  bool NodeAware_Comms;                      /*!< \brief Exchange halos through shared memory within a node, and between node leaders. */
+  unsigned long LoadBalance_Freq;            /*!< \brief Frequency (time iterations) of the load imbalance checks. */
+  su2double LoadImbalance_Tol;               /*!< \brief Imbalance (max/avg-1 of the rank compute times) that triggers repartitioning. */
   unsigned short Kind_Verification_Solution; /*!< \brief Verification solution for accuracy assessment. */
 
   ofstream *ConvHistFile;        /*!< \brief Store the pointer to each history file */
@@ -1109,6 +1122,9 @@ private:
   unsigned long VolumeWrtFreq;        /*!< \brief Writing frequency for solution files. */
   unsigned short* VolumeOutputFiles;  /*!< \brief File formats to output */
   unsigned short nVolumeOutputFiles;  /*!< \brief Number of File formats to output */
+  bool Output_Async;                  /*!< \brief Write the solution files on a background thread. */
+  unsigned short Output_CGNS_Compression; /*!< \brief Deflate level of the CGNS solution files. */
+  bool Output_Time_Series;            /*!< \brief Append the CGNS solution of each time step to a single file. */
 
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
   bool SinglezoneDriver;          /*!< \brief Determines if the single-zone driver is used. (TEMPORARY) */
@@ -2948,6 +2964,18 @@ public:
    */
   long GetUnst_AdjointIter(void) const { return Unst_AdjointIter; }
 
+  /*!
+   * \brief Get the number of direct solutions the unsteady discrete adjoint keeps in memory.
+   * \return Number of snapshots, 0 if the direct solutions are read from the restart files at every time step.
+   */
+  unsigned long GetUnst_AdjCheckpoints(void) const { return Unst_AdjCheckpoints; }
+
+  /*!
+   * \brief Get the deflate level of the direct solutions kept in memory by the unsteady discrete adjoint.
+   * \return Level between 1 and 9, 0 if the snapshots are not compressed.
+   */
+  unsigned short GetUnst_AdjCheckpoint_Compression(void) const { return Unst_AdjCheckpoint_Compression; }
+
   /*!
    * \brief Number of iterations to average (reverse time integration).
    * \return Starting direct iteration number for the unsteady adjoint.
@@ -4026,6 +4054,12 @@ public:
    */
   unsigned short GetnQuasiNewtonSamples(void) const { return nQuasiNewtonSamples; }
 
+  /*!
+   * \brief Get the number of time steps over which the IQN-ILS FSI relaxation keeps its history.
+   * \return 0 if the history is discarded at the start of every time step.
+   */
+  unsigned short GetnQuasiNewtonReuseSteps(void) const { return nQuasiNewtonReuseSteps; }
+
   /*!
    * \brief Get the relaxation coefficient of the linear solver for the implicit formulation.
    * \return relaxation coefficient of the linear solver for the implicit formulation.
@@ -5250,6 +5284,24 @@ public:
    */
   bool GetRead_Binary_Restart(void) const { return Read_Binary_Restart; }
 
+  /*!
+   * \brief Flag for whether the fields that are not read on restart are stored in single precision.
+   * \return <code>TRUE</code> if only coordinates, solution, velocities and sensitivities are stored as doubles.
+   */
+  bool GetWrt_Restart_Single_Prec(void) const { return Wrt_Restart_Single_Prec; }
+
+  /*!
+   * \brief Get the deflate level of the data of binary restart files.
+   * \return Level between 1 and 9, 0 if the data is not compressed.
+   */
+  unsigned short GetWrt_Restart_Compression(void) const { return Wrt_Restart_Compression; }
+
+  /*!
+   * \brief Flag for whether binary restart files are written in partition order followed by an index map.
+   * \return <code>TRUE</code> if the volume data does not need to be sorted to write the restart file.
+   */
+  bool GetWrt_Restart_Partitioned(void) const { return Wrt_Restart_Partitioned; }
+
   /*!
    * \brief Provides the number of varaibles.
    * \return Number of variables.
@@ -5338,6 +5390,18 @@ public:
    */
   unsigned short GetMesh_FileFormat(void) const { return Mesh_FileFormat; }
 
+  /*!
+   * \brief Get the format of the output grid.
+   * \return Format of the output grid, SU2_BINARY makes SU2_DEF convert the input grid.
+   */
+  unsigned short GetMesh_Out_FileFormat(void) const { return Mesh_Out_FileFormat; }
+
+  /*!
+   * \brief Get whether SU2 ASCII meshes are read by memory mapping the file.
+   * \return <code>TRUE</code> to parse the mapped file in parallel, <code>FALSE</code> to read it line by line.
+   */
+  bool GetMesh_Mapped_Read(void) const { return Mesh_Mapped_Read; }
+
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
@@ -8805,6 +8869,11 @@ public:
    */
   su2double GetRadialBasisFunctionPruneTol(void) const { return RadialBasisFunction_PruneTol; }
 
+  /*!
+   * \brief Get the number of donors of the local RBF stencil of each target point (0 for a global RBF system).
+   */
+  unsigned long GetRadialBasisFunctionNeighbors(void) const { return RadialBasisFunction_Neighbors; }
+
   /*!
    * \brief Get the number of donor points to use in Nearest Neighbor interpolation.
    */
@@ -9083,6 +9152,30 @@ public:
    */
   unsigned short GetComm_Level(void) const { return Comm_Level; }
 
+  /*!
+   * \brief Get the type of partitioner used to distribute the grid.
+   * \return Type of partitioner (ParMETIS or space-filling curve).
+   */
+  unsigned short GetKind_Partitioner(void) const { return Kind_Partitioner; }
+
+  /*!
+   * \brief Get whether the halo exchange is node-aware (shared memory within the node, aggregated messages between nodes).
+   * \return <code>TRUE</code> if node-aware comms are requested.
+   */
+  bool GetNodeAware_Comms(void) const { return NodeAware_Comms; }
+
+  /*!
+   * \brief Get the frequency of the dynamic load balancing checks.
+   * \return Number of time iterations between checks, 0 if load balancing is disabled.
+   */
+  unsigned long GetLoadBalance_Freq(void) const { return LoadBalance_Freq; }
+
+  /*!
+   * \brief Get the load imbalance tolerance.
+   * \return Maximum over average rank compute time, minus one, above which the grid is repartitioned.
+   */
+  su2double GetLoadImbalance_Tol(void) const { return LoadImbalance_Tol; }
+
   /*!
    * \brief Check if the mesh read supports multiple zones.
    * \return YES if multiple zones can be contained in the mesh file.
@@ -9324,6 +9417,24 @@ public:
    */
   unsigned short GetnVolumeOutputFiles() const { return nVolumeOutputFiles; }
 
+  /*!
+   * \brief Check if the solution files are written asynchronously (background thread).
+   * \return <code>TRUE</code> if the solver continues while the files are written.
+   */
+  bool GetOutput_Async() const { return Output_Async; }
+
+  /*!
+   * \brief Get the deflate level of the CGNS solution files.
+   * \return 0 if the data is not compressed.
+   */
+  unsigned short GetOutput_CGNS_Compression() const { return Output_CGNS_Compression; }
+
+  /*!
+   * \brief Get whether the CGNS solutions of an unsteady run are appended to a single file.
+   * \return <code>TRUE</code> if each time step is a new solution of one time series file.
+   */
+  bool GetOutput_Time_Series() const { return Output_Time_Series; }
+
   /*!
    * \brief Get the desired factorization frequency for PaStiX
    * \return Number of calls to 'Build' that trigger re-factorization.
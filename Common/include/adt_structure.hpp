@@ -243,6 +243,26 @@ public:
                               coor, dist, pointID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines the nNodes nearest nodes in the ADT for the given coordinate.
+   * \note Ties in the distance are broken by the point ID, which makes the result independent
+   *       of the order of the points when the point IDs are global indices.
+   * \param[in]  coor    Coordinate for which the nearest nodes in the ADT must be determined.
+   * \param[in]  nNodes  Number of nodes to find, fewer are returned if the ADT is smaller.
+   * \param[out] dist2   Squared distances to the nearest nodes, sorted in increasing order.
+   * \param[out] pointID Local point IDs of the nearest nodes.
+   * \param[out] rankID  Ranks on which the nearest nodes are stored.
+   */
+  inline void DetermineNearestNodes(const su2double     *coor,
+                                    unsigned long       nNodes,
+                                    vector<su2double>     &dist2,
+                                    vector<unsigned long> &pointID,
+                                    vector<int>           &rankID) {
+    const auto iThread = omp_get_thread_num();
+    DetermineNearestNodes_impl(FrontLeaves[iThread], FrontLeavesNew[iThread],
+                               coor, nNodes, dist2, pointID, rankID);
+  }
+
   /*!
    * \brief Default constructor of the class, disabled.
    */
@@ -259,6 +279,18 @@ private:
                                  su2double       &dist,
                                  unsigned long   &pointID,
                                  int             &rankID) const;
+
+  /*!
+   * \brief Implementation of DetermineNearestNodes.
+   * \note Working variables (first two) passed explicitly for thread safety.
+   */
+  void DetermineNearestNodes_impl(vector<unsigned long>& frontLeaves,
+                                  vector<unsigned long>& frontLeavesNew,
+                                  const su2double       *coor,
+                                  unsigned long         nNodes,
+                                  vector<su2double>     &dist2,
+                                  vector<unsigned long> &pointID,
+                                  vector<int>           &rankID) const;
 };
 
 /*!
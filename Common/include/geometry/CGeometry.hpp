@@ -65,6 +65,8 @@ extern "C" {
 
 using namespace std;
 
+class CNodeHaloExchange;
+
 /*!
  * \class CGeometry
  * \brief Parent class for defining the geometry of the problem (complete geometry,
@@ -227,6 +229,8 @@ public:
   unsigned short *bufS_P2PSend{nullptr};  /*!< \brief Data structure for unsigned long point-to-point send. */
   SU2_MPI::Request *req_P2PSend{nullptr}; /*!< \brief Data structure for point-to-point send requests. */
   SU2_MPI::Request *req_P2PRecv{nullptr}; /*!< \brief Data structure for point-to-point recv requests. */
+  CNodeHaloExchange *nodeExchange{nullptr}; /*!< \brief Node-aware (shared memory) exchange of the su2double buffers, if enabled. */
+  static thread_local passivedouble haloWaitTime; /*!< \brief Time spent by this thread waiting for halo messages. */
 
   /*--- Data structures for periodic communications. ---*/
 
@@ -312,6 +316,32 @@ public:
   void PostP2PSends(CGeometry *geometry, const CConfig *config, unsigned short commType,
                     unsigned short countPerPoint, int val_iMessage, bool val_reverse) const;
 
+  /*!
+   * \brief Routine to wait for any of the point-to-point messages of a communication to arrive.
+   * \note Must be called by all threads, once per received message. With node-aware comms the first
+   *       call performs the exchange of all messages.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \return Rank from which the message was received.
+   */
+  int WaitAnyP2PRecv(unsigned short commType, unsigned short countPerPoint, bool val_reverse);
+
+  /*!
+   * \brief Routine to complete the point-to-point sends of a communication.
+   * \note Must be called by all threads.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   */
+  void WaitAllP2PSends(unsigned short commType);
+
+  /*!
+   * \brief Total time the calling thread has spent waiting for the point-to-point messages of halo
+   *        communications, used to separate computation from communication when balancing the load.
+   * \note The waits are done by the master thread of the solver, other threads (e.g. the asynchronous
+   *       output) do not contribute to its value.
+   */
+  static inline passivedouble GetHaloWaitTime() { return haloWaitTime; }
+
   /*!
    * \brief Routine to set up persistent data structures for periodic communications.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -771,6 +801,15 @@ public:
    */
   inline virtual void SetColorGrid_Parallel(CConfig *config) {}
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] globalIndex - Global indices of the points for which a color is prescribed.
+   * \param[in] color - Prescribed color of each point.
+   */
+  inline virtual void SetColorGrid_Prescribed(CConfig *config, const vector<unsigned long> &globalIndex,
+                                              const vector<unsigned long> &color) {}
+
   /*!
    * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
@@ -1077,6 +1116,19 @@ public:
    */
   inline virtual long GetGlobal_to_Local_Point(unsigned long val_ipoint) const { return 0; }
 
+  /*!
+   * \brief Get the global indices of the points owned by this rank (excluding halos).
+   * \return Global indices in increasing order.
+   */
+  virtual vector<unsigned long> GetDomainGlobalIndices() const;
+
+  /*!
+   * \brief Get the local indices of the points owned by this rank (excluding halos), in increasing order of
+   *        their global index. This is the order of the point data of the rank read from restart files.
+   * \return Local indices.
+   */
+  virtual vector<unsigned long> GetDomainPointsInGlobalOrder() const;
+
   /*!
    * \brief A virtual member.
    * \param[in] val_ipoint - Global marker.
@@ -304,6 +304,19 @@ public:
     return -1;
   }
 
+  /*!
+   * \brief Get the global indices of the points owned by this rank, without a search over all global points.
+   * \return Global indices in increasing order.
+   */
+  vector<unsigned long> GetDomainGlobalIndices() const override;
+
+  /*!
+   * \brief Get the local indices of the points owned by this rank sorted by global index, without a search
+   *        over all global points.
+   * \return Local indices.
+   */
+  vector<unsigned long> GetDomainPointsInGlobalOrder() const override;
+
   /*!
    * \brief Get the local marker that correspond with the global marker.
    * \param[in] val_ipoint - Global marker.
@@ -526,11 +539,21 @@ public:
   void Check_BoundElem_Orientation(const CConfig *config) override;
 
   /*!
-   * \brief Set the domains for grid grid partitioning using ParMETIS.
+   * \brief Set the domains for grid partitioning using ParMETIS or a space-filling curve.
    * \param[in] config - Definition of the particular problem.
    */
   void SetColorGrid_Parallel(CConfig *config) override;
 
+  /*!
+   * \brief Set the domains for grid partitioning from colors computed elsewhere (e.g. by the load balancer).
+   * \note Each rank may prescribe colors for any points, they are sent to the ranks that own them in the linear partition.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] globalIndex - Global indices of the points for which a color is prescribed.
+   * \param[in] color - Prescribed color of each point.
+   */
+  void SetColorGrid_Prescribed(CConfig *config, const vector<unsigned long> &globalIndex,
+                               const vector<unsigned long> &color) override;
+
   /*!
    * \brief Set the domains for FEM grid partitioning using ParMETIS.
    * \param[in] config - Definition of the particular problem.
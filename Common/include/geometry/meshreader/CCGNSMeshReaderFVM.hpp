@@ -90,7 +90,7 @@ private:
   void ReadCGNSVolumeSection(int val_section);
   
   /*!
-   * \brief Reads the surface (boundary) elements from the CGNS zone. Only the master rank currently reads and stores the connectivity, which is linearly partitioned later.
+   * \brief Reads the surface (boundary) elements from the CGNS zone. Each rank reads a linear chunk of the section, and the elements are sent to the rank owning their first node.
    * \param[in] val_section - CGNS section index.
    */
   void ReadCGNSSurfaceSection(int val_section);
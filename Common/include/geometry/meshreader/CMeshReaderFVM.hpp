@@ -60,7 +60,33 @@ protected:
   
   unsigned long numberOfMarkers;                             /*!< \brief Total number of markers contained within the mesh file. */
   vector<string> markerNames;                                /*!< \brief String names for all markers in the mesh file. */
-  vector<vector<unsigned long> > surfaceElementConnectivity; /*!< \brief Vector containing the surface element connectivity from the mesh file on a per-marker basis. Only the master node reads and stores this connectivity. */
+  vector<vector<unsigned long> > surfaceElementConnectivity; /*!< \brief Vector containing the surface element connectivity from the mesh file on a per-marker basis. Each element is stored by exactly one rank, readers that do not distribute the markers keep them all on the master node. */
+  
+  /*!
+   * \brief Get the number of nodes of an element type.
+   * \param[in] vtkType - VTK type of the element.
+   * \returns Number of nodes, 0 for types not supported by the FVM readers.
+   */
+  static inline unsigned short GetNumberOfNodes(unsigned long vtkType) {
+    switch (vtkType) {
+      case LINE:          return N_POINTS_LINE;
+      case TRIANGLE:      return N_POINTS_TRIANGLE;
+      case QUADRILATERAL: return N_POINTS_QUADRILATERAL;
+      case TETRAHEDRON:   return N_POINTS_TETRAHEDRON;
+      case HEXAHEDRON:    return N_POINTS_HEXAHEDRON;
+      case PRISM:         return N_POINTS_PRISM;
+      case PYRAMID:       return N_POINTS_PYRAMID;
+      default:            return 0;
+    }
+  }
+  
+  /*!
+   * \brief Send the volume elements read on this rank to all ranks that own (in the linear partition of
+   *        the points) one of their nodes, and store the elements received in localVolumeElementConnectivity.
+   * \note For readers that read a linear partition of the elements instead of scanning all of them.
+   * \param[in] connElems - Elements in the format [globalID vtkType n0 ... n7], SU2_CONN_SIZE entries each.
+   */
+  void DistributeVolumeElements(const vector<unsigned long>& connElems);
   
 public:
   
@@ -96,9 +122,9 @@ public:
   }
   
   /*!
-   * \brief Get the surface element connectivity for the specified marker. Only the master node owns the surface connectivity.
+   * \brief Get the surface element connectivity for the specified marker. Each element is owned by a single rank (the master node if the reader does not distribute the markers).
    * \param[in] val_iMarker - current marker index.
-   * \returns Surface element connecitivity for a marker from the master rank.
+   * \returns Surface element connecitivity for a marker owned by this rank.
    */
   inline const vector<unsigned long> &GetSurfaceElementConnectivityForMarker(int val_iMarker) const {
     return surfaceElementConnectivity[val_iMarker];
@@ -107,7 +133,7 @@ public:
   /*!
    * \brief Get the number surface elements for the specified marker.
    * \param[in] val_iMarker - current marker index.
-   * \returns Number of surface elements for a marker.
+   * \returns Number of surface elements for a marker owned by this rank.
    */
   inline unsigned long GetNumberOfSurfaceElementsForMarker(int val_iMarker) {
     return (unsigned long)surfaceElementConnectivity[val_iMarker].size()/SU2_CONN_SIZE;
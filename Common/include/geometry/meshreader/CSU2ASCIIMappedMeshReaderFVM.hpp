@@ -0,0 +1,99 @@
+/*!
+ * \file CSU2ASCIIMappedMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2ASCIIMappedMeshReaderFVM.
+ *        The implementations are in the <i>CSU2ASCIIMappedMeshReaderFVM.cpp</i> file.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CMeshReaderFVM.hpp"
+
+/*!
+ * \class CSU2ASCIIMappedMeshReaderFVM
+ * \brief Reads a native SU2 ASCII grid into linear partitions for the finite volume solver (FVM),
+ *        by memory mapping the file.
+ * \note The master scans the file once to find the sections of the zone and the byte offsets at which
+ *       the linear partitions of the points and elements start. Each rank then parses only its byte
+ *       ranges (split among threads) without going through streams, the elements are sent to the
+ *       ranks that own their points afterwards. Actuator disks defined by a single surface are not
+ *       split by this reader, those meshes are read by CSU2ASCIIMeshReaderFVM (see CanRead).
+ */
+class CSU2ASCIIMappedMeshReaderFVM: public CMeshReaderFVM {
+
+private:
+
+  class CMappedFile;  /*!< \brief Read-only mapping of the file, defined in the implementation. */
+
+  unsigned short myZone; /*!< \brief Current SU2 zone index. */
+  unsigned short nZones; /*!< \brief Total number of zones in the SU2 file. */
+
+  string meshFilename; /*!< \brief Name of the SU2 ASCII mesh file being read. */
+
+  vector<unsigned long> pointOffset; /*!< \brief Byte offsets of the first point of each rank's linear partition (size+1). */
+  vector<unsigned long> elemOffset;  /*!< \brief Byte offsets of the first element of each rank's linear partition (size+1). */
+  unsigned long markerOffset = 0;    /*!< \brief Byte offset of the first line after NMARK=. */
+
+  /*!
+   * \brief Scans the file (master) for the metadata and section offsets of the zone, and broadcasts them.
+   */
+  void ReadMetadata(const CMappedFile& file);
+
+  /*!
+   * \brief Parses the grid points of the linear partition of this rank.
+   */
+  void ReadPointCoordinates(const CMappedFile& file);
+
+  /*!
+   * \brief Parses the volume elements of the linear partition of this rank and sends them to the
+   *        ranks that own their points.
+   */
+  void ReadVolumeElementConnectivity(const CMappedFile& file);
+
+  /*!
+   * \brief Parses the surface (boundary) elements, only on the master node.
+   */
+  void ReadSurfaceElementConnectivity(const CMappedFile& file);
+
+public:
+
+  /*!
+   * \brief Constructor of the CSU2ASCIIMappedMeshReaderFVM class.
+   */
+  CSU2ASCIIMappedMeshReaderFVM(CConfig        *val_config,
+                               unsigned short val_iZone,
+                               unsigned short val_nZone);
+
+  /*!
+   * \brief Destructor of the CSU2ASCIIMappedMeshReaderFVM class.
+   */
+  ~CSU2ASCIIMappedMeshReaderFVM(void);
+
+  /*!
+   * \brief Whether this reader can be used for the mesh of a zone.
+   * \param[in] val_config - Config of the zone.
+   * \returns False if mapped reads are disabled or a single surface actuator disk must be split.
+   */
+  static bool CanRead(const CConfig *val_config);
+
+};
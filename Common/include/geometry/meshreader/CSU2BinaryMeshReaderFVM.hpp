@@ -0,0 +1,169 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2BinaryMeshReaderFVM.
+ *        The implementations are in the <i>CSU2BinaryMeshReaderFVM.cpp</i> file.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "CMeshReaderFVM.hpp"
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM
+ * \brief Reads a native SU2 binary grid into linear partitions for the finite volume solver (FVM).
+ * \note The file contains a single zone and has a fixed layout (native byte order):
+ *       - Header of N_HEADER_INT int64 followed by N_HEADER_DOUBLE doubles (see HeaderEntry).
+ *       - NPOIN x NDIME doubles with the point coordinates.
+ *       - NELEM volume records of VOL_RECORD int64, [vtkType n0 ... n7] (unused nodes are 0).
+ *       - For each of the NMARK markers, MARKER_NAME_SIZE chars with the tag, one int64 with
+ *         the number of elements, and the surface records of SURF_RECORD int64, [vtkType n0 ... n3].
+ *       Since the offsets of the points and elements of any linear partition are known from the
+ *       header, each rank reads only its slice, with collective MPI-IO calls.
+ */
+class CSU2BinaryMeshReaderFVM: public CMeshReaderFVM {
+
+public:
+
+  /*!
+   * \brief Integer entries of the header.
+   */
+  enum HeaderEntry : int {
+    MAGIC_NUMBER = 0,  /*!< \brief File identifier, SU2_BINARY_MESH_ID. */
+    VERSION      = 1,  /*!< \brief Version of the layout. */
+    NDIME        = 2,  /*!< \brief Dimension of the problem. */
+    NPOIN        = 3,  /*!< \brief Number of points. */
+    NELEM        = 4,  /*!< \brief Number of volume elements. */
+    NMARK        = 5,  /*!< \brief Number of markers. */
+    N_HEADER_INT = 8   /*!< \brief Number of integer entries (including reserved ones). */
+  };
+
+  /*!
+   * \brief Floating point entries of the header.
+   */
+  enum HeaderEntryDouble : int {
+    AOA_OFFSET      = 0,  /*!< \brief Angle of attack offset (deg). */
+    AOS_OFFSET      = 1,  /*!< \brief Angle of sideslip offset (deg). */
+    N_HEADER_DOUBLE = 8   /*!< \brief Number of floating point entries (including reserved ones). */
+  };
+
+  /*--- Distinct from the magic number of the binary restart files (535532), a restart
+   *  given as mesh (or the other way around) is rejected by its header. ---*/
+  enum : int64_t {SU2_BINARY_MESH_ID = 535533, SU2_BINARY_MESH_VERSION = 1};
+
+  enum : int {
+    VOL_RECORD       = 1 + N_POINTS_HEXAHEDRON,     /*!< \brief Size (int64) of the record of a volume element. */
+    SURF_RECORD      = 1 + N_POINTS_QUADRILATERAL,  /*!< \brief Size (int64) of the record of a surface element. */
+    MARKER_NAME_SIZE = 64                           /*!< \brief Size (chars) of the marker tags. */
+  };
+
+  /*!
+   * \brief Constructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  CSU2BinaryMeshReaderFVM(CConfig        *val_config,
+                          unsigned short val_iZone,
+                          unsigned short val_nZone);
+
+  /*!
+   * \brief Destructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  ~CSU2BinaryMeshReaderFVM(void);
+
+  /*!
+   * \brief Read the header of an SU2 binary mesh (serial, for the queries done before the mesh is read).
+   * \param[in] val_filename - Name of the file.
+   * \param[out] header - Integer entries of the header (N_HEADER_INT).
+   * \param[out] headerDouble - Floating point entries of the header (N_HEADER_DOUBLE), may be nullptr.
+   */
+  static void ReadHeader(const string& val_filename, int64_t* header, passivedouble* headerDouble = nullptr);
+
+  /*!
+   * \brief Write the mesh held by a (linearly partitioned) mesh reader to an SU2 binary mesh.
+   * \note Collective over all ranks, the points and elements are written with collective MPI-IO calls.
+   * \param[in] val_config - Config of the zone, provides the AoA and AoS offsets.
+   * \param[in] mesh - Reader holding the mesh.
+   * \param[in] val_filename - Name of the file.
+   */
+  static void WriteMesh(const CConfig* val_config, const CMeshReaderFVM& mesh, const string& val_filename);
+
+  /*!
+   * \brief Convert the mesh of a zone (MESH_FILENAME, SU2 or CGNS format) to an SU2 binary mesh.
+   * \param[in] val_config - Config of the zone.
+   * \param[in] val_iZone - Current zone index.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] val_filename - Name of the output file.
+   */
+  static void ConvertMesh(CConfig* val_config, unsigned short val_iZone,
+                          unsigned short val_nZone, const string& val_filename);
+
+private:
+
+  class CFile;  /*!< \brief Thin wrapper for the (MPI) file handle, defined in the implementation. */
+
+  string meshFilename; /*!< \brief Name of the SU2 binary mesh file being read. */
+
+  /*!
+   * \brief Reads the header of the file and checks for errors.
+   */
+  void ReadMetadata(CFile& file);
+
+  /*!
+   * \brief Reads the grid points of the linear partition of this rank.
+   */
+  void ReadPointCoordinates(CFile& file);
+
+  /*!
+   * \brief Reads the volume elements of the linear partition of this rank and redistributes
+   *        them to the ranks that own their points.
+   */
+  void ReadVolumeElementConnectivity(CFile& file);
+
+  /*!
+   * \brief Reads the surface (boundary) elements, only on the master node.
+   */
+  void ReadSurfaceElementConnectivity(CFile& file);
+
+  /*!
+   * \brief Offset (bytes) of the point coordinates.
+   */
+  static inline uint64_t PointOffset() {
+    return N_HEADER_INT*sizeof(int64_t) + N_HEADER_DOUBLE*sizeof(passivedouble);
+  }
+
+  /*!
+   * \brief Offset (bytes) of the volume elements.
+   */
+  static inline uint64_t ElemOffset(uint64_t nDim, uint64_t nPoint) {
+    return PointOffset() + nDim*nPoint*sizeof(passivedouble);
+  }
+
+  /*!
+   * \brief Offset (bytes) of the markers.
+   */
+  static inline uint64_t MarkerOffset(uint64_t nDim, uint64_t nPoint, uint64_t nElem) {
+    return ElemOffset(nDim, nPoint) + nElem*VOL_RECORD*sizeof(int64_t);
+  }
+
+};
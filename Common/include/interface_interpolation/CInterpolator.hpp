@@ -77,6 +77,8 @@ protected:
   CGeometry* const donor_geometry;   /*! \brief Donor geometry. */
   CGeometry* const target_geometry;  /*! \brief Target geometry. */
 
+  bool coeffChanged = true;          /*!< \brief Whether the last SetTransferCoeff changed the donor information. */
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -104,6 +106,12 @@ public:
    */
   virtual void SetTransferCoeff(const CConfig* const* config) = 0;
 
+  /*!
+   * \brief Whether the last call of SetTransferCoeff changed the donor information, i.e. whether
+   *        the communication patterns built from it must be discarded (see CInterface::ResetTransferPattern).
+   */
+  inline bool GetCoeffChanged(void) const { return coeffChanged; }
+
   /*!
    * \brief Print information about the interpolation.
    */
@@ -149,6 +157,26 @@ protected:
    */
   void Collect_VertexInfo(int markDonor, int markTarget, unsigned long nVertexDonor, unsigned short nDim);
 
+  /*!
+   * \brief Collect the donor vertices (coord, global point, rank) that can be donors of the targets of this
+   *        rank, without gathering the entire donor boundary on every rank.
+   * \note The bounding boxes of the targets and donors of all ranks are exchanged, each rank then receives
+   *       the donor vertices inside its target box grown by a halo. The halo is large enough for each
+   *       target to have at least nNeighbor donors within it (those are then the closest donors).
+   *       Only vertices are exchanged, methods that need the donor connectivity (global RBF system,
+   *       isoparametric, sliding mesh) still gather the entire boundary.
+   * \param[in] markDonor - Index of the boundary on the donor domain.
+   * \param[in] markTarget - Index of the boundary on the target domain.
+   * \param[in] nDim - number of physical dimensions.
+   * \param[in] nNeighbor - Number of closest donors that must be collected for each target.
+   * \param[out] coord - Coordinates of the collected donor vertices.
+   * \param[out] globalPoint - Global index of the collected donor vertices (in increasing order).
+   * \param[out] proc - Rank that owns each collected donor vertex.
+   */
+  void Collect_OverlappingVertexInfo(int markDonor, int markTarget, unsigned short nDim,
+                                     unsigned long nNeighbor, vector<su2double>& coord,
+                                     vector<long>& globalPoint, vector<int>& proc) const;
+
   /*!
    * \brief Collect all donor elements in an interface pair.
    * \param[in] markDonor - Index of the boundary on the donor domain.
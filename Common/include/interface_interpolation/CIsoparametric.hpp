@@ -37,6 +37,24 @@ private:
   su2double MaxDistance = 0.0, ErrorRate = 0.0;
   unsigned long ErrorCounter = 0;
 
+  /*!
+   * \brief Data to detect that an interface only moved rigidly since its coefficients were computed.
+   * \note The distances of the interface vertices to a few donor points, that span the donor interface,
+   *       only remain unchanged if the relative position of donors and targets is the same.
+   */
+  struct CRigidMotionCache {
+    bool valid = false;                 /*!< \brief Whether the reference data is set. */
+    vector<long> refPoint;              /*!< \brief Global index of the reference donor points. */
+    vector<int> refRank;                /*!< \brief Rank that owns each reference point. */
+    vector<unsigned long> refVertex;    /*!< \brief Donor vertex of each reference point (on its owner). */
+    passivedouble tolerance = 0.0;      /*!< \brief Admissible change of the distances. */
+    vector<passivedouble> donorDist;    /*!< \brief Distances of the donor vertices to the reference points. */
+    vector<passivedouble> targetDist;   /*!< \brief Distances of the target vertices to the reference points. */
+    su2double maxDist = 0.0;            /*!< \brief Local statistics of the interface. */
+    unsigned long errorCount = 0, nTarget = 0;
+  };
+  vector<CRigidMotionCache> rigidCache; /*!< \brief Reference data of each interface marker. */
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -60,6 +78,43 @@ public:
   void PrintStatistics(void) const override;
 
 private:
+  /*!
+   * \brief Choose the reference points of an interface and store the distances to them.
+   * \param[out] cache - Reference data of the interface.
+   * \param[in] markDonor - Index of the donor marker (-1 if not on this rank).
+   * \param[in] markTarget - Index of the target marker (-1 if not on this rank).
+   * \param[in] nDim - Number of dimensions.
+   * \param[in] donorCoord - Gathered coordinates of the donor vertices.
+   * \param[in] donorPoint - Their global indices.
+   * \param[in] donorProc - Their ranks.
+   */
+  void SetRigidMotionCache(CRigidMotionCache& cache, int markDonor, int markTarget, unsigned short nDim,
+                           const su2activematrix& donorCoord, const vector<long>& donorPoint,
+                           const vector<int>& donorProc) const;
+
+  /*!
+   * \brief Check (collectively) whether the coefficients of an interface are still valid.
+   * \param[in] cache - Reference data of the interface.
+   * \param[in] markDonor - Index of the donor marker (-1 if not on this rank).
+   * \param[in] markTarget - Index of the target marker (-1 if not on this rank).
+   * \param[in] nDim - Number of dimensions.
+   * \return True if the donors and targets only moved rigidly.
+   */
+  bool CheckRigidMotionCache(const CRigidMotionCache& cache, int markDonor, int markTarget,
+                             unsigned short nDim) const;
+
+  /*!
+   * \brief Distances of the donor and target vertices of this rank to the reference points.
+   * \param[in] markDonor - Index of the donor marker (-1 if not on this rank).
+   * \param[in] markTarget - Index of the target marker (-1 if not on this rank).
+   * \param[in] nDim - Number of dimensions.
+   * \param[in] refCoord - Coordinates of the reference points.
+   * \param[out] donorDist - Distances of the donor vertices.
+   * \param[out] targetDist - Distances of the target vertices.
+   */
+  void GetReferenceDistances(int markDonor, int markTarget, unsigned short nDim, const su2activematrix& refCoord,
+                             vector<passivedouble>& donorDist, vector<passivedouble>& targetDist) const;
+
   /*!
    * \brief Compute the isoparametric interpolation coefficients for a 2D line element.
    * \param[in] X - Coordinate matrix defining the line.
@@ -30,9 +30,9 @@
 
 /*!
  * \brief Nearest Neighbor(s) interpolation.
- * \note The closest k neighbors are used for IDW interpolation, the computational
- * cost of setting up the interpolation is O(N^2 log(k)), this can be improved
- * by using a kd-tree.
+ * \note The closest k neighbors are used for IDW interpolation, they are found with
+ * an alternating digital tree of the donor vertices, i.e. in O(N log(N)) on average.
+ * Each rank only receives the donor vertices that can be among the closest to its targets.
  */
 class CNearestNeighbor final : public CInterpolator {
 private:
@@ -88,6 +88,22 @@ public:
                                      const su2activematrix& coords, int& nPolynomial,
                                      vector<int>& keepPolynomialRow, su2passivematrix& C_inv_trunc);
 
+  /*!
+   * \brief Compute the interpolation coefficients of a target point from the RBF system of a local stencil of donors.
+   * \note This is a local-stencil approximation of the global RBF interpolation, not a partition of unity, the
+   * stencils are not blended and the interpolant is discontinuous where the stencil changes between targets.
+   * The coefficients sum to one and, with the polynomial term, linear fields are reproduced exactly.
+   * \param[in] type - Type of radial basis function.
+   * \param[in] usePolynomial - Whether to use polynomial terms (the stencil needs at least nDim+1 points).
+   * \param[in] radius - Normalizes point-to-point distance when computing RBF values.
+   * \param[in] coords - Coordinates of the donor points of the stencil.
+   * \param[in] target - Coordinates of the target point.
+   * \param[out] coeffs - Coefficient of each donor point.
+   */
+  static void ComputeStencilCoefficients(ENUM_RADIALBASIS type, bool usePolynomial, su2double radius,
+                                         const su2activematrix& coords, const su2double* target,
+                                         vector<passivedouble>& coeffs);
+
   /*!
    * \brief If the polynomial term is included in the interpolation, and the points lie on a plane, the matrix
    * becomes rank deficient and cannot be inverted. This method detects that condition and corrects it by
@@ -100,6 +116,22 @@ public:
   static int CheckPolynomialTerms(su2double max_diff_tol, vector<int>& keep_row, su2passivematrix &P);
 
 private:
+  /*!
+   * \brief Set up the transfer matrix with a local RBF system for each target point, made of its closest
+   *        donor points. The cost is linear in the number of targets, instead of cubic in the number of donors.
+   * \note Local-stencil approximation of the global system, see ComputeStencilCoefficients.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetLocalStencilTransferCoeff(const CConfig* const* config);
+
+  /*!
+   * \brief Reduce the interpolation statistics over all ranks and check that every target has donors.
+   * \param[in] totalTargetPoints - Number of target points of the rank.
+   * \param[in] totalDonorPoints - Number of (non-zero) donor coefficients of the rank.
+   * \param[in] denseSize - Number of coefficients of the rank if the interpolation matrix was dense.
+   */
+  void ReduceStatistics(unsigned long totalTargetPoints, unsigned long totalDonorPoints, unsigned long denseSize);
+
   /*!
    * \brief Helper function, prunes (by setting to zero) small interpolation coefficients,
    * i.e. <= tolerance*max(abs(coeffs)). The vector is re-scaled such that sum(coeffs)==1.
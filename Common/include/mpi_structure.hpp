@@ -95,9 +95,16 @@ protected:
   static Comm currentComm;
   static bool winMinRankErrorInUse;
   static Win  winMinRankError;
+  static thread_local passivedouble collectiveWaitTime; /*!< \brief Time this thread spent in Allreduce. */
 
 public:
 
+  /*!
+   * \brief Time the calling thread spent in Allreduce (waiting for the other ranks), used to
+   *        measure the compute time of a rank for load balancing (see CGeometry::GetHaloWaitTime).
+   */
+  static passivedouble GetCollectiveWaitTime();
+
   static int GetRank();
 
   static int GetSize();
@@ -344,6 +351,7 @@ private:
   static Comm currentComm;
 
 public:
+  static passivedouble GetCollectiveWaitTime() { return 0.0; }
   static int GetRank();
 
   static int GetSize();
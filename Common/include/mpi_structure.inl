@@ -228,7 +228,9 @@ inline void CBaseMPIWrapper::Reduce(void *sendbuf, void *recvbuf, int count,
 
 inline void CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
                                    Datatype datatype, Op op, Comm comm) {
+  const passivedouble start = MPI_Wtime();
   MPI_Allreduce(sendbuf,recvbuf,count,datatype,op,comm);
+  collectiveWaitTime += MPI_Wtime() - start;
 }
 
 inline void CBaseMPIWrapper::Gather(void *sendbuf, int sendcnt,Datatype sendtype,
@@ -282,6 +284,8 @@ inline passivedouble CBaseMPIWrapper::Wtime(void) {
   return MPI_Wtime();
 }
 
+inline passivedouble CBaseMPIWrapper::GetCollectiveWaitTime() { return collectiveWaitTime; }
+
 #if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
 
 inline void CMediMPIWrapper::Init(int *argc, char ***argv) {
@@ -459,7 +463,9 @@ inline void CMediMPIWrapper::Reduce(void *sendbuf, void *recvbuf, int count,
 
 inline void CMediMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
                                    Datatype datatype, Op op, Comm comm) {
+  const passivedouble start = MPI_Wtime();
   AMPI_Allreduce(sendbuf,recvbuf,count,convertDatatype(datatype),convertOp(op),convertComm(comm));
+  collectiveWaitTime += MPI_Wtime() - start;
 }
 
 inline void CMediMPIWrapper::Gather(void *sendbuf, int sendcnt,Datatype sendtype,
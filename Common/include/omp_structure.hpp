@@ -80,6 +80,11 @@ inline void omp_set_num_threads(int) { }
  */
 inline constexpr int omp_get_thread_num(void) {return 0;}
 
+/*!
+ * \brief Whether the caller is inside an active parallel region.
+ */
+inline constexpr int omp_in_parallel(void) {return 0;}
+
 /*!
  * \brief Dummy lock type and associated functions.
  */
@@ -182,6 +187,62 @@ void parallelSet(size_t size, T val, U* dst)
   for(size_t i=0; i<size; ++i) dst[i] = val;
 }
 
+/*!
+ * \brief Minimum number of entries for which arrays are first-touched in parallel.
+ */
+enum : size_t {OMP_FIRST_TOUCH_MIN = 8192};
+
+/*!
+ * \brief Set the entries of a newly allocated (row-major) array in parallel, such that with
+ *        a "first touch" page placement policy the rows are close (NUMA-wise) to the threads
+ *        that will work on them.
+ * \note To be effective chunkSize must match the static schedule of the loops that access the array.
+ *       Opens a parallel region when called from serial code, in parallel regions the calling
+ *       thread sets the entire array (the caller is assumed to be the only one doing it).
+ * \param[in] rows - Number of rows (e.g. points), the unit of work of the loops.
+ * \param[in] rowSize - Number of entries per row.
+ * \param[in] chunkSize - Chunk size, in rows, of the static schedule.
+ * \param[in] val - Value to set.
+ * \param[in] dst - Destination array.
+ */
+template<class T, class U>
+void parallelFirstTouchSet(size_t rows, size_t rowSize, size_t chunkSize, T val, U* dst)
+{
+  if(rows*rowSize < OMP_FIRST_TOUCH_MIN || omp_in_parallel()) {
+    for(size_t i=0; i<rows*rowSize; ++i) dst[i] = val;
+    return;
+  }
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(chunkSize)
+    for(size_t i=0; i<rows; ++i)
+      for(size_t j=0; j<rowSize; ++j) dst[i*rowSize+j] = val;
+  }
+}
+
+/*!
+ * \brief Copy data to a newly allocated (row-major) array in parallel, see parallelFirstTouchSet.
+ * \param[in] rows - Number of rows (e.g. points), the unit of work of the loops.
+ * \param[in] rowSize - Number of entries per row.
+ * \param[in] chunkSize - Chunk size, in rows, of the static schedule.
+ * \param[in] src - Source array.
+ * \param[in] dst - Destination array.
+ */
+template<class T, class U>
+void parallelFirstTouchCopy(size_t rows, size_t rowSize, size_t chunkSize, const T* src, U* dst)
+{
+  if(rows*rowSize < OMP_FIRST_TOUCH_MIN || omp_in_parallel()) {
+    for(size_t i=0; i<rows*rowSize; ++i) dst[i] = src[i];
+    return;
+  }
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(chunkSize)
+    for(size_t i=0; i<rows; ++i)
+      for(size_t j=0; j<rowSize; ++j) dst[i*rowSize+j] = src[i*rowSize+j];
+  }
+}
+
 /*!
  * \brief Atomically update a (shared) lhs value with a (local) rhs value.
  * \note For types without atomic support (non-arithmetic) this is done via critical.
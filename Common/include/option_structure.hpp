@@ -1117,12 +1117,14 @@ static const MapType<string, ENUM_2DFORM> ElasForm_2D = {
 enum ENUM_AITKEN {
   NO_RELAXATION = 0,        /*!< \brief No relaxation in the strongly coupled approach. */
   FIXED_PARAMETER = 1,      /*!< \brief Relaxation with a fixed parameter. */
-  AITKEN_DYNAMIC = 2        /*!< \brief Relaxation using Aitken's dynamic parameter. */
+  AITKEN_DYNAMIC = 2,       /*!< \brief Relaxation using Aitken's dynamic parameter. */
+  IQN_ILS = 3               /*!< \brief Interface quasi-Newton with inverse Jacobian from a least-squares model. */
 };
 static const MapType<string, ENUM_AITKEN> AitkenForm_Map = {
   MakePair("NONE", NO_RELAXATION)
   MakePair("FIXED_PARAMETER", FIXED_PARAMETER)
   MakePair("AITKEN_DYNAMIC", AITKEN_DYNAMIC)
+  MakePair("IQN_ILS", IQN_ILS)
 };
 
 /*!
@@ -1591,13 +1593,23 @@ enum ENUM_INPUT {
   SU2       = 1,  /*!< \brief SU2 input format. */
   CGNS_GRID = 2,  /*!< \brief CGNS input format for the computational grid. */
   RECTANGLE = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
-  BOX       = 4   /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  BOX       = 4,  /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2_BINARY = 5  /*!< \brief Native SU2 binary format, read in parallel. */
 };
 static const MapType<string, ENUM_INPUT> Input_Map = {
   MakePair("SU2", SU2)
   MakePair("CGNS", CGNS_GRID)
   MakePair("RECTANGLE", RECTANGLE)
   MakePair("BOX", BOX)
+  MakePair("SU2_BINARY", SU2_BINARY)
+};
+
+/*!
+ * \brief Mesh file formats that can be written (SU2_DEF).
+ */
+static const MapType<string, ENUM_INPUT> MeshOutput_Map = {
+  MakePair("SU2", SU2)
+  MakePair("SU2_BINARY", SU2_BINARY)
 };
 
 /*!
@@ -1622,7 +1634,8 @@ enum ENUM_OUTPUT {
   STL_BINARY              = 16, /*!< \brief STL binary format for surface solution output. Not implemented yet. */
   PARAVIEW_XML            = 17, /*!< \brief Paraview XML with binary data format */
   SURFACE_PARAVIEW_XML    = 18, /*!< \brief Surface Paraview XML with binary data format */
-  PARAVIEW_MULTIBLOCK     = 19  /*!< \brief Paraview XML Multiblock */
+  PARAVIEW_MULTIBLOCK     = 19, /*!< \brief Paraview XML Multiblock */
+  SURFACE_CGNS            = 20  /*!< \brief CGNS format for the surface solution output. */
 };
 static const MapType<string, ENUM_OUTPUT> Output_Map = {
   MakePair("TECPLOT_ASCII", TECPLOT)
@@ -1641,6 +1654,7 @@ static const MapType<string, ENUM_OUTPUT> Output_Map = {
   MakePair("RESTART_ASCII", RESTART_ASCII)
   MakePair("RESTART", RESTART_BINARY)
   MakePair("CGNS", CGNS)
+  MakePair("SURFACE_CGNS", SURFACE_CGNS)
   MakePair("STL", STL)
   MakePair("STL_BINARY", STL_BINARY)
 };
@@ -2130,6 +2144,18 @@ static const MapType<string, COMM_LEVEL> Comm_Map = {
   MakePair("FULL",    COMM_FULL)
 };
 
+/*!
+ * \brief Types of grid partitioners.
+ */
+enum ENUM_PARTITIONER {
+  PARMETIS_PARTITIONER = 0,   /*!< \brief Graph partitioning with ParMETIS (the SFC is used if ParMETIS is not available). */
+  SFC_PARTITIONER      = 1    /*!< \brief Geometric partitioning along a Hilbert space-filling curve. */
+};
+static const MapType<string, ENUM_PARTITIONER> Partitioner_Map = {
+  MakePair("PARMETIS",            PARMETIS_PARTITIONER)
+  MakePair("SPACE_FILLING_CURVE", SFC_PARTITIONER)
+};
+
 /*
  * \brief Types of filter kernels, initially intended for structural topology optimization applications
  */
@@ -29,6 +29,7 @@
 
 #include "allocation_toolbox.hpp"
 #include "../basic_types/datatype_structure.hpp"
+#include "../omp_structure.hpp"
 
 #include <utility>
 #include <type_traits>
@@ -411,6 +412,35 @@ private:
     return reqSize;
   }
 
+  /*!
+   * \brief Chunk size (rows) used to set large containers in parallel, it matches the
+   *        light point loops of the solvers, to which the rows of most containers map.
+   */
+  enum : size_t {OMP_MAX_ROWS = 512};
+
+  /*!
+   * \brief Units of work when setting the container in parallel, row-major matrices
+   *        are distributed by rows, vectors and column-major matrices by entries.
+   */
+  size_t m_parallelRows() const noexcept
+  {
+    return (Store==StorageType::RowMajor && this->rows() > 1)? this->rows() : size();
+  }
+
+  /*!
+   * \brief Copy data into the container, in parallel if it is large.
+   */
+  void m_copy(size_t sz, const Scalar_t* src) noexcept
+  {
+    if(sz < OMP_FIRST_TOUCH_MIN) {
+      for(size_t i=0; i<sz; ++i) m_data[i] = src[i];
+      return;
+    }
+    const size_t nRows = m_parallelRows();
+    const size_t chunk = computeStaticChunkSize(nRows, omp_get_max_threads(), OMP_MAX_ROWS);
+    parallelFirstTouchCopy(nRows, sz/nRows, chunk, src, m_data);
+  }
+
 public:
   /*!
    * \brief Default ctor.
@@ -432,7 +462,7 @@ public:
   C2DContainer(const C2DContainer& other) noexcept : Base()
   {
     size_t sz = m_resize(other.rows(),other.cols());
-    for(size_t i=0; i<sz; ++i) m_data[i] = other.m_data[i];
+    m_copy(sz, other.m_data);
   }
 
   /*!
@@ -441,7 +471,7 @@ public:
   C2DContainer& operator= (const C2DContainer& other) noexcept
   {
     size_t sz = m_resize(other.rows(),other.cols());
-    for(size_t i=0; i<sz; ++i) m_data[i] = other.m_data[i];
+    m_copy(sz, other.m_data);
     return *this;
   }
 
@@ -478,10 +508,20 @@ public:
 
   /*!
    * \brief Set value of all entries to "value".
+   * \note Large containers are set in parallel (when called from serial code), with the
+   *       schedule of the solver point loops, this is what places the data of the solvers
+   *       on the NUMA domains of the threads that use it ("first touch" policy).
    */
   void setConstant(const Scalar_t& value) noexcept
   {
-    for(size_t i=0; i<size(); ++i) m_data[i] = value;
+    const size_t sz = size();
+    if(sz < OMP_FIRST_TOUCH_MIN) {
+      for(size_t i=0; i<sz; ++i) m_data[i] = value;
+      return;
+    }
+    const size_t nRows = m_parallelRows();
+    const size_t chunk = computeStaticChunkSize(nRows, omp_get_max_threads(), OMP_MAX_ROWS);
+    parallelFirstTouchSet(nRows, sz/nRows, chunk, value, m_data);
   }
 };
 
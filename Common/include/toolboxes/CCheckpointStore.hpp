@@ -0,0 +1,154 @@
+/*!
+ * \file CCheckpointStore.hpp
+ * \brief In-memory store of solution snapshots with binomial checkpoint placement.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../mpi_structure.hpp"
+
+#include <map>
+#include <vector>
+
+/*!
+ * \class CCheckpointStore
+ * \brief Keeps a limited number of snapshots (arrays of values identified by an iteration) in memory.
+ * \note Snapshots can be deflated (lossless) to trade time for memory. The placement of the snapshots
+ *       follows the binomial rule of "revolve" (Griewank and Walther), which minimizes the number of
+ *       times each step has to be recomputed when a sequence of steps is reversed with a limited number
+ *       of snapshots, see GetCheckpointOffset.
+ */
+class CCheckpointStore {
+private:
+  /*!
+   * \brief A stored snapshot.
+   */
+  struct CSnapshot {
+    unsigned long nValues = 0;  /*!< \brief Number of values of the snapshot. */
+    std::vector<char> data;     /*!< \brief The values, deflated or not. */
+  };
+
+  std::map<int, CSnapshot> snapshots; /*!< \brief The snapshots, by iteration. */
+  unsigned long capacity;             /*!< \brief Maximum number of snapshots. */
+  int compression;                    /*!< \brief Deflate level of the snapshots (0 for none). */
+
+public:
+  /*!
+   * \brief Construct an empty store.
+   * \param[in] capacity - Maximum number of snapshots.
+   * \param[in] compression - Deflate level (0 for none, requires zlib otherwise).
+   */
+  CCheckpointStore(unsigned long capacity, int compression = 0);
+
+  /*!
+   * \brief Maximum number of snapshots.
+   */
+  inline unsigned long GetCapacity() const { return capacity; }
+
+  /*!
+   * \brief Number of snapshots currently in the store.
+   */
+  inline unsigned long GetnSnapshots() const { return snapshots.size(); }
+
+  /*!
+   * \brief Whether the store holds the snapshot of an iteration.
+   */
+  inline bool Has(int iter) const { return snapshots.count(iter) > 0; }
+
+  /*!
+   * \brief Get the number of bytes used by the snapshots.
+   */
+  unsigned long GetMemory() const;
+
+  /*!
+   * \brief Store the snapshot of an iteration (replaces an existing one).
+   * \param[in] iter - Iteration of the snapshot.
+   * \param[in] values - The values.
+   */
+  void Store(int iter, const std::vector<passivedouble>& values);
+
+  /*!
+   * \brief Retrieve the snapshot of an iteration.
+   * \param[in] iter - Iteration of the snapshot.
+   * \param[out] values - The values (resized).
+   */
+  void Load(int iter, std::vector<passivedouble>& values) const;
+
+  /*!
+   * \brief Remove the snapshots of the iterations after iter.
+   */
+  void ReleaseAfter(int iter);
+
+  /*!
+   * \brief Get the latest iteration stored before iter.
+   * \return The iteration, or iter if there is none.
+   */
+  int GetLatestBefore(int iter) const;
+
+  /*!
+   * \brief Number of steps that can be reversed with nSnap snapshots if each step is computed at most
+   *        nRep times, i.e. the binomial coefficient (nSnap+nRep choose nSnap).
+   */
+  static unsigned long Beta(unsigned long nSnap, unsigned long nRep);
+
+  /*!
+   * \brief Where to take the next snapshot when advancing from a snapshot to reverse nSteps steps.
+   * \param[in] nSteps - Number of steps between the current snapshot and the end of the sequence.
+   * \param[in] nSnap - Number of snapshots available, including the current one.
+   * \return Number of steps to advance before taking the next snapshot (nSteps if none should be taken).
+   */
+  static unsigned long GetCheckpointOffset(unsigned long nSteps, unsigned long nSnap);
+
+  /*!
+   * \brief Latest iteration before iter from which a sequence of steps can be advanced, i.e. whose
+   *        nLevels states (the iteration and the previous ones) are available.
+   * \param[in] iter - Iteration that needs to be recomputed.
+   * \param[in] nLevels - Number of states needed to advance from an iteration.
+   * \param[in] available - Whether the state of an iteration is available (stored or elsewhere).
+   * \return The iteration, -1 (the initial state) if there is none.
+   */
+  template<class F>
+  static int GetBase(int iter, unsigned short nLevels, const F& available) {
+    int base = iter-1;
+    for (; base >= 0; base--) {
+      bool ok = true;
+      for (int iLevel = 0; ok && iLevel < nLevels; iLevel++) ok = available(base-iLevel);
+      if (ok) break;
+    }
+    return base;
+  }
+
+  /*!
+   * \brief Iterations to store while advancing from base to iter, such that the iterations before iter
+   *        can then be reversed with few recomputations.
+   * \note These are the nLevels states used by iter, and checkpoints of nLevels-1 states (what is needed
+   *       to advance from them, see GetBase) placed by GetCheckpointOffset with the free capacity.
+   * \param[in] base - Iteration the steps are advanced from.
+   * \param[in] iter - Last iteration to compute.
+   * \param[in] nLevels - Number of states used by an iteration (at least 2, the current and the previous).
+   * \return The iterations, sorted.
+   */
+  std::vector<int> GetRecomputeSchedule(int base, int iter, unsigned short nLevels) const;
+
+};
@@ -0,0 +1,96 @@
+/*!
+ * \file CGeometricPartitioner.hpp
+ * \brief Header file for the class CGeometricPartitioner.
+ *        The implementations are in the <i>CGeometricPartitioner.cpp</i> file.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../mpi_structure.hpp"
+
+#include <vector>
+#include <cstdint>
+
+/*!
+ * \class CGeometricPartitioner
+ * \brief Dependency-free partitioner based on the Hilbert space-filling curve.
+ * \note Points are mapped to a Hilbert key inside the global bounding box, the
+ *       curve is then cut into nParts pieces of (approximately) equal weight.
+ *       The cut positions are found with a distributed bisection on the key space,
+ *       which only needs reductions of nParts-1 values, the points themselves are
+ *       never communicated. This makes it suitable for the linearly distributed
+ *       points produced by CLinearPartitioner.
+ */
+class CGeometricPartitioner {
+public:
+  using KeyType = uint64_t;
+
+private:
+  const unsigned short nDim;  /*!< \brief Number of spatial dimensions. */
+  const int nParts;           /*!< \brief Number of parts in which to divide the points. */
+  const SU2_MPI::Comm comm;   /*!< \brief Communicator over which the points are distributed. */
+
+  /*!
+   * \brief Number of bits used by each dimension for the Hilbert keys.
+   */
+  inline unsigned short BitsPerDim() const { return (nDim == 2)? 31 : 21; }
+
+public:
+  /*!
+   * \brief Construct the partitioner.
+   * \param[in] val_nDim - Number of dimensions (2 or 3).
+   * \param[in] val_nParts - Number of parts (usually the number of ranks).
+   * \param[in] val_comm - Communicator over which the points are distributed.
+   */
+  CGeometricPartitioner(unsigned short val_nDim, int val_nParts,
+                        SU2_MPI::Comm val_comm = SU2_MPI::GetComm());
+
+  /*!
+   * \brief Compute the Hilbert key of a point given in integer coordinates.
+   * \param[in] nDim - Number of dimensions.
+   * \param[in] nBits - Number of significant bits of each coordinate.
+   * \param[in] intCoord - Integer coordinates, in [0, 2^nBits).
+   * \return The position of the point along the Hilbert curve.
+   */
+  static KeyType HilbertKey(unsigned short nDim, unsigned short nBits, const uint32_t* intCoord);
+
+  /*!
+   * \brief Compute the Hilbert keys of a set of points in the (global) bounding box of the set.
+   * \param[in] nPoint - Number of local points.
+   * \param[in] coord - Point coordinates, stored point-major (nPoint x nDim).
+   * \return Hilbert key of each local point.
+   */
+  std::vector<KeyType> ComputeKeys(unsigned long nPoint, const passivedouble* coord) const;
+
+  /*!
+   * \brief Partition the (distributed) set of points.
+   * \param[in] nPoint - Number of local points.
+   * \param[in] coord - Point coordinates, stored point-major (nPoint x nDim).
+   * \param[in] weight - Optional point weights (uniform if nullptr).
+   * \return Part of each local point, in [0, nParts).
+   */
+  std::vector<int> Partition(unsigned long nPoint, const passivedouble* coord,
+                             const passivedouble* weight = nullptr) const;
+
+};
@@ -0,0 +1,167 @@
+/*!
+ * \file CNodeHaloExchange.hpp
+ * \brief Header file for the class CNodeHaloExchange.
+ *        The implementations are in the <i>CNodeHaloExchange.cpp</i> file.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../mpi_structure.hpp"
+
+#include <vector>
+
+/*--- Shared memory windows are only used for plain (non-AD) types. ---*/
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+#define HAVE_NODE_HALO_EXCHANGE
+#endif
+
+/*!
+ * \class CNodeHaloExchange
+ * \brief Node-aware (hierarchical) implementation of the point-to-point halo exchange of CGeometry.
+ * \note The su2double comm buffers of all ranks in a node are allocated in one MPI-3 shared memory
+ *       window. Messages between ranks of the same node become copies between the buffers of the
+ *       two ranks, messages to other nodes are aggregated by the node leader into a single message
+ *       per pair of nodes. An exchange costs two barriers on the node communicator plus, on the
+ *       leaders only, one message per neighbor node.
+ *       The layout of the buffers is the same as for the regular exchange (see CGeometry), thus
+ *       the packing and unpacking code of the callers does not change.
+ */
+class CNodeHaloExchange {
+public:
+  /*!
+   * \brief Whether node-aware exchanges are supported by this build.
+   */
+  static constexpr bool IsSupported() {
+#ifdef HAVE_NODE_HALO_EXCHANGE
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  /*!
+   * \brief Build the node communicators and the routing of the messages, collective over MPI_COMM_WORLD.
+   * \note Ranks without sends or receives, and those with such a neighbor (transitively), are not
+   *       active (see IsActive), they keep using point-to-point messages.
+   * \param[in] nSend - Number of point-to-point sends.
+   * \param[in] neighborsSend - Destination rank of each send.
+   * \param[in] nPointSend - Cumulative number of points of the sends (nSend+1).
+   * \param[in] nRecv - Number of point-to-point receives.
+   * \param[in] neighborsRecv - Source rank of each receive.
+   * \param[in] nPointRecv - Cumulative number of points of the receives (nRecv+1).
+   */
+  CNodeHaloExchange(int nSend, const int* neighborsSend, const int* nPointSend,
+                    int nRecv, const int* neighborsRecv, const int* nPointRecv);
+
+  /*!
+   * \brief Destructor, frees the window and communicators (collective over the node).
+   */
+  ~CNodeHaloExchange();
+
+  CNodeHaloExchange(const CNodeHaloExchange&) = delete;
+  CNodeHaloExchange& operator=(const CNodeHaloExchange&) = delete;
+
+  /*!
+   * \brief (Re)allocate the shared buffers for a new packet size, collective over the node.
+   * \param[in] countPerPoint - Number of su2double per point.
+   * \param[out] bufSend - Send buffer of this rank.
+   * \param[out] bufRecv - Receive buffer of this rank.
+   */
+  void Allocate(unsigned short countPerPoint, su2double*& bufSend, su2double*& bufRecv);
+
+  /*!
+   * \brief Return the source of the next received message, the first call of each exchange
+   *        performs the actual communication (collective over the node).
+   * \param[in] countPerPoint - Number of su2double per point.
+   * \param[in] reverse - Whether the communication is reversed (recv buffers are sent).
+   * \return Rank from which the message was received.
+   */
+  int WaitAny(unsigned short countPerPoint, bool reverse);
+
+  /*!
+   * \brief Mark the end of an exchange.
+   */
+  inline void Finish() { nextMessage = 0; }
+
+  /*!
+   * \brief Whether this rank exchanges its messages through the node, if not, the object can be deleted.
+   */
+  inline bool IsActive() const { return active; }
+
+  /*!
+   * \brief Number of neighbor nodes (i.e. of messages sent by the leader per exchange).
+   */
+  inline int GetnNeighborNodes() const { return static_cast<int>(remoteNodes.size()); }
+
+private:
+  /*!
+   * \brief Segment of the buffer of a rank of the node.
+   */
+  struct Segment {
+    int nodeRank;  /*!< \brief Owner of the buffer. */
+    int offset;    /*!< \brief Offset of the segment in points. */
+    int nPoint;    /*!< \brief Size of the segment in points. */
+  };
+
+  bool active = false;                  /*!< \brief Whether this rank takes part in the node exchanges. */
+  int nextMessage = 0;                  /*!< \brief Next message returned by WaitAny. */
+  int nodeRank = 0, nodeSize = 1;       /*!< \brief Rank and size of the node communicator. */
+
+  std::vector<int> sendPeer, sendOffset;  /*!< \brief Destinations and cumulative point counts of the sends. */
+  std::vector<int> recvPeer, recvOffset;  /*!< \brief Sources and cumulative point counts of the receives. */
+
+  std::vector<int> peerSendOffset;  /*!< \brief For receives from the same node, offset of the message in the buffer of the source (-1 if not on the node). */
+  std::vector<int> peerRecvOffset;  /*!< \brief For sends to the same node, offset of the message in the buffer of the destination (-1 if not on the node). */
+  std::vector<int> peerNodeRankSend, peerNodeRankRecv; /*!< \brief Node rank of the peers (-1 if not on the node). */
+
+  std::vector<int> nSendPointNode;  /*!< \brief Size (points) of the send buffer of each rank of the node. */
+
+  std::vector<int> remoteNodes;                    /*!< \brief Neighbor nodes (leader only). */
+  std::vector<std::vector<Segment> > leaderOut;    /*!< \brief Outgoing (forward) segments to each neighbor node (leader only). */
+  std::vector<std::vector<Segment> > leaderIn;     /*!< \brief Incoming (forward) segments from each neighbor node (leader only). */
+  std::vector<su2double> leaderBufSend, leaderBufRecv; /*!< \brief Aggregation buffers (leader only). */
+
+  unsigned short allocCount = 0;    /*!< \brief Count per point of the current allocation. */
+  std::vector<su2double*> nodeBase; /*!< \brief Base address of the buffers of each rank of the node. */
+
+#ifdef HAVE_NODE_HALO_EXCHANGE
+  MPI_Comm nodeComm = MPI_COMM_NULL;    /*!< \brief Ranks that share memory. */
+  MPI_Comm leaderComm = MPI_COMM_NULL;  /*!< \brief Rank 0 of each node, its rank is the index of the node. */
+  MPI_Win window = MPI_WIN_NULL;        /*!< \brief Shared memory window holding the buffers. */
+  std::vector<MPI_Request> leaderReq;   /*!< \brief Requests of the leader messages. */
+#endif
+
+  /*!
+   * \brief Pointer to the send or receive buffer of a rank of the node.
+   */
+  inline su2double* Buffer(int iNodeRank, bool recv) const {
+    return nodeBase[iNodeRank] + (recv? size_t(nSendPointNode[iNodeRank])*allocCount : 0);
+  }
+
+  /*!
+   * \brief Perform the exchange of one communication (all messages).
+   */
+  void Exchange(unsigned short countPerPoint, bool reverse);
+
+};
@@ -0,0 +1,140 @@
+/*!
+ * \file CRestartDataCodec.hpp
+ * \brief Encoding of the data section of SU2 binary restart files.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../mpi_structure.hpp"
+
+#include <cstdio>
+#include <vector>
+
+/*!
+ * \class CRestartDataCodec
+ * \brief Encoding of the point data of SU2 binary restart files with mixed precision and block compression.
+ * \note Legacy files store every field of every point as a double. Encoded files are marked by
+ *       FORMAT_VERSION in the 4th int of the header and by the flags in the 5th int, the data that
+ *       follows the field names is:
+ *       - MIXED_PRECISION: one char per field, 1 if the field is stored as a float.
+ *       - COMPRESSED: the number of blocks and, for each block, its number of points and bytes
+ *         (unsigned longs), then the deflated blocks. Otherwise the point records follow directly.
+ *       - PARTITIONED: the records are in the order of the writer partitions (not sorted by global
+ *         index) and the data is followed by the index map, the record of each global point.
+ *       A point record is the sequence of its fields in their storage precision, blocks are
+ *       consecutive records of at most BLOCK_SIZE points that never span two writer ranks.
+ */
+class CRestartDataCodec {
+public:
+  enum : int {FORMAT_VERSION = 2};  /*!< \brief Value of the 4th header int of encoded files. */
+
+  enum : int {
+    MIXED_PRECISION = 1,  /*!< \brief Flag for the per-field precision table. */
+    COMPRESSED = 2,       /*!< \brief Flag for deflated blocks. */
+    PARTITIONED = 4       /*!< \brief Flag for records in partition order followed by an index map. */
+  };
+
+  enum : unsigned long {BLOCK_SIZE = 4096};  /*!< \brief Maximum number of points per compressed block. */
+
+#ifdef HAVE_MPI
+  using FileHandle = MPI_File;
+#else
+  using FileHandle = FILE*;
+#endif
+
+private:
+  std::vector<char> singlePrec;           /*!< \brief Whether each field is stored as a float. */
+  std::vector<unsigned long> fieldOffset; /*!< \brief Offset of each field in a point record. */
+  unsigned long recordSize = 0;           /*!< \brief Bytes per point. */
+
+public:
+  /*!
+   * \brief Construct the codec of a set of fields.
+   * \param[in] singlePrecision - Whether each field is stored as a float (one entry per field).
+   */
+  explicit CRestartDataCodec(std::vector<char> singlePrecision);
+
+  /*!
+   * \brief Get the number of bytes of a point record.
+   */
+  inline unsigned long GetRecordSize() const { return recordSize; }
+
+  /*!
+   * \brief Get the precision table written to file (one char per field).
+   */
+  inline const std::vector<char>& GetPrecisionTable() const { return singlePrec; }
+
+  /*!
+   * \brief Convert point-major doubles into records.
+   * \param[in] values - nPoints x nFields values.
+   * \param[in] nPoints - Number of points.
+   * \param[out] records - nPoints x GetRecordSize() bytes.
+   */
+  void Encode(const passivedouble* values, unsigned long nPoints, char* records) const;
+
+  /*!
+   * \brief Convert one record into doubles.
+   * \param[in] record - Record of the point.
+   * \param[out] values - nFields values.
+   */
+  void Decode(const char* record, passivedouble* values) const;
+
+  /*!
+   * \brief Whether this build can compress and decompress the data.
+   */
+  static constexpr bool CompressionSupported() {
+#ifdef HAVE_ZLIB
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  /*!
+   * \brief Compress records in blocks of at most BLOCK_SIZE points.
+   * \param[in] records - Records to compress.
+   * \param[in] nPoints - Number of records.
+   * \param[in] level - Deflate level (1-9).
+   * \param[out] blockTable - Number of points and bytes of each block (appended).
+   * \param[out] data - The compressed blocks (appended).
+   */
+  void Compress(const char* records, unsigned long nPoints, int level,
+                std::vector<unsigned long>& blockTable, std::vector<char>& data) const;
+
+  /*!
+   * \brief Read the data of a set of points from the part of an encoded file that follows the field names.
+   * \note Collective call with MPI, every rank reads only the records or blocks that contain its points
+   *       (and for the partitioned layout only the entries of the index map of its points).
+   * \param[in] file - Open file.
+   * \param[in] disp - Offset of the end of the field names.
+   * \param[in] flags - Flags of the file (5th int of the header).
+   * \param[in] nFields - Number of fields.
+   * \param[in] nPointGlobal - Number of points in the file.
+   * \param[in] points - Sorted global indices of the points to read.
+   * \param[out] data - Values of the points (points.size() x nFields).
+   */
+  static void Read(FileHandle file, unsigned long disp, int flags, int nFields, unsigned long nPointGlobal,
+                   const std::vector<unsigned long>& points, passivedouble* data);
+
+};
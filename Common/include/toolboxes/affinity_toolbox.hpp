@@ -0,0 +1,55 @@
+/*!
+ * \file affinity_toolbox.hpp
+ * \brief Functions to query and report the binding of threads to cores.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <ostream>
+
+namespace AffinityToolbox {
+
+/*!
+ * \brief Logical CPU on which the calling thread is currently running.
+ * \return CPU index, or -1 if it cannot be determined on this platform.
+ */
+int GetCurrentCpu();
+
+/*!
+ * \brief Set of logical CPUs on which the calling thread is allowed to run.
+ * \return Compact list of CPUs (e.g. "0-3,8"), or "n/a" if it cannot be determined.
+ */
+std::string GetCpuList();
+
+/*!
+ * \brief Print the host, CPU, and allowed CPUs of every thread of every rank (collective).
+ * \note Threads that are not pinned (allowed to run on many CPUs) are free to migrate away from
+ *       the NUMA domain where their data was first touched, use e.g. OMP_PROC_BIND and OMP_PLACES
+ *       (and the binding options of the MPI launcher) to control the placement.
+ * \param[in] out - Stream where rank 0 writes the report.
+ */
+void PrintThreadBinding(std::ostream& out);
+
+} // namespace AffinityToolbox
@@ -34,6 +34,7 @@
 
 #include "../include/basic_types/ad_structure.hpp"
 #include "../include/toolboxes/printing_toolbox.hpp"
+#include "../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 
 using namespace PrintingToolbox;
 
@@ -657,6 +658,10 @@ unsigned short CConfig::GetnZone(string val_mesh_filename, unsigned short val_fo
       nZone = 1;
       break;
     }
+    case SU2_BINARY: {
+      nZone = 1;
+      break;
+    }
   }
 
   return (unsigned short) nZone;
@@ -767,6 +772,12 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
       nDim = 3;
       break;
     }
+    case SU2_BINARY: {
+      int64_t header[CSU2BinaryMeshReaderFVM::N_HEADER_INT];
+      CSU2BinaryMeshReaderFVM::ReadHeader(val_mesh_filename, header);
+      nDim = header[CSU2BinaryMeshReaderFVM::NDIME];
+      break;
+    }
   }
 
   /*--- After reading the mesh, assert that the dimension is equal to 2 or 3. ---*/
@@ -1125,6 +1136,12 @@ void CConfig::SetConfig_Options() {
   addBoolOption("WRT_BINARY_RESTART", Wrt_Binary_Restart, true);
   /*!\brief BINARY_RESTART \n DESCRIPTION: Read / write binary SU2 native restart files. \n Options: YES, NO \ingroup Config */
   addBoolOption("READ_BINARY_RESTART", Read_Binary_Restart, true);
+  /*!\brief WRT_RESTART_SINGLE_PREC \n DESCRIPTION: Store the fields that are not read on restart as floats in binary restart files. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_RESTART_SINGLE_PREC", Wrt_Restart_Single_Prec, false);
+  /*!\brief WRT_RESTART_COMPRESSION \n DESCRIPTION: Deflate level (0-9) of the data of binary restart files, 0 for none. \ingroup Config */
+  addUnsignedShortOption("WRT_RESTART_COMPRESSION", Wrt_Restart_Compression, 0);
+  /*!\brief WRT_RESTART_PARTITIONED \n DESCRIPTION: Write the data of binary restart files in partition order followed by an index map. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_RESTART_PARTITIONED", Wrt_Restart_Partitioned, false);
   /*!\brief SYSTEM_MEASUREMENTS \n DESCRIPTION: System of measurements \n OPTIONS: see \link Measurements_Map \endlink \n DEFAULT: SI \ingroup Config*/
   addEnumOption("SYSTEM_MEASUREMENTS", SystemMeasurements, Measurements_Map, SI);
 
@@ -1571,8 +1588,10 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION:  Offset parameter for the buffet sensor */
   addDoubleOption("BUFFET_LAMBDA", Buffet_lambda, 0.0);
 
-  /* DESCRIPTION: Number of samples for quasi-Newton methods. */
+  /* DESCRIPTION: Number of samples for quasi-Newton methods (discrete adjoints and IQN-ILS FSI relaxation). */
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
+  /* DESCRIPTION: Number of time steps over which the IQN-ILS FSI relaxation keeps its history (0 discards it every time step). */
+  addUnsignedShortOption("QUASI_NEWTON_REUSE_STEPS", nQuasiNewtonReuseSteps, 0);
 
   /*!\par CONFIG_CATEGORY: Time-marching \ingroup Config*/
   /*--- Options related to time-marching ---*/
@@ -1618,6 +1637,10 @@ void CConfig::SetConfig_Options() {
   addLongOption("UNST_RESTART_ITER", Unst_RestartIter, 0);
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
+  /* DESCRIPTION: Number of direct solutions kept in memory by the unsteady discrete adjoint (0 reads them from file) */
+  addUnsignedLongOption("UNST_ADJ_CHECKPOINTS", Unst_AdjCheckpoints, 0);
+  /* DESCRIPTION: Deflate level (0-9) of the direct solutions kept in memory by the unsteady discrete adjoint */
+  addUnsignedShortOption("UNST_ADJ_CHECKPOINT_COMPRESSION", Unst_AdjCheckpoint_Compression, 0);
   /* DESCRIPTION: Number of iterations to average the objective */
   addLongOption("ITER_AVERAGE_OBJ", Iter_Avg_Objective , 0);
   /* DESCRIPTION: Iteration number to begin unsteady restarts (structural analysis) */
@@ -1913,6 +1936,10 @@ void CConfig::SetConfig_Options() {
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /*!\brief MESH_OUT_FORMAT \n DESCRIPTION: Mesh output file format, with SU2_BINARY SU2_DEF converts the input mesh. \n OPTIONS: see \link MeshOutput_Map \endlink \n DEFAULT: SU2 \ingroup Config*/
+  addEnumOption("MESH_OUT_FORMAT", Mesh_Out_FileFormat, MeshOutput_Map, SU2);
+  /*!\brief MESH_MAPPED_READ \n DESCRIPTION: Read SU2 ASCII meshes by memory mapping the file and parsing each rank's part in parallel. \n DEFAULT: YES \ingroup Config*/
+  addBoolOption("MESH_MAPPED_READ", Mesh_Mapped_Read, true);
 
   /* DESCRIPTION: List of the number of grid points in the RECTANGLE or BOX grid in the x,y,z directions. (default: (33,33,33) ). */
   addShortListOption("MESH_BOX_SIZE", nMesh_Box_Size, Mesh_Box_Size);
@@ -2426,6 +2453,7 @@ void CConfig::SetConfig_Options() {
 
   /*!\par KIND_INTERPOLATION \n
    * DESCRIPTION: Type of interpolation to use for multi-zone problems. \n OPTIONS: see \link Interpolator_Map \endlink
+   * Only NEAREST_NEIGHBOR and the local RBF stencils avoid gathering the entire donor boundary on every rank.
    * Sets Kind_Interpolation \ingroup Config
    */
   addEnumOption("KIND_INTERPOLATION", Kind_Interpolation, Interpolator_Map, NEAREST_NEIGHBOR);
@@ -2451,6 +2479,10 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Tolerance to prune small coefficients from the RBF interpolation matrix. */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PRUNE_TOLERANCE", RadialBasisFunction_PruneTol, 1e-6);
 
+  /* DESCRIPTION: Number of donors of the local RBF stencil of each target point (local-stencil approximation, no
+   * blending between stencils), 0 for a global RBF system. */
+  addUnsignedLongOption("RADIAL_BASIS_FUNCTION_NEIGHBORS", RadialBasisFunction_Neighbors, 0);
+
    /*!\par INLETINTERPOLATION \n
    * DESCRIPTION: Type of spanwise interpolation to use for the inlet face. \n OPTIONS: see \link Inlet_SpanwiseInterpolation_Map \endlink
    * Sets Kind_InletInterpolation \ingroup Config
@@ -2473,7 +2505,7 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("AITKEN_DYN_MAX_INITIAL", AitkenDynMaxInit, 0.5);
   /* DESCRIPTION: Aitken's dynamic minimum relaxation factor for the first iteration */
   addDoubleOption("AITKEN_DYN_MIN_INITIAL", AitkenDynMinInit, 0.5);
-  /* DESCRIPTION: Kind of relaxation */
+  /* DESCRIPTION: Kind of relaxation (NONE, FIXED_PARAMETER, AITKEN_DYNAMIC, IQN_ILS) */
   addEnumOption("BGS_RELAXATION", Kind_BGS_RelaxMethod, AitkenForm_Map, NO_RELAXATION);
   /* DESCRIPTION: Relaxation required */
   addBoolOption("RELAXATION", Relaxation, false);
@@ -2750,6 +2782,12 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("OUTPUT_WRT_FREQ", VolumeWrtFreq, 250);
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
+  /* DESCRIPTION: Write the volume solution files on a background thread while the solver continues */
+  addBoolOption("OUTPUT_ASYNC", Output_Async, false);
+  /* DESCRIPTION: Deflate level of the CGNS solution files (0 is no compression, requires CGNS with HDF5) */
+  addUnsignedShortOption("OUTPUT_CGNS_COMPRESSION", Output_CGNS_Compression, 0);
+  /* DESCRIPTION: Append the CGNS solutions of an unsteady run to one file instead of one file per time step */
+  addBoolOption("OUTPUT_TIME_SERIES", Output_Time_Series, false);
 
   /* DESCRIPTION: Using Uncertainty Quantification with SST Turbulence Model */
   addBoolOption("USING_UQ", using_uq, false);
@@ -2778,6 +2816,18 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
 
+  /* DESCRIPTION: Type of partitioner used to distribute the grid among MPI ranks. */
+  addEnumOption("PARTITIONER", Kind_Partitioner, Partitioner_Map, PARMETIS_PARTITIONER);
+
+  /* DESCRIPTION: Exchange halos through shared memory within a node and aggregate the messages between nodes. */
+  addBoolOption("NODE_AWARE_COMMS", NodeAware_Comms, false);
+
+  /* DESCRIPTION: Number of time iterations between load imbalance checks (0 disables dynamic load balancing). */
+  addUnsignedLongOption("LOAD_BALANCE_FREQ", LoadBalance_Freq, 0);
+
+  /* DESCRIPTION: Load imbalance (max/avg-1 of the rank compute times) above which the grid is repartitioned. */
+  addDoubleOption("LOAD_IMBALANCE_TOL", LoadImbalance_Tol, 0.1);
+
   /* END_CONFIG_OPTIONS */
 
 }
@@ -3168,6 +3218,16 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   }
 #endif
 
+  /*--- Check the compression of binary restart files, which requires zlib. ---*/
+  if (Wrt_Restart_Compression > 9) {
+    SU2_MPI::Error("WRT_RESTART_COMPRESSION must be between 0 (no compression) and 9.", CURRENT_FUNCTION);
+  }
+#ifndef HAVE_ZLIB
+  if (Wrt_Restart_Compression > 0) {
+    SU2_MPI::Error(string("Compressed restart files requested in option WRT_RESTART_COMPRESSION but SU2 was built without zlib support.\n"), CURRENT_FUNCTION);
+  }
+#endif
+
   /*--- STL_BINARY output not implelemted yet, but already a value in option_structure.hpp---*/
   for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++) {
     if (VolumeOutputFiles[iVolumeFile] == STL_BINARY){
@@ -3178,6 +3238,22 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     }
   }
 
+  /*--- The steps of a time series share the mesh written with the first one. ---*/
+  if (Output_Time_Series && GetDynamic_Grid()) {
+    SU2_MPI::Error("OUTPUT_TIME_SERIES requires a static mesh.", CURRENT_FUNCTION);
+  }
+
+  /*--- The quasi-Newton relaxation of the FSI coupling builds its history from the samples. ---*/
+  if ((Kind_BGS_RelaxMethod == IQN_ILS) && (nQuasiNewtonSamples < 2)) {
+    SU2_MPI::Error("BGS_RELAXATION= IQN_ILS requires QUASI_NEWTON_NUM_SAMPLES > 1.", CURRENT_FUNCTION);
+  }
+
+  /*--- Its history is passive, it is not recorded on the tape of the discrete adjoint. ---*/
+  if ((Kind_BGS_RelaxMethod == IQN_ILS) && DiscreteAdjoint) {
+    SU2_MPI::Error("BGS_RELAXATION= IQN_ILS is not differentiable, use FIXED_PARAMETER or AITKEN_DYNAMIC\n"
+                   "with MATH_PROBLEM= DISCRETE_ADJOINT.", CURRENT_FUNCTION);
+  }
+
 
   if (Kind_Solver == NAVIER_STOKES && Kind_Turb_Model != NONE){
     SU2_MPI::Error("KIND_TURB_MODEL must be NONE if SOLVER= NAVIER_STOKES", CURRENT_FUNCTION);
@@ -4744,6 +4820,33 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
                        CURRENT_FUNCTION);
       }
 
+      if (Unst_AdjCheckpoints > 0) {
+
+        /*--- The direct solutions are recomputed from the snapshots of the time levels of a step. ---*/
+
+        const unsigned long nTimeLevels = (TimeMarching == DT_STEPPING_2ND)? 3 : 2;
+
+        if ((TimeMarching != DT_STEPPING_1ST) && (TimeMarching != DT_STEPPING_2ND)) {
+          SU2_MPI::Error("UNST_ADJ_CHECKPOINTS requires dual time stepping.", CURRENT_FUNCTION);
+        }
+        if (GetGrid_Movement() || Deform_Mesh || !GetFluidProblem() || Multizone_Problem) {
+          SU2_MPI::Error("UNST_ADJ_CHECKPOINTS is only available for single zone fluid problems on static grids.", CURRENT_FUNCTION);
+        }
+        if (Unst_AdjCheckpoints < nTimeLevels) {
+          SU2_MPI::Error(string("UNST_ADJ_CHECKPOINTS must be at least ") + to_string(nTimeLevels) +
+                         string(", the number of time levels of the direct problem."), CURRENT_FUNCTION);
+        }
+      }
+
+      if (Unst_AdjCheckpoint_Compression > 9) {
+        SU2_MPI::Error("UNST_ADJ_CHECKPOINT_COMPRESSION must be between 0 (no compression) and 9.", CURRENT_FUNCTION);
+      }
+#ifndef HAVE_ZLIB
+      if (Unst_AdjCheckpoint_Compression > 0) {
+        SU2_MPI::Error(string("Compressed snapshots requested in option UNST_ADJ_CHECKPOINT_COMPRESSION but SU2 was built without zlib support.\n"), CURRENT_FUNCTION);
+      }
+#endif
+
       /*--- If the averaging interval is not set, we average over all time-steps ---*/
 
       if (Iter_Avg_Objective == 0.0) {
@@ -4889,6 +4992,14 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   /*--- Specifying a deforming surface requires a mesh deformation solver. ---*/
   if (GetSurface_Movement(DEFORMING)) Deform_Mesh = true;
 
+  /*--- Dynamic load balancing migrates the flow state of a single zone on a static grid. ---*/
+  if ((LoadBalance_Freq > 0) &&
+      (!fvm_flow || ContinuousAdjoint || DiscreteAdjoint || !Time_Domain || Multizone_Problem || GetDynamic_Grid())) {
+    SU2_MPI::Error(string("Dynamic load balancing is only available for unsteady single-zone finite-volume\n") +
+                   string("fluid simulations on static grids. Please set LOAD_BALANCE_FREQ = 0."),
+                   CURRENT_FUNCTION);
+  }
+
 }
 
 void CConfig::SetMarkers(unsigned short val_software) {
@@ -465,6 +465,137 @@ void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& front
 
 }
 
+void CADTPointsOnlyClass::DetermineNearestNodes_impl(vector<unsigned long>& frontLeaves,
+                                                     vector<unsigned long>& frontLeavesNew,
+                                                     const su2double       *coor,
+                                                     unsigned long         nNodes,
+                                                     vector<su2double>     &dist2,
+                                                     vector<unsigned long> &pointID,
+                                                     vector<int>           &rankID) const {
+
+  /*--- The number of nodes that can be found is limited by the size of the tree. ---*/
+  if( isEmpty ) nNodes = 0;
+  nNodes = min<unsigned long>(nNodes, localPointIDs.size());
+
+  dist2.resize(nNodes);
+  pointID.resize(nNodes);
+  rankID.resize(nNodes);
+  if(nNodes == 0) return;
+
+  const bool wasActive = AD::BeginPassive();
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: The candidates, i.e. the distance squared and the index of ---*/
+  /*---         the node in the ADT, are stored in a max-heap, the top of  ---*/
+  /*---         which is the farthest of the nNodes closest nodes found so ---*/
+  /*---         far. Equal distances are ordered by the point ID.          ---*/
+  /*--------------------------------------------------------------------------*/
+
+  typedef pair<su2double, unsigned long> CandidateType;
+
+  auto closer = [this](const CandidateType& a, const CandidateType& b) {
+    return (a.first != b.first)? (a.first < b.first)
+                               : (localPointIDs[a.second] < localPointIDs[b.second]);
+  };
+
+  vector<CandidateType> candidates;
+  candidates.reserve(nNodes);
+
+  auto addCandidate = [&](unsigned long kk) {
+    const su2double *coorTarget = coorPoints.data() + nDimADT*kk;
+    su2double distTarget = 0;
+    for(unsigned short l=0; l<nDimADT; ++l) {
+      const su2double ds = coor[l] - coorTarget[l];
+      distTarget += ds*ds;
+    }
+
+    const CandidateType candidate(distTarget, kk);
+    if(candidates.size() < nNodes) {
+      candidates.push_back(candidate);
+      push_heap(candidates.begin(), candidates.end(), closer);
+    }
+    else if( closer(candidate, candidates.front()) ) {
+      pop_heap(candidates.begin(), candidates.end(), closer);
+      candidates.back() = candidate;
+      push_heap(candidates.begin(), candidates.end(), closer);
+    }
+  };
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Traverse the tree. Every node is stored exactly once as a  ---*/
+  /*---         terminal child, hence only those are considered. A leaf is ---*/
+  /*---         skipped when the heap is full and its possible minimum     ---*/
+  /*---         distance squared exceeds the one of the top of the heap.   ---*/
+  /*--------------------------------------------------------------------------*/
+
+  frontLeaves.clear();
+  frontLeaves.push_back(0);
+
+  for(;;) {
+
+    frontLeavesNew.clear();
+
+    for(unsigned long i=0; i<frontLeaves.size(); ++i) {
+
+      const unsigned long ll = frontLeaves[i];
+      for(unsigned short mm=0; mm<2; ++mm) {
+
+        const unsigned long kk = leaves[ll].children[mm];
+        if( leaves[ll].childrenAreTerminal[mm] ) {
+
+          /* A tree of a single point stores it in both children. */
+          if(mm == 1 && leaves[ll].childrenAreTerminal[0] && leaves[ll].children[0] == kk) continue;
+
+          addCandidate(kk);
+        }
+        else {
+
+          su2double posDist = 0.0;
+          for(unsigned short l=0; l<nDimADT; ++l) {
+            su2double ds = 0.0;
+            if(     coor[l] < leaves[kk].xMin[l]) ds = coor[l] - leaves[kk].xMin[l];
+            else if(coor[l] > leaves[kk].xMax[l]) ds = coor[l] - leaves[kk].xMax[l];
+
+            posDist += ds*ds;
+          }
+
+          /* Leaves at the same distance as the top of the heap are kept, as
+             they may contain nodes that win the tie-break. */
+          if(candidates.size() < nNodes || posDist <= candidates.front().first)
+            frontLeavesNew.push_back(kk);
+        }
+      }
+    }
+
+    frontLeaves = frontLeavesNew;
+    if(frontLeaves.size() == 0) break;
+  }
+
+  AD::EndPassive(wasActive);
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 3: Sort the nodes by increasing distance and recompute the    ---*/
+  /*---         squared distances to get the correct dependency with AD.   ---*/
+  /*--------------------------------------------------------------------------*/
+
+  sort_heap(candidates.begin(), candidates.end(), closer);
+
+  for(unsigned long i=0; i<nNodes; ++i) {
+    const unsigned long kk = candidates[i].second;
+    const su2double *coorTarget = coorPoints.data() + nDimADT*kk;
+
+    su2double distTarget = 0.0;
+    for(unsigned short l=0; l<nDimADT; ++l) {
+      const su2double ds = coor[l] - coorTarget[l];
+      distTarget += ds*ds;
+    }
+
+    dist2[i]   = distTarget;
+    pointID[i] = localPointIDs[kk];
+    rankID[i]  = ranksOfPoints[kk];
+  }
+}
+
 CADTElemClass::CADTElemClass(unsigned short         val_nDim,
                              vector<su2double>      &val_coor,
                              vector<unsigned long>  &val_connElem,
@@ -28,6 +28,7 @@
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/omp_structure.hpp"
+#include "../../include/toolboxes/CNodeHaloExchange.hpp"
 
 /*--- Cross product ---*/
 
@@ -47,6 +48,8 @@
 (dest)[1] = (v1)[1] - (v2)[1];  \
 (dest)[2] = (v1)[2] - (v2)[2];
 
+thread_local passivedouble CGeometry::haloWaitTime = 0.0;
+
 CGeometry::CGeometry(void) :
   size(SU2_MPI::GetSize()),
   rank(SU2_MPI::GetRank()) {
@@ -120,6 +123,13 @@ CGeometry::~CGeometry(void) {
 
   /*--- Delete structures for MPI point-to-point communication. ---*/
 
+  if (nodeExchange != nullptr) {
+    /*--- The su2double buffers live in the shared memory window. ---*/
+    bufD_P2PRecv = nullptr;
+    bufD_P2PSend = nullptr;
+    delete nodeExchange;
+  }
+
   delete [] bufD_P2PRecv;
   delete [] bufD_P2PSend;
 
@@ -366,6 +376,31 @@ void CGeometry::PreprocessP2PComms(CGeometry *geometry,
    here to separate the interior and boundary nodes in order to help
    further overlap computation and communication. ---*/
 
+  /*--- Node-aware exchange through shared memory. Every exchange synchronizes the ranks
+   of a node, therefore the ranks that do not take part in all comms (no neighbors, e.g. on
+   coarse multigrid levels or when a rank owns only interior cells) and their neighbors
+   keep using point-to-point comms, see CNodeHaloExchange. ---*/
+
+  delete nodeExchange;
+  nodeExchange = nullptr;
+
+  if (config->GetNodeAware_Comms() && (size > SINGLE_NODE)) {
+
+    if (!CNodeHaloExchange::IsSupported()) {
+      if (rank == MASTER_NODE)
+        cout << "WARNING: Node-aware comms are not available in this build, using point-to-point comms." << endl;
+      return;
+    }
+
+    nodeExchange = new CNodeHaloExchange(nP2PSend, Neighbors_P2PSend, nPoint_P2PSend,
+                                         nP2PRecv, Neighbors_P2PRecv, nPoint_P2PRecv);
+    if (!nodeExchange->IsActive()) {
+      delete nodeExchange;
+      nodeExchange = nullptr;
+    }
+
+  }
+
 }
 
 void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
@@ -388,11 +423,16 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
 
   /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
 
-  delete [] bufD_P2PSend;
-  bufD_P2PSend = new su2double[maxCountPerPoint*nPoint_P2PSend[nP2PSend]] ();
+  if (nodeExchange != nullptr) {
+    nodeExchange->Allocate(maxCountPerPoint, bufD_P2PSend, bufD_P2PRecv);
+  }
+  else {
+    delete [] bufD_P2PSend;
+    bufD_P2PSend = new su2double[maxCountPerPoint*nPoint_P2PSend[nP2PSend]] ();
 
-  delete [] bufD_P2PRecv;
-  bufD_P2PRecv = new su2double[maxCountPerPoint*nPoint_P2PRecv[nP2PRecv]] ();
+    delete [] bufD_P2PRecv;
+    bufD_P2PRecv = new su2double[maxCountPerPoint*nPoint_P2PRecv[nP2PRecv]] ();
+  }
 
   delete [] bufS_P2PSend;
   bufS_P2PSend = new unsigned short[maxCountPerPoint*nPoint_P2PSend[nP2PSend]] ();
@@ -414,6 +454,10 @@ void CGeometry::PostP2PRecvs(CGeometry *geometry,
    the counts and sources, so we can launch these before we even load
    the data and send from the neighbor ranks. ---*/
 
+  /*--- With node-aware comms the data is exchanged when waiting for it. ---*/
+
+  if ((nodeExchange != nullptr) && (commType == COMM_TYPE_DOUBLE)) return;
+
   SU2_OMP_MASTER
   for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
     const auto iMessage = iRecv;
@@ -516,6 +560,8 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
 
   /*--- Post the non-blocking send as soon as the buffer is loaded. ---*/
 
+  if ((nodeExchange != nullptr) && (commType == COMM_TYPE_DOUBLE)) return;
+
   /*--- In some instances related to the adjoint solver, we need
    to reverse the direction of communications such that the normal
    send nodes become the recv nodes and vice-versa. ---*/
@@ -604,6 +650,58 @@ void CGeometry::PostP2PSends(CGeometry *geometry,
 
 }
 
+int CGeometry::WaitAnyP2PRecv(unsigned short commType,
+                              unsigned short countPerPoint,
+                              bool val_reverse) {
+
+  /*--- Global so all threads can see the result. ---*/
+  static int source;
+
+  SU2_OMP_MASTER
+  {
+    const passivedouble start = SU2_MPI::Wtime();
+
+    if ((nodeExchange != nullptr) && (commType == COMM_TYPE_DOUBLE)) {
+      source = nodeExchange->WaitAny(countPerPoint, val_reverse);
+    }
+    else {
+      int ind;
+      SU2_MPI::Status status;
+      SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
+      source = status.MPI_SOURCE;
+    }
+    haloWaitTime += SU2_MPI::Wtime() - start;
+  }
+  SU2_OMP_BARRIER
+
+  return source;
+
+}
+
+void CGeometry::WaitAllP2PSends(unsigned short commType) {
+
+  /*--- Verify that all non-blocking point-to-point sends have finished.
+   Note that this should be satisfied, as we have received all of the
+   data at this point. ---*/
+
+  SU2_OMP_MASTER
+  {
+    const passivedouble start = SU2_MPI::Wtime();
+
+    if ((nodeExchange != nullptr) && (commType == COMM_TYPE_DOUBLE)) {
+      nodeExchange->Finish();
+    }
+    else {
+#ifdef HAVE_MPI
+      SU2_MPI::Waitall(nP2PSend, req_P2PSend, MPI_STATUS_IGNORE);
+#endif
+    }
+    haloWaitTime += SU2_MPI::Wtime() - start;
+  }
+  SU2_OMP_BARRIER
+
+}
+
 void CGeometry::GetCommCountAndType(const CConfig* config,
                                     unsigned short commType,
                                     unsigned short &COUNT_PER_POINT,
@@ -756,10 +854,7 @@ void CGeometry::CompleteComms(CGeometry *geometry,
   unsigned short iDim, COUNT_PER_POINT = 0, MPI_TYPE = 0;
   unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
 
-  int ind, source, iMessage, jRecv;
-
-  /*--- Global status so all threads can see the result of Waitany. ---*/
-  static SU2_MPI::Status status;
+  int source, iMessage, jRecv;
 
   /*--- Set the size of the data packet and type depending on quantity. ---*/
 
@@ -780,13 +875,7 @@ void CGeometry::CompleteComms(CGeometry *geometry,
     /*--- For efficiency, recv the messages dynamically based on
      the order they arrive. ---*/
 
-    SU2_OMP_MASTER
-    SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
-    SU2_OMP_BARRIER
-
-    /*--- Once we have recv'd a message, get the source rank. ---*/
-
-    source = status.MPI_SOURCE;
+    source = geometry->WaitAnyP2PRecv(MPI_TYPE, COUNT_PER_POINT, false);
 
     /*--- We know the offsets based on the source rank. ---*/
 
@@ -841,15 +930,9 @@ void CGeometry::CompleteComms(CGeometry *geometry,
     }
   }
 
-  /*--- Verify that all non-blocking point-to-point sends have finished.
-   Note that this should be satisfied, as we have received all of the
-   data in the loop above at this point. ---*/
+  /*--- Verify that all non-blocking point-to-point sends have finished. ---*/
 
-#ifdef HAVE_MPI
-  SU2_OMP_MASTER
-  SU2_MPI::Waitall(nP2PSend, req_P2PSend, MPI_STATUS_IGNORE);
-#endif
-  SU2_OMP_BARRIER
+  geometry->WaitAllP2PSends(MPI_TYPE);
 
 }
 
@@ -1411,6 +1494,24 @@ bool CGeometry::CheckEdge(unsigned long first_point, unsigned long second_point)
   return false;
 }
 
+vector<unsigned long> CGeometry::GetDomainGlobalIndices() const {
+  vector<unsigned long> globalIndices;
+  globalIndices.reserve(nPointDomain);
+  for (unsigned long iPoint_Global = 0; iPoint_Global < Global_nPointDomain; iPoint_Global++)
+    if (GetGlobal_to_Local_Point(iPoint_Global) > -1) globalIndices.push_back(iPoint_Global);
+  return globalIndices;
+}
+
+vector<unsigned long> CGeometry::GetDomainPointsInGlobalOrder() const {
+  vector<unsigned long> localIndices;
+  localIndices.reserve(nPointDomain);
+  for (unsigned long iPoint_Global = 0; iPoint_Global < Global_nPointDomain; iPoint_Global++) {
+    const auto iPoint = GetGlobal_to_Local_Point(iPoint_Global);
+    if (iPoint > -1) localIndices.push_back(iPoint);
+  }
+  return localIndices;
+}
+
 void CGeometry::SetEdges(void) {
 
   nEdge = 0;
@@ -29,11 +29,15 @@
 #include "../../include/adt_structure.hpp"
 #include "../../include/toolboxes/printing_toolbox.hpp"
 #include "../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../include/toolboxes/CGeometricPartitioner.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/toolboxes/CRestartDataCodec.hpp"
 #include "../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CSU2ASCIIMappedMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CRectangularMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CBoxMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 
 #include "../../include/geometry/primal_grid/CPrimalGrid.hpp"
 #include "../../include/geometry/primal_grid/CLine.hpp"
@@ -48,6 +52,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <iterator>
+#include <numeric>
 #include <unordered_set>
 #include <queue>
 #ifdef _MSC_VER
@@ -96,7 +101,7 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
   else {
 
     switch (val_format) {
-      case SU2: case CGNS_GRID: case RECTANGLE: case BOX:
+      case SU2: case CGNS_GRID: case RECTANGLE: case BOX: case SU2_BINARY:
         Read_Mesh_FVM(config, val_mesh_filename, val_iZone, val_nZone);
         break;
       default:
@@ -228,9 +233,8 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
     cout <<"Rebalancing markers and surface elements." << endl;
 
   /*--- First, perform a linear partitioning of the marker information, as
-   the grid readers currently store all boundary information on the master
-   rank. In the future, this process can be moved directly into the grid
-   reader to avoid reading the markers to the master rank alone at first. ---*/
+   most grid readers store all boundary information on the master rank (the
+   CGNS reader already distributes the surface elements over all ranks). ---*/
 
   DistributeMarkerTags(config, geometry);
   PartitionSurfaceConnectivity(config, geometry, LINE         );
@@ -474,6 +478,26 @@ void CPhysicalGeometry::SetGlobal_to_Local_Point(void) {
   }
 }
 
+vector<unsigned long> CPhysicalGeometry::GetDomainGlobalIndices() const {
+  vector<unsigned long> globalIndices(nPointDomain);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    globalIndices[iPoint] = nodes->GetGlobalIndex(iPoint);
+  sort(globalIndices.begin(), globalIndices.end());
+  return globalIndices;
+}
+
+vector<unsigned long> CPhysicalGeometry::GetDomainPointsInGlobalOrder() const {
+  vector<pair<unsigned long, unsigned long> > order(nPointDomain);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    order[iPoint] = make_pair(nodes->GetGlobalIndex(iPoint), iPoint);
+  sort(order.begin(), order.end());
+
+  vector<unsigned long> localIndices(nPointDomain);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    localIndices[iPoint] = order[iPoint].second;
+  return localIndices;
+}
+
 void CPhysicalGeometry::DistributeColoring(CConfig *config,
                                            CGeometry *geometry) {
 
@@ -1350,16 +1374,14 @@ void CPhysicalGeometry::PartitionSurfaceConnectivity(CConfig *config,
                                                      CGeometry *geometry,
                                                      unsigned short Elem_Type) {
 
-  /*--- We begin with all marker information residing on the master rank,
-   as the master currently stores all marker info when reading the grid.
-   We first check and communicate basic information that each rank will
-   need to hold its portion of the linearly partitioned markers. In a
+  /*--- We begin with the marker information residing on the ranks that
+   loaded it from the grid reader (the master alone for most readers, any
+   rank for readers that distribute the markers). We first check and
+   communicate basic information that each rank will need to hold its portion of the linearly partitioned markers. In a
    later step, we will distribute the markers according to the ParMETIS
    coloring. This intermediate step is necessary since we already have the
    correct coloring distributed by the linear partitions, which we would
-   like to reuse when partitioning the markers. Plus, the markers should
-   truly be linearly partitioned upon reading the mesh, which we will
-   change eventually. ---*/
+   like to reuse when partitioning the markers. ---*/
 
   unsigned short NODES_PER_ELEMENT = 0;
 
@@ -1403,51 +1425,60 @@ void CPhysicalGeometry::PartitionSurfaceConnectivity(CConfig *config,
   }
   nElem_Send[size] = 0; nElem_Recv[size] = 0;
 
-  /*--- We know that the master owns all of the info and will be the only
-   rank sending anything, although all ranks might receive something. ---*/
+  /*--- Any rank may own surface elements and all ranks might receive
+   something. The global surface element IDs are offset by the number of
+   surface elements on the lower ranks. ---*/
 
-  if (rank == MASTER_NODE) {
-    for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+  unsigned long nElem_Local = 0;
+  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
 
-      /*--- Reset the flag in between markers, just to ensure that we
-       don't miss some elements on different markers with the same local
-       index. ---*/
+    nElem_Local += geometry->GetnElem_Bound(iMarker);
 
-      for (iProc = 0; iProc < size; iProc++) nElem_Flag[iProc]= -1;
+    /*--- Reset the flag in between markers, just to ensure that we
+     don't miss some elements on different markers with the same local
+     index. ---*/
 
-      for (iElem = 0; iElem < geometry->GetnElem_Bound(iMarker); iElem++) {
+    for (iProc = 0; iProc < size; iProc++) nElem_Flag[iProc]= -1;
 
-        if (geometry->bound[iMarker][iElem]->GetVTK_Type() == Elem_Type) {
+    for (iElem = 0; iElem < geometry->GetnElem_Bound(iMarker); iElem++) {
 
-          for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++ ) {
+      if (geometry->bound[iMarker][iElem]->GetVTK_Type() == Elem_Type) {
 
-            /*--- Get the index of the current point (stored as global). ---*/
+        for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++ ) {
 
-            Global_Index = geometry->bound[iMarker][iElem]->GetNode(iNode);
+          /*--- Get the index of the current point (stored as global). ---*/
 
-            /*--- Search for the processor that owns this point ---*/
+          Global_Index = geometry->bound[iMarker][iElem]->GetNode(iNode);
 
-            iProcessor = GetLinearPartition(Global_Index);
+          /*--- Search for the processor that owns this point ---*/
 
-            /*--- If we have not visited this element yet, increment our
-             number of elements that must be sent to a particular proc. ---*/
+          iProcessor = GetLinearPartition(Global_Index);
 
-            if ((nElem_Flag[iProcessor] != (int)iElem)) {
-              nElem_Flag[iProcessor] = (int)iElem;
-              nElem_Send[iProcessor+1]++;
-            }
+          /*--- If we have not visited this element yet, increment our
+           number of elements that must be sent to a particular proc. ---*/
+
+          if ((nElem_Flag[iProcessor] != (int)iElem)) {
+            nElem_Flag[iProcessor] = (int)iElem;
+            nElem_Send[iProcessor+1]++;
           }
         }
       }
     }
   }
 
+  vector<unsigned long> nElem_Rank(size);
+  SU2_MPI::Allgather(&nElem_Local, 1, MPI_UNSIGNED_LONG,
+                     nElem_Rank.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  const unsigned long Elem_Index_Offset = accumulate(nElem_Rank.begin(),
+                                                     nElem_Rank.begin()+rank, 0ul);
+
   /*--- Communicate the number of cells to be sent/recv'd amongst
    all processors. After this communication, each proc knows how
    many cells it will receive from each other processor. ---*/
 
-  SU2_MPI::Scatter(&(nElem_Send[1]), 1, MPI_INT,
-                   &(nElem_Recv[1]), 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
+                    &(nElem_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
 
   /*--- Prepare to send connectivities. First check how many
    messages we will be sending and receiving. Here we also put
@@ -1467,99 +1498,91 @@ void CPhysicalGeometry::PartitionSurfaceConnectivity(CConfig *config,
 
   /*--- Allocate memory to hold the connectivity that we are sending. ---*/
 
-  unsigned long *connSend   = nullptr;
-  unsigned long *markerSend = nullptr;
-  unsigned long *idSend     = nullptr;
-
-  if (rank == MASTER_NODE) {
-
-    connSend = new unsigned long[NODES_PER_ELEMENT*nElem_Send[size]];
-    for (iSend = 0; iSend < NODES_PER_ELEMENT*nElem_Send[size]; iSend++)
-      connSend[iSend] = 0;
-
-    markerSend = new unsigned long[nElem_Send[size]];
-    for (iSend = 0; iSend < nElem_Send[size]; iSend++)
-      markerSend[iSend] = 0;
+  unsigned long *connSend = new unsigned long[NODES_PER_ELEMENT*nElem_Send[size]];
+  for (iSend = 0; iSend < NODES_PER_ELEMENT*nElem_Send[size]; iSend++)
+    connSend[iSend] = 0;
 
-    idSend = new unsigned long[nElem_Send[size]];
-    for (iSend = 0; iSend < nElem_Send[size]; iSend++)
-      idSend[iSend] = 0;
+  unsigned long *markerSend = new unsigned long[nElem_Send[size]];
+  for (iSend = 0; iSend < nElem_Send[size]; iSend++)
+    markerSend[iSend] = 0;
 
-    /*--- Create an index variable to keep track of our index
-     position as we load up the send buffer. ---*/
+  unsigned long *idSend = new unsigned long[nElem_Send[size]];
+  for (iSend = 0; iSend < nElem_Send[size]; iSend++)
+    idSend[iSend] = 0;
 
-    unsigned long *index = new unsigned long[size];
-    for (iProc = 0; iProc < size; iProc++)
-      index[iProc] = NODES_PER_ELEMENT*nElem_Send[iProc];
+  /*--- Create an index variable to keep track of our index
+   position as we load up the send buffer. ---*/
 
-    unsigned long *markerIndex = new unsigned long[size];
-    for (iProc = 0; iProc < size; iProc++)
-      markerIndex[iProc] = nElem_Send[iProc];
+  unsigned long *index = new unsigned long[size];
+  for (iProc = 0; iProc < size; iProc++)
+    index[iProc] = NODES_PER_ELEMENT*nElem_Send[iProc];
 
-    /*--- Loop through our elements and load the elems and their
-     additional data that we will send to the other procs. ---*/
+  unsigned long *markerIndex = new unsigned long[size];
+  for (iProc = 0; iProc < size; iProc++)
+    markerIndex[iProc] = nElem_Send[iProc];
 
-    Global_Elem_Index = 0;
-    for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+  /*--- Loop through our elements and load the elems and their
+   additional data that we will send to the other procs. ---*/
 
-      /*--- Reset the flag in between markers, just to ensure that we
-       don't miss some elements on different markers with the same local
-       index. ---*/
+  Global_Elem_Index = Elem_Index_Offset;
+  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
 
-      for (iProc = 0; iProc < size; iProc++) nElem_Flag[iProc]= -1;
+    /*--- Reset the flag in between markers, just to ensure that we
+     don't miss some elements on different markers with the same local
+     index. ---*/
 
-      for (iElem = 0; iElem < geometry->GetnElem_Bound(iMarker); iElem++) {
-        if (geometry->bound[iMarker][iElem]->GetVTK_Type() == Elem_Type) {
-          for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++ ) {
+    for (iProc = 0; iProc < size; iProc++) nElem_Flag[iProc]= -1;
 
-            /*--- Get the index of the current point. ---*/
+    for (iElem = 0; iElem < geometry->GetnElem_Bound(iMarker); iElem++) {
+      if (geometry->bound[iMarker][iElem]->GetVTK_Type() == Elem_Type) {
+        for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++ ) {
 
-            Global_Index = geometry->bound[iMarker][iElem]->GetNode(iNode);
+          /*--- Get the index of the current point. ---*/
 
-            /*--- Search for the processor that owns this point ---*/
+          Global_Index = geometry->bound[iMarker][iElem]->GetNode(iNode);
 
-            iProcessor = GetLinearPartition(Global_Index);
+          /*--- Search for the processor that owns this point ---*/
 
-            /*--- Load connectivity into the buffer for sending ---*/
+          iProcessor = GetLinearPartition(Global_Index);
 
-            if ((nElem_Flag[iProcessor] != (int)iElem)) {
+          /*--- Load connectivity into the buffer for sending ---*/
 
-              nElem_Flag[iProcessor] = (int)iElem;
-              unsigned long nn = index[iProcessor];
-              unsigned long mm = markerIndex[iProcessor];
+          if ((nElem_Flag[iProcessor] != (int)iElem)) {
 
-              /*--- Load the connectivity values. ---*/
+            nElem_Flag[iProcessor] = (int)iElem;
+            unsigned long nn = index[iProcessor];
+            unsigned long mm = markerIndex[iProcessor];
 
-              for (jNode = 0; jNode < NODES_PER_ELEMENT; jNode++) {
-                connSend[nn] = geometry->bound[iMarker][iElem]->GetNode(jNode);
-                nn++;
-              }
+            /*--- Load the connectivity values. ---*/
 
-              /*--- Store the marker index and surface elem global ID ---*/
+            for (jNode = 0; jNode < NODES_PER_ELEMENT; jNode++) {
+              connSend[nn] = geometry->bound[iMarker][iElem]->GetNode(jNode);
+              nn++;
+            }
 
-              markerSend[mm] = iMarker;
-              idSend[mm]     = Global_Elem_Index;
+            /*--- Store the marker index and surface elem global ID ---*/
 
-              /*--- Increment the index by the message length ---*/
+            markerSend[mm] = iMarker;
+            idSend[mm]     = Global_Elem_Index;
 
-              index[iProcessor] += NODES_PER_ELEMENT;
-              markerIndex[iProcessor]++;
-            }
+            /*--- Increment the index by the message length ---*/
 
+            index[iProcessor] += NODES_PER_ELEMENT;
+            markerIndex[iProcessor]++;
           }
+
         }
+      }
 
-        Global_Elem_Index++;
+      Global_Elem_Index++;
 
-      }
     }
+  }
 
-    /*--- Free memory after loading up the send buffer. ---*/
-
-    delete [] index;
-    delete [] markerIndex;
+  /*--- Free memory after loading up the send buffer. ---*/
 
-  }
+  delete [] index;
+  delete [] markerIndex;
 
   /*--- Allocate the memory that we need for receiving the conn
    values and then cue up the non-blocking receives. Note that
@@ -1608,25 +1631,21 @@ void CPhysicalGeometry::PartitionSurfaceConnectivity(CConfig *config,
 
   /*--- Copy my own rank's data into the recv buffer directly. ---*/
 
-  if (rank == MASTER_NODE) {
-
-    iRecv   = NODES_PER_ELEMENT*nElem_Recv[rank];
-    myStart = NODES_PER_ELEMENT*nElem_Send[rank];
-    myFinal = NODES_PER_ELEMENT*nElem_Send[rank+1];
-    for (iSend = myStart; iSend < myFinal; iSend++) {
-      connRecv[iRecv] = connSend[iSend];
-      iRecv++;
-    }
-
-    iRecv   = nElem_Recv[rank];
-    myStart = nElem_Send[rank];
-    myFinal = nElem_Send[rank+1];
-    for (iSend = myStart; iSend < myFinal; iSend++) {
-      markerRecv[iRecv] = markerSend[iSend];
-      idRecv[iRecv]     = idSend[iSend];
-      iRecv++;
-    }
+  iRecv   = NODES_PER_ELEMENT*nElem_Recv[rank];
+  myStart = NODES_PER_ELEMENT*nElem_Send[rank];
+  myFinal = NODES_PER_ELEMENT*nElem_Send[rank+1];
+  for (iSend = myStart; iSend < myFinal; iSend++) {
+    connRecv[iRecv] = connSend[iSend];
+    iRecv++;
+  }
 
+  iRecv   = nElem_Recv[rank];
+  myStart = nElem_Send[rank];
+  myFinal = nElem_Send[rank+1];
+  for (iSend = myStart; iSend < myFinal; iSend++) {
+    markerRecv[iRecv] = markerSend[iSend];
+    idRecv[iRecv]     = idSend[iSend];
+    iRecv++;
   }
 
   /*--- Complete the non-blocking communications. ---*/
@@ -3703,7 +3722,10 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig        *config,
   CMeshReaderFVM *MeshFVM = nullptr;
   switch (val_format) {
     case SU2:
-      MeshFVM = new CSU2ASCIIMeshReaderFVM(config, val_iZone, val_nZone);
+      if (CSU2ASCIIMappedMeshReaderFVM::CanRead(config))
+        MeshFVM = new CSU2ASCIIMappedMeshReaderFVM(config, val_iZone, val_nZone);
+      else
+        MeshFVM = new CSU2ASCIIMeshReaderFVM(config, val_iZone, val_nZone);
       break;
     case CGNS_GRID:
       MeshFVM = new CCGNSMeshReaderFVM(config, val_iZone, val_nZone);
@@ -3714,6 +3736,9 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig        *config,
     case BOX:
       MeshFVM = new CBoxMeshReaderFVM(config, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      MeshFVM = new CSU2BinaryMeshReaderFVM(config, val_iZone, val_nZone);
+      break;
     default:
       SU2_MPI::Error("Unrecognized mesh format specified!", CURRENT_FUNCTION);
       break;
@@ -3952,133 +3977,143 @@ void CPhysicalGeometry::LoadLinearlyPartitionedVolumeElements(CConfig        *co
 void CPhysicalGeometry::LoadUnpartitionedSurfaceElements(CConfig        *config,
                                                          CMeshReaderFVM *mesh) {
 
-  /*--- The master node takes care of loading all markers and
-   surface elements from the file. This information is later
-   put into linear partitions to make its redistribution easier
-   after we call ParMETIS. ---*/
-
-  if (rank == MASTER_NODE) {
+  /*--- Each rank loads the surface elements it received from the mesh
+   reader. Depending on the reader, these are all on the master node or
+   distributed over the ranks, with each element on exactly one rank.
+   This information is later put into linear partitions to make its
+   redistribution easier after we call ParMETIS. The marker settings
+   in the config are handled by the master node alone. ---*/
 
-    const vector<string> &sectionNames = mesh->GetMarkerNames();
+  const vector<string> &sectionNames = mesh->GetMarkerNames();
 
-    /*--- Store the number of markers and print to the screen. ---*/
+  /*--- Store the number of markers and print to the screen. ---*/
 
-    nMarker = mesh->GetNumberOfMarkers();
+  nMarker = mesh->GetNumberOfMarkers();
+  if (rank == MASTER_NODE) {
     config->SetnMarker_All(nMarker);
     cout << nMarker << " surface markers." << endl;
+  }
 
-    /*--- Create the data structure for boundary elements. ---*/
+  /*--- Create the data structure for boundary elements. ---*/
 
-    bound         = new CPrimalGrid**[nMarker];
-    nElem_Bound   = new unsigned long [nMarker];
+  bound         = new CPrimalGrid**[nMarker];
+  nElem_Bound   = new unsigned long [nMarker];
+  if (rank == MASTER_NODE)
     Tag_to_Marker = new string [config->GetnMarker_Max()];
 
-    /*--- Set some temporaries for the loop below. ---*/
+  /*--- Set some temporaries for the loop below. ---*/
+
+  int npe, vtk_type;
+  unsigned long iElem = 0;
+  vector<unsigned long> connectivity(N_POINTS_HEXAHEDRON);
 
-    int npe, vtk_type;
-    unsigned long iElem = 0;
-    vector<unsigned long> connectivity(N_POINTS_HEXAHEDRON);
+  /*--- Loop over all sections that we extracted from the CGNS file
+   that were identified as boundary element sections so that we can
+   store those elements into our SU2 data structures. ---*/
 
-    /*--- Loop over all sections that we extracted from the CGNS file
-     that were identified as boundary element sections so that we can
-     store those elements into our SU2 data structures. ---*/
+  for (int iMarker = 0; iMarker < nMarker; iMarker++) {
 
-    for (int iMarker = 0; iMarker < nMarker; iMarker++) {
+    /*--- Initialize some counter variables ---*/
 
-      /*--- Initialize some counter variables ---*/
+    nelem_edge_bound = 0; nelem_triangle_bound = 0;
+    nelem_quad_bound = 0; iElem = 0;
 
-      nelem_edge_bound = 0; nelem_triangle_bound = 0;
-      nelem_quad_bound = 0; iElem = 0;
+    /*--- Get the string name for this marker. ---*/
 
-      /*--- Get the string name for this marker. ---*/
+    string Marker_Tag = sectionNames[iMarker];
 
-      string Marker_Tag = sectionNames[iMarker];
+    /* Get the marker info and surface connectivity from the mesh object. */
 
-      /* Get the marker info and surface connectivity from the mesh object. */
+    const unsigned long surfElems =
+    mesh->GetNumberOfSurfaceElementsForMarker(iMarker);
 
-      const unsigned long surfElems =
-      mesh->GetNumberOfSurfaceElementsForMarker(iMarker);
+    const vector<unsigned long> &connElems =
+    mesh->GetSurfaceElementConnectivityForMarker(iMarker);
 
-      const vector<unsigned long> &connElems =
-      mesh->GetSurfaceElementConnectivityForMarker(iMarker);
+    /*--- Set the number of boundary elements in this marker. ---*/
 
-      /*--- Set the number of boundary elements in this marker. ---*/
+    nElem_Bound[iMarker] = surfElems;
 
-      nElem_Bound[iMarker] = surfElems;
+    /*--- Report the number and name of the marker to the console. ---*/
 
-      /*--- Report the number and name of the marker to the console. ---*/
+    unsigned long Global_nElem_Bound = 0;
+    SU2_MPI::Reduce(&nElem_Bound[iMarker], &Global_nElem_Bound, 1,
+                    MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
 
-      cout << nElem_Bound[iMarker]  << " boundary elements in index ";
+    if (rank == MASTER_NODE) {
+      cout << Global_nElem_Bound  << " boundary elements in index ";
       cout << iMarker <<" (Marker = " <<Marker_Tag<< ")." << endl;
+    }
 
-      /*--- Instantiate the list of elements in the data structure. ---*/
+    /*--- Instantiate the list of elements in the data structure. ---*/
 
-      bound[iMarker] = new CPrimalGrid*[nElem_Bound[iMarker]];
+    bound[iMarker] = new CPrimalGrid*[nElem_Bound[iMarker]];
 
-      for (unsigned long jElem = 0; jElem < nElem_Bound[iMarker]; jElem++ ) {
+    for (unsigned long jElem = 0; jElem < nElem_Bound[iMarker]; jElem++ ) {
 
-        /*--- Not a mixed section. We already know the element type,
-         which is stored ---*/
+      /*--- Not a mixed section. We already know the element type,
+       which is stored ---*/
 
-        vtk_type = (int)connElems[jElem*SU2_CONN_SIZE + 1];
+      vtk_type = (int)connElems[jElem*SU2_CONN_SIZE + 1];
 
-        /*--- Store the loop size more easily. ---*/
+      /*--- Store the loop size more easily. ---*/
 
-        npe = (int)(SU2_CONN_SIZE-SU2_CONN_SKIP);
+      npe = (int)(SU2_CONN_SIZE-SU2_CONN_SKIP);
 
-        /*--- Store the nodes for this element more clearly. ---*/
+      /*--- Store the nodes for this element more clearly. ---*/
 
-        for (int j = 0; j < npe; j++) {
-          unsigned long nn = jElem*SU2_CONN_SIZE + SU2_CONN_SKIP + j;
-          connectivity[j] = connElems[nn];
-        }
+      for (int j = 0; j < npe; j++) {
+        unsigned long nn = jElem*SU2_CONN_SIZE + SU2_CONN_SKIP + j;
+        connectivity[j] = connElems[nn];
+      }
 
-        /*--- Instantiate the boundary element object. ---*/
-
-        switch(vtk_type) {
-          case LINE:
-            bound[iMarker][iElem] = new CLine(connectivity[0],
-                                              connectivity[1],2);
-            iElem++; nelem_edge_bound++; break;
-          case TRIANGLE:
-            bound[iMarker][iElem] = new CTriangle(connectivity[0],
-                                                  connectivity[1],
-                                                  connectivity[2],3);
-            iElem++; nelem_triangle_bound++; break;
-          case QUADRILATERAL:
-            bound[iMarker][iElem] = new CQuadrilateral(connectivity[0],
-                                                       connectivity[1],
-                                                       connectivity[2],
-                                                       connectivity[3],3);
-            iElem++; nelem_quad_bound++; break;
-        }
+      /*--- Instantiate the boundary element object. ---*/
 
+      switch(vtk_type) {
+        case LINE:
+          bound[iMarker][iElem] = new CLine(connectivity[0],
+                                            connectivity[1],2);
+          iElem++; nelem_edge_bound++; break;
+        case TRIANGLE:
+          bound[iMarker][iElem] = new CTriangle(connectivity[0],
+                                                connectivity[1],
+                                                connectivity[2],3);
+          iElem++; nelem_triangle_bound++; break;
+        case QUADRILATERAL:
+          bound[iMarker][iElem] = new CQuadrilateral(connectivity[0],
+                                                     connectivity[1],
+                                                     connectivity[2],
+                                                     connectivity[3],3);
+          iElem++; nelem_quad_bound++; break;
       }
 
-      /*--- Update config file lists in order to store the boundary
-       information for this marker in the correct place. ---*/
+    }
 
-      Tag_to_Marker[config->GetMarker_CfgFile_TagBound(Marker_Tag)] = Marker_Tag;
-      config->SetMarker_All_TagBound(iMarker, Marker_Tag);
-      config->SetMarker_All_KindBC(iMarker, config->GetMarker_CfgFile_KindBC(Marker_Tag));
-      config->SetMarker_All_Monitoring(iMarker, config->GetMarker_CfgFile_Monitoring(Marker_Tag));
-      config->SetMarker_All_GeoEval(iMarker, config->GetMarker_CfgFile_GeoEval(Marker_Tag));
-      config->SetMarker_All_Designing(iMarker, config->GetMarker_CfgFile_Designing(Marker_Tag));
-      config->SetMarker_All_Plotting(iMarker, config->GetMarker_CfgFile_Plotting(Marker_Tag));
-      config->SetMarker_All_Analyze(iMarker, config->GetMarker_CfgFile_Analyze(Marker_Tag));
-      config->SetMarker_All_ZoneInterface(iMarker, config->GetMarker_CfgFile_ZoneInterface(Marker_Tag));
-      config->SetMarker_All_DV(iMarker, config->GetMarker_CfgFile_DV(Marker_Tag));
-      config->SetMarker_All_Moving(iMarker, config->GetMarker_CfgFile_Moving(Marker_Tag));
-      config->SetMarker_All_Deform_Mesh(iMarker, config->GetMarker_CfgFile_Deform_Mesh(Marker_Tag));
-      config->SetMarker_All_Fluid_Load(iMarker, config->GetMarker_CfgFile_Fluid_Load(Marker_Tag));
-      config->SetMarker_All_PyCustom(iMarker, config->GetMarker_CfgFile_PyCustom(Marker_Tag));
-      config->SetMarker_All_PerBound(iMarker, config->GetMarker_CfgFile_PerBound(Marker_Tag));
-      config->SetMarker_All_SendRecv(iMarker, NONE);
-      config->SetMarker_All_Turbomachinery(iMarker, config->GetMarker_CfgFile_Turbomachinery(Marker_Tag));
-      config->SetMarker_All_TurbomachineryFlag(iMarker, config->GetMarker_CfgFile_TurbomachineryFlag(Marker_Tag));
-      config->SetMarker_All_MixingPlaneInterface(iMarker, config->GetMarker_CfgFile_MixingPlaneInterface(Marker_Tag));
+    /*--- Update config file lists in order to store the boundary
+     information for this marker in the correct place. ---*/
+
+    if (rank != MASTER_NODE) continue;
+
+    Tag_to_Marker[config->GetMarker_CfgFile_TagBound(Marker_Tag)] = Marker_Tag;
+    config->SetMarker_All_TagBound(iMarker, Marker_Tag);
+    config->SetMarker_All_KindBC(iMarker, config->GetMarker_CfgFile_KindBC(Marker_Tag));
+    config->SetMarker_All_Monitoring(iMarker, config->GetMarker_CfgFile_Monitoring(Marker_Tag));
+    config->SetMarker_All_GeoEval(iMarker, config->GetMarker_CfgFile_GeoEval(Marker_Tag));
+    config->SetMarker_All_Designing(iMarker, config->GetMarker_CfgFile_Designing(Marker_Tag));
+    config->SetMarker_All_Plotting(iMarker, config->GetMarker_CfgFile_Plotting(Marker_Tag));
+    config->SetMarker_All_Analyze(iMarker, config->GetMarker_CfgFile_Analyze(Marker_Tag));
+    config->SetMarker_All_ZoneInterface(iMarker, config->GetMarker_CfgFile_ZoneInterface(Marker_Tag));
+    config->SetMarker_All_DV(iMarker, config->GetMarker_CfgFile_DV(Marker_Tag));
+    config->SetMarker_All_Moving(iMarker, config->GetMarker_CfgFile_Moving(Marker_Tag));
+    config->SetMarker_All_Deform_Mesh(iMarker, config->GetMarker_CfgFile_Deform_Mesh(Marker_Tag));
+    config->SetMarker_All_Fluid_Load(iMarker, config->GetMarker_CfgFile_Fluid_Load(Marker_Tag));
+    config->SetMarker_All_PyCustom(iMarker, config->GetMarker_CfgFile_PyCustom(Marker_Tag));
+    config->SetMarker_All_PerBound(iMarker, config->GetMarker_CfgFile_PerBound(Marker_Tag));
+    config->SetMarker_All_SendRecv(iMarker, NONE);
+    config->SetMarker_All_Turbomachinery(iMarker, config->GetMarker_CfgFile_Turbomachinery(Marker_Tag));
+    config->SetMarker_All_TurbomachineryFlag(iMarker, config->GetMarker_CfgFile_TurbomachineryFlag(Marker_Tag));
+    config->SetMarker_All_MixingPlaneInterface(iMarker, config->GetMarker_CfgFile_MixingPlaneInterface(Marker_Tag));
 
-    }
   }
 
 }
@@ -6363,9 +6398,6 @@ void CPhysicalGeometry::SetAvgTurboValue(CConfig *config, unsigned short val_iZo
   Normal           = new su2double[nDim];
 
   bool grid_movement        = config->GetGrid_Movement();
-#ifdef HAVE_MPI
-  su2double MyTotalArea, MyTotalRadius, *MyTotalTurboNormal= NULL, *MyTotalNormal= NULL, *MyTotalGridVel= NULL;
-#endif
 
   /*--- Intialization of the vector for the interested boundary ---*/
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
@@ -6448,29 +6480,27 @@ void CPhysicalGeometry::SetAvgTurboValue(CConfig *config, unsigned short val_iZo
 
 #ifdef HAVE_MPI
 
-    MyTotalArea            = TotalArea;                 TotalArea            = 0;
-    MyTotalRadius          = TotalRadius;               TotalRadius          = 0;
-    SU2_MPI::Allreduce(&MyTotalArea, &TotalArea, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalRadius, &TotalRadius, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    /*--- Reduce all the sums of the span in a single message. ---*/
 
-    MyTotalTurboNormal     = new su2double[nDim];
-    MyTotalNormal          = new su2double[nDim];
-    MyTotalGridVel         = new su2double[nDim];
+    su2double MyTotals[2+3*MAXNDIM], Totals[2+3*MAXNDIM];
 
+    MyTotals[0] = TotalArea;
+    MyTotals[1] = TotalRadius;
     for (iDim = 0; iDim < nDim; iDim++) {
-      MyTotalTurboNormal[iDim]	= TotalTurboNormal[iDim];
-      TotalTurboNormal[iDim]    = 0.0;
-      MyTotalNormal[iDim]       = TotalNormal[iDim];
-      TotalNormal[iDim]         = 0.0;
-      MyTotalGridVel[iDim]      = TotalGridVel[iDim];
-      TotalGridVel[iDim]        = 0.0;
+      MyTotals[2+iDim]        = TotalTurboNormal[iDim];
+      MyTotals[2+nDim+iDim]   = TotalNormal[iDim];
+      MyTotals[2+2*nDim+iDim] = TotalGridVel[iDim];
     }
 
-    SU2_MPI::Allreduce(MyTotalTurboNormal, TotalTurboNormal, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MyTotalNormal, TotalNormal, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MyTotalGridVel, TotalGridVel, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(MyTotals, Totals, 2+3*nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
-    delete [] MyTotalTurboNormal;delete [] MyTotalNormal; delete [] MyTotalGridVel;
+    TotalArea   = Totals[0];
+    TotalRadius = Totals[1];
+    for (iDim = 0; iDim < nDim; iDim++) {
+      TotalTurboNormal[iDim] = Totals[2+iDim];
+      TotalNormal[iDim]      = Totals[2+nDim+iDim];
+      TotalGridVel[iDim]     = Totals[2+2*nDim+iDim];
+    }
 
 #endif
 
@@ -8422,11 +8452,17 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
     nodes->SetColor(iPoint, 0);
 
   /*--- We need to have parallel support with MPI and have the ParMETIS
-   library compiled and linked for parallel graph partitioning. ---*/
+   library compiled and linked for parallel graph partitioning. Otherwise,
+   (or if requested) the points are partitioned geometrically. ---*/
 
 #ifdef HAVE_MPI
+
+  bool useParMETIS = false;
+
 #ifdef HAVE_PARMETIS
 
+  useParMETIS = (config->GetKind_Partitioner() == PARMETIS_PARTITIONER);
+
   MPI_Comm comm = MPI_COMM_WORLD;
 
   /*--- Linear partitioner object to help prepare parmetis data. ---*/
@@ -8435,7 +8471,7 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
 
   /*--- Only call ParMETIS if we have more than one rank to avoid errors ---*/
 
-  if (size > SINGLE_NODE) {
+  if (useParMETIS && (size > SINGLE_NODE)) {
 
     /*--- Create some structures that ParMETIS needs for partitioning. ---*/
 
@@ -8502,8 +8538,88 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
 
   if (xadj      != NULL) delete [] xadj;
   if (adjacency != NULL) delete [] adjacency;
+  xadj = nullptr; adjacency = nullptr;
+
+#endif
+
+  /*--- Partition along a Hilbert space-filling curve, this only needs the
+   coordinates of the linearly partitioned points. ---*/
+
+  if (!useParMETIS && (size > SINGLE_NODE)) {
+
+    vector<passivedouble> coord(nPoint*nDim);
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        coord[iPoint*nDim+iDim] = SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim));
+
+    if (rank == MASTER_NODE) cout << "Partitioning along a Hilbert space-filling curve...";
+
+    CGeometricPartitioner sfcPartitioner(nDim, size, MPI_COMM_WORLD);
+    const auto part = sfcPartitioner.Partition(nPoint, coord.data());
+
+    if (rank == MASTER_NODE) cout << " geometric partitioning complete." << endl;
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      nodes->SetColor(iPoint, part[iPoint]);
+
+  }
 
 #endif
+
+}
+
+void CPhysicalGeometry::SetColorGrid_Prescribed(CConfig *config, const vector<unsigned long> &globalIndex,
+                                                const vector<unsigned long> &color) {
+
+  /*--- Initialize the color vector ---*/
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    nodes->SetColor(iPoint, 0);
+
+#ifdef HAVE_MPI
+
+  /*--- The adjacency structure is not needed for prescribed colors. ---*/
+
+#ifdef HAVE_PARMETIS
+  if (xadj      != NULL) delete [] xadj;
+  if (adjacency != NULL) delete [] adjacency;
+  xadj = nullptr; adjacency = nullptr;
+#endif
+
+  /*--- Send the (global index, color) pairs to the ranks that own the
+   points in the linear partitioning of the grid. ---*/
+
+  CLinearPartitioner pointPartitioner(Global_nPointDomain,0);
+  const unsigned long firstIndex = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  vector<int> nPoint_Send(size,0), nPoint_Recv(size,0);
+
+  for (auto iGlobal : globalIndex)
+    nPoint_Send[pointPartitioner.GetRankContainingIndex(iGlobal)] += 2;
+
+  SU2_MPI::Alltoall(nPoint_Send.data(), 1, MPI_INT, nPoint_Recv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  vector<int> sendDispl(size+1,0), recvDispl(size+1,0);
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDispl[iRank+1] = sendDispl[iRank] + nPoint_Send[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nPoint_Recv[iRank];
+  }
+
+  vector<unsigned long> sendBuf(sendDispl[size]), recvBuf(recvDispl[size]);
+  vector<int> counter(sendDispl.begin(), sendDispl.end()-1);
+
+  for (unsigned long i = 0; i < globalIndex.size(); i++) {
+    const auto iRank = pointPartitioner.GetRankContainingIndex(globalIndex[i]);
+    sendBuf[counter[iRank]++] = globalIndex[i];
+    sendBuf[counter[iRank]++] = color[i];
+  }
+
+  SU2_MPI::Alltoallv(sendBuf.data(), nPoint_Send.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                     recvBuf.data(), nPoint_Recv.data(), recvDispl.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  for (int i = 0; i < recvDispl[size]; i += 2)
+    nodes->SetColor(recvBuf[i]-firstIndex, recvBuf[i+1]);
+
 #endif
 
 }
@@ -9108,30 +9224,44 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
 
     Restart_Data = new passivedouble[nFields*GetnPointDomain()];
 
-    /*--- Read in the data for the restart at all local points. ---*/
+    if (Restart_Vars[3] == CRestartDataCodec::FORMAT_VERSION) {
 
-    ret = fread(Restart_Data, sizeof(passivedouble), nFields*GetnPointDomain(), fhw);
-    if (ret != (unsigned long)nFields*GetnPointDomain()) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      /*--- Decode the data of all points (mixed precision and/or compressed),
+       encoded files do not carry the metadata. ---*/
+
+      vector<unsigned long> points(GetnPointDomain());
+      for (unsigned long iPoint = 0; iPoint < points.size(); iPoint++) points[iPoint] = iPoint;
+
+      CRestartDataCodec::Read(fhw, nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char),
+                              Restart_Vars[4], nFields, Restart_Vars[2], points, Restart_Data);
     }
+    else {
 
-    /*--- Compute (negative) displacements and grab the metadata. ---*/
+      /*--- Read in the data for the restart at all local points. ---*/
 
-    ret = sizeof(int) + 8*sizeof(passivedouble);
-    fseek(fhw,-ret, SEEK_END);
+      ret = fread(Restart_Data, sizeof(passivedouble), nFields*GetnPointDomain(), fhw);
+      if (ret != (unsigned long)nFields*GetnPointDomain()) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
 
-    /*--- Read the external iteration. ---*/
+      /*--- Compute (negative) displacements and grab the metadata. ---*/
 
-    ret = fread(&Restart_Iter, sizeof(int), 1, fhw);
-    if (ret != 1) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-    }
+      ret = sizeof(int) + 8*sizeof(passivedouble);
+      fseek(fhw,-ret, SEEK_END);
 
-    /*--- Read the metadata. ---*/
+      /*--- Read the external iteration. ---*/
 
-    ret = fread(Restart_Meta_Passive, sizeof(passivedouble), 8, fhw);
-    if (ret != 8) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      ret = fread(&Restart_Iter, sizeof(int), 1, fhw);
+      if (ret != 1) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
+
+      /*--- Read the metadata. ---*/
+
+      ret = fread(Restart_Meta_Passive, sizeof(passivedouble), 8, fhw);
+      if (ret != 8) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
     }
 
     /*--- Close the file. ---*/
@@ -9221,69 +9351,85 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
 
     delete [] mpi_str_buf;
 
-    /*--- We're writing only su2doubles in the data portion of the file. ---*/
-
-    etype = MPI_DOUBLE;
+    /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
-    /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
-     along with the string names of the variables. ---*/
+    Restart_Data = new passivedouble[nFields*GetnPointDomain()];
 
-    disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
+    if (Restart_Vars[3] == CRestartDataCodec::FORMAT_VERSION) {
 
-    /*--- Define a derived datatype for this rank's set of non-contiguous data
-     that will be placed in the restart. Here, we are collecting each one of the
-     points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
+      /*--- Encoded data (mixed precision and/or compressed), every rank decodes the
+       records or blocks that contain its points. Encoded files do not carry the metadata. ---*/
 
-    int *blocklen = new int[GetnPointDomain()];
-    MPI_Aint *displace = new MPI_Aint[GetnPointDomain()];
+      const auto points = GetDomainGlobalIndices();
 
-    counter = 0;
-    for (iPoint_Global = 0; iPoint_Global < GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      if (GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-        blocklen[counter] = nFields;
-        displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
-        counter++;
-      }
+      CRestartDataCodec::Read(fhw, nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char),
+                              Restart_Vars[4], nFields, Restart_Vars[2], points, Restart_Data);
     }
-    MPI_Type_create_hindexed(GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
-    MPI_Type_commit(&filetype);
+    else {
 
-    /*--- Set the view for the MPI file write, i.e., describe the location in
-     the file that this rank "sees" for writing its piece of the restart file. ---*/
+      /*--- We're writing only su2doubles in the data portion of the file. ---*/
 
-    MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
+      etype = MPI_DOUBLE;
 
-    /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+      /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
+       along with the string names of the variables. ---*/
 
-    Restart_Data = new passivedouble[nFields*GetnPointDomain()];
+      disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
 
-    /*--- Collective call for all ranks to read from their view simultaneously. ---*/
+      /*--- Define a derived datatype for this rank's set of non-contiguous data
+       that will be placed in the restart. Here, we are collecting each one of the
+       points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
 
-    MPI_File_read_all(fhw, Restart_Data, nFields*GetnPointDomain(), MPI_DOUBLE, &status);
+      int *blocklen = new int[GetnPointDomain()];
+      MPI_Aint *displace = new MPI_Aint[GetnPointDomain()];
 
-    /*--- Free the derived datatype. ---*/
+      counter = 0;
+      for (iPoint_Global = 0; iPoint_Global < GetGlobal_nPointDomain(); iPoint_Global++ ) {
+        if (GetGlobal_to_Local_Point(iPoint_Global) > -1) {
+          blocklen[counter] = nFields;
+          displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
+          counter++;
+        }
+      }
+      MPI_Type_create_hindexed(GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
+      MPI_Type_commit(&filetype);
 
-    MPI_Type_free(&filetype);
+      /*--- Set the view for the MPI file write, i.e., describe the location in
+       the file that this rank "sees" for writing its piece of the restart file. ---*/
 
-    /*--- Reset the file view before writing the metadata. ---*/
+      MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
 
-    MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
+      /*--- Collective call for all ranks to read from their view simultaneously. ---*/
 
-    /*--- Access the metadata. ---*/
+      MPI_File_read_all(fhw, Restart_Data, nFields*GetnPointDomain(), MPI_DOUBLE, &status);
 
-    if (rank == MASTER_NODE) {
+      /*--- Free the derived datatype and release temp memory. ---*/
+
+      MPI_Type_free(&filetype);
+
+      delete [] blocklen;
+      delete [] displace;
+
+      /*--- Reset the file view before writing the metadata. ---*/
 
-      /*--- External iteration. ---*/
-      disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
-              nFields*Restart_Vars[2]*sizeof(passivedouble));
-      MPI_File_read_at(fhw, disp, &Restart_Iter, 1, MPI_INT, MPI_STATUS_IGNORE);
+      MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
 
-      /*--- Additional doubles for AoA, AoS, etc. ---*/
+      /*--- Access the metadata. ---*/
 
-      disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
-              nFields*Restart_Vars[2]*sizeof(passivedouble) + 1*sizeof(int));
-      MPI_File_read_at(fhw, disp, Restart_Meta_Passive, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
+      if (rank == MASTER_NODE) {
 
+        /*--- External iteration. ---*/
+        disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
+                nFields*Restart_Vars[2]*sizeof(passivedouble));
+        MPI_File_read_at(fhw, disp, &Restart_Iter, 1, MPI_INT, MPI_STATUS_IGNORE);
+
+        /*--- Additional doubles for AoA, AoS, etc. ---*/
+
+        disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
+                nFields*Restart_Vars[2]*sizeof(passivedouble) + 1*sizeof(int));
+        MPI_File_read_at(fhw, disp, Restart_Meta_Passive, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
+
+      }
     }
 
     /*--- Communicate metadata. ---*/
@@ -9302,9 +9448,6 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
 
     MPI_File_close(&fhw);
 
-    delete [] blocklen;
-    delete [] displace;
-
 #endif
 
     std::vector<string>::iterator itx = std::find(config->fields.begin(), config->fields.end(), "Sensitivity_x");
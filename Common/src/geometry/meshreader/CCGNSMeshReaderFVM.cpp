@@ -54,8 +54,9 @@ CCGNSMeshReaderFVM::CCGNSMeshReaderFVM(CConfig        *val_config,
    treat the interior and boundary elements with separate routines.
    If we have found that this is a boundary section (we assume
    that internal cells and boundary cells do not exist in the same
-   section together), the master node reads the boundary section.
-   Otherwise, all ranks read and communicate the interior sections. ---*/
+   section together), all ranks read a chunk of the boundary section and
+   send the elements to the owners of their first node. Otherwise, all
+   ranks read and communicate the interior sections. ---*/
   ReadCGNSSectionMetadata();
   numberOfMarkers = 0;
   for (int s = 0; s < nSections; s++) {
@@ -809,140 +810,149 @@ void CCGNSMeshReaderFVM::ReadCGNSVolumeSection(int val_section) {
 
 void CCGNSMeshReaderFVM::ReadCGNSSurfaceSection(int val_section) {
   
-  /*--- In this routine, we access a CGNS surface section and have the
-   master rank load all of the surface conn. This can help avoid issues
-   where there are fewer elements than ranks on a surface. This is later
-   linearly partitioned. A limitation of this approach is that there
-   could be a memory bottleneck for extremely large grids, but this has
-   not been reached yet in practice. In that event, we can also read these
-   surface sections with a linear partitioning. ---*/
+  /*--- In this routine, each rank reads a linear chunk of a CGNS surface
+   section with the partial reads of the CGNS API, as for the interior
+   sections. The elements are then sent to the rank that owns the first
+   node of each element in the linear partitioning of the points, so that
+   every surface element is stored by exactly one rank and no rank needs
+   to hold an entire section. ---*/
   
-  int nbndry, parent_flag, npe;
+  int nbndry, parent_flag, npe = 0, vtk_type;
   unsigned long iElem = 0, iNode = 0;
-  cgsize_t startE, endE, ElementDataSize;
+  cgsize_t startE, endE;
   ElementType_t elemType;
   char sectionName[CGNS_STRING_SIZE];
   
+  /*--- Read the section info again ---*/
+  
+  if (cg_section_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
+                      sectionName, &elemType, &startE, &endE, &nbndry,
+                      &parent_flag))
+    cg_error_exit();
+  
+  /*--- Print some information to the console. ---*/
+  
   if (rank == MASTER_NODE) {
-    
-    /*--- Allocate some memory for the handling the connectivity
-     and auxiliary data that we are need to communicate. ---*/
-    
-    vector<cgsize_t> connElemCGNS(nElems[val_section]*SU2_CONN_SIZE,0);
-    vector<unsigned short> elemTypes(nElems[val_section],0);
-    vector<unsigned short> nPoinPerElem(nElems[val_section],0);
-    vector<unsigned long>  elemGlobalID(nElems[val_section],0);
-    
-    /*--- Read the section info again ---*/
-    
-    if (cg_section_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
-                        sectionName, &elemType, &startE, &endE, &nbndry,
-                        &parent_flag))
-      cg_error_exit();
-    
-    /*--- Print some information to the console. ---*/
-    
     cout << "Loading surface section " << string(sectionName);
     cout <<  " from file." << endl;
-    
-    /*--- Store the number of elems (all on the master). ---*/
-    
-    nElems[val_section] = (endE-startE+1);
-    
-    /*--- Read and store the total amount of data that will be
-     listed when reading this section. ---*/
-    
-    if (cg_ElementDataSize(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
-                           &ElementDataSize))
+  }
+  
+  /*--- Compute the element linear partitioning of this section. ---*/
+  
+  unsigned long element_count = (endE-startE+1);
+  CLinearPartitioner elementPartitioner(element_count,startE,true);
+  
+  const unsigned long nElemRead = elementPartitioner.GetSizeOnRank(rank);
+  const cgsize_t firstE = (cgsize_t)elementPartitioner.GetFirstIndexOnRank(rank);
+  const cgsize_t lastE  = (cgsize_t)elementPartitioner.GetLastIndexOnRank(rank);
+  
+  const bool isPoly = (elemType == MIXED || elemType == NGON_n || elemType == NFACE_n);
+  
+  /*--- Determine the size needed for our chunk, allocate the memory and
+   read it. Only call the CGNS API if we have a non-zero number of elements. ---*/
+  
+  cgsize_t sizeNeeded = 0;
+  if (nElemRead > 0) {
+    if (cg_ElementPartialSize(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
+                              firstE, lastE, &sizeNeeded) != CG_OK)
       cg_error_exit();
-    
-    /*--- Find the number of nodes required to represent
-     this type of element. ---*/
-    
-    if (cg_npe(elemType, &npe)) cg_error_exit();
-    
-    /*--- Check whether the sections contains a mixture of multiple
-     element types, which will require special handling to get the
-     element type one-by-one when reading. ---*/
-    
-    bool isMixed = false;
-    if (elemType == MIXED) {
-      isMixed = true;
-    }
-    
-    /*--- Allocate memory for accessing the connectivity and to
-     store it in the proper data structure for post-processing. ---*/
-    
-    vector<cgsize_t> connElemTemp(ElementDataSize,0);
-    
-    /*--- Retrieve the connectivity information and store. ---*/
-    
-    if (elemType == MIXED || elemType == NGON_n || elemType == NFACE_n) {
-      vector<cgsize_t> connOffsetTemp(nElems[val_section]+1, 0);
-      if (cg_poly_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone,
-                                        val_section+1, startE, endE,
-                                        connElemTemp.data(),
-                                        connOffsetTemp.data(), NULL) != CG_OK)
+  }
+  
+  vector<cgsize_t> connElemCGNS(sizeNeeded,0);
+  vector<cgsize_t> connOffsetCGNS(isPoly? nElemRead+1 : 0, 0);
+  
+  if (nElemRead > 0) {
+    if (isPoly) {
+      if (cg_poly_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
+                                        firstE, lastE, connElemCGNS.data(),
+                                        connOffsetCGNS.data(), NULL) != CG_OK)
         cg_error_exit();
     } else {
-      if (cg_elements_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
-                           connElemTemp.data(), NULL))
+      if (cg_elements_partial_read(cgnsFileID, cgnsBase, cgnsZone, val_section+1,
+                                   firstE, lastE, connElemCGNS.data(), NULL) != CG_OK)
         cg_error_exit();
     }
+  }
+  vector<cgsize_t>().swap(connOffsetCGNS);
+  
+  /*--- Load the surface element connectivity into the SU2 data
+   structure with format: [globalID VTK n1 n2 n3 n4 n5 n6 n7 n8].
+   We do not need a global ID for the surface elements, so we
+   simply set that to zero to maintain the same data structure
+   format as the interior elements. Note that we subtract 1 to
+   move from the CGNS 1-based indexing to SU2's zero-based. While
+   doing so, find the rank that will store each element. ---*/
+  
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+  
+  vector<unsigned long> connElemTemp(nElemRead*SU2_CONN_SIZE,0);
+  vector<int> elemRank(nElemRead), nElem_Send(size,0);
+  
+  if ((elemType != MIXED) && (nElemRead > 0)) {
+    if (cg_npe(elemType, &npe)) cg_error_exit();
+  }
+  
+  unsigned long counterCGNS = 0;
+  for (iElem = 0; iElem < nElemRead; iElem++) {
     
-    /*--- Allocate the memory for the data structure used to carry
-     the connectivity for this section. ---*/
+    ElementType_t iElemType = elemType;
     
-    connElems[val_section].resize(nElems[val_section]*SU2_CONN_SIZE,0);
+    /*--- If we have a mixed element section, we need to check the elem
+     type one-by-one. We also must manually advance the counter. ---*/
     
-    unsigned long counterCGNS = 0;
-    for (iElem = 0; iElem < nElems[val_section]; iElem++) {
-      
-      ElementType_t iElemType = elemType;
-      
-      /*--- If we have a mixed element section, we need to check the elem
-       type one-by-one. We also must manually advance the counter. ---*/
-      
-      if (isMixed) {
-        iElemType = ElementType_t(connElemTemp[counterCGNS]);
-        counterCGNS++;
-      }
-      
-      /*--- Get the VTK type for this element. ---*/
-      
-      int vtk_type;
-      string elem_name = GetCGNSElementType(iElemType, vtk_type);
-      
-      /*--- Get the number of nodes per element. ---*/
-      
+    if (elemType == MIXED) {
+      iElemType = ElementType_t(connElemCGNS[counterCGNS]);
+      counterCGNS++;
       cg_npe(iElemType, &npe);
-      
-      /*--- Load the surface element connectivity into the SU2 data
-       structure with format: [globalID VTK n1 n2 n3 n4 n5 n6 n7 n8].
-       We do not need a global ID for the surface elements, so we
-       simply set that to zero to maintain the same data structure
-       format as the interior elements. Note that we subtract 1 to
-       move from the CGNS 1-based indexing to SU2's zero-based. ---*/
-      
-      connElems[val_section][iElem*SU2_CONN_SIZE+0] = 0;
-      connElems[val_section][iElem*SU2_CONN_SIZE+1] = vtk_type;
-      for (iNode = 0; iNode < (unsigned long)npe; iNode++) {
-        unsigned long nn = iElem*SU2_CONN_SIZE+SU2_CONN_SKIP+iNode;
-        connElems[val_section][nn] = connElemTemp[counterCGNS] - 1;
-        counterCGNS++;
-      }
-      
     }
     
-  } else {
+    GetCGNSElementType(iElemType, vtk_type);
     
-    /*--- We are not the master, so we resize to zero for safety. ---*/
+    unsigned long *conn = &connElemTemp[iElem*SU2_CONN_SIZE];
+    conn[1] = vtk_type;
+    for (iNode = 0; iNode < (unsigned long)npe; iNode++) {
+      conn[SU2_CONN_SKIP+iNode] = connElemCGNS[counterCGNS] - 1;
+      counterCGNS++;
+    }
     
-    nElems[val_section] = 0;
-    connElems[val_section].resize(0);
+    elemRank[iElem] = pointPartitioner.GetRankContainingIndex(conn[SU2_CONN_SKIP]);
+    nElem_Send[elemRank[iElem]]++;
     
   }
   
+  vector<cgsize_t>().swap(connElemCGNS);
+  
+  /*--- Communicate the number of elements and then the elements. ---*/
+  
+  vector<int> nElem_Recv(size), sendCount(size), sendDisp(size+1,0), recvCount(size), recvDisp(size+1,0);
+  
+  SU2_MPI::Alltoall(nElem_Send.data(), 1, MPI_INT, nElem_Recv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  
+  for (int iProcessor = 0; iProcessor < size; iProcessor++) {
+    sendCount[iProcessor] = nElem_Send[iProcessor]*SU2_CONN_SIZE;
+    recvCount[iProcessor] = nElem_Recv[iProcessor]*SU2_CONN_SIZE;
+    sendDisp[iProcessor+1] = sendDisp[iProcessor] + sendCount[iProcessor];
+    recvDisp[iProcessor+1] = recvDisp[iProcessor] + recvCount[iProcessor];
+  }
+  
+  vector<unsigned long> connSend(sendDisp[size]), connRecv(recvDisp[size]);
+  vector<int> index(sendDisp.begin(), sendDisp.end()-1);
+  
+  for (iElem = 0; iElem < nElemRead; iElem++) {
+    copy_n(&connElemTemp[iElem*SU2_CONN_SIZE], SU2_CONN_SIZE, &connSend[index[elemRank[iElem]]]);
+    index[elemRank[iElem]] += SU2_CONN_SIZE;
+  }
+  vector<unsigned long>().swap(connElemTemp);
+  
+  SU2_MPI::Alltoallv(connSend.data(), sendCount.data(), sendDisp.data(), MPI_UNSIGNED_LONG,
+                     connRecv.data(), recvCount.data(), recvDisp.data(), MPI_UNSIGNED_LONG,
+                     MPI_COMM_WORLD);
+  
+  /*--- Store the elements of this rank for the current section. ---*/
+  
+  nElems[val_section] = recvDisp[size]/SU2_CONN_SIZE;
+  connElems[val_section].assign(connRecv.begin(), connRecv.end());
+  
 }
 
 void CCGNSMeshReaderFVM::ReformatCGNSVolumeConnectivity() {
@@ -994,20 +1004,18 @@ void CCGNSMeshReaderFVM::ReformatCGNSSurfaceConnectivity() {
                        Marker_Tag.end());
       markerNames[markerCount] = Marker_Tag;
       
-      /*--- The master node alone stores the connectivity. ---*/
+      /*--- Each rank stores the connectivity of the elements it owns. ---*/
       
-      if (rank == MASTER_NODE) {
-        surfaceElementConnectivity[markerCount].resize(nElems[s]*SU2_CONN_SIZE);
-        elementCount = 0;
-        for (unsigned long iElem = 0; iElem < nElems[s]; iElem++) {
-          for (unsigned long iNode = 0; iNode < SU2_CONN_SIZE; iNode++) {
-            unsigned long nn = iElem*SU2_CONN_SIZE+iNode;
-            surfaceElementConnectivity[markerCount][elementCount] = (unsigned long)connElems[s][nn];
-            elementCount++;
-          }
+      surfaceElementConnectivity[markerCount].resize(nElems[s]*SU2_CONN_SIZE);
+      elementCount = 0;
+      for (unsigned long iElem = 0; iElem < nElems[s]; iElem++) {
+        for (unsigned long iNode = 0; iNode < SU2_CONN_SIZE; iNode++) {
+          unsigned long nn = iElem*SU2_CONN_SIZE+iNode;
+          surfaceElementConnectivity[markerCount][elementCount] = (unsigned long)connElems[s][nn];
+          elementCount++;
         }
-        vector<cgsize_t>().swap(connElems[s]);
       }
+      vector<cgsize_t>().swap(connElems[s]);
       markerCount++;
     }
   }
@@ -26,6 +26,7 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../../include/geometry/meshreader/CMeshReaderFVM.hpp"
 
 CMeshReaderFVM::CMeshReaderFVM(CConfig        *val_config,
@@ -56,3 +57,68 @@ CMeshReaderFVM::CMeshReaderFVM(CConfig        *val_config,
 }
 
 CMeshReaderFVM::~CMeshReaderFVM(void) { }
+
+void CMeshReaderFVM::DistributeVolumeElements(const vector<unsigned long>& connElems) {
+  
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+  
+  const unsigned long nElemRead = connElems.size() / SU2_CONN_SIZE;
+  
+  /*--- Count the elements going to each rank, each element is sent once to
+   every rank that owns at least one of its nodes, hence the flag. ---*/
+  
+  vector<int> nSend(size, 0), flag(size, -1);
+  
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    const unsigned long *conn = &connElems[iElem*SU2_CONN_SIZE];
+    const unsigned short nNodes = GetNumberOfNodes(conn[1]);
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      const int iRank = pointPartitioner.GetRankContainingIndex(conn[SU2_CONN_SKIP+iNode]);
+      if (flag[iRank] != (int)iElem) { flag[iRank] = iElem; nSend[iRank]++; }
+    }
+  }
+  
+  /*--- Load the send buffer, grouped by destination rank. ---*/
+  
+  vector<int> sendCount(size), sendDisp(size+1, 0);
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendCount[iRank] = nSend[iRank]*SU2_CONN_SIZE;
+    sendDisp[iRank+1] = sendDisp[iRank] + sendCount[iRank];
+  }
+  
+  vector<unsigned long> sendBuf(sendDisp[size]);
+  vector<int> index(sendDisp.begin(), sendDisp.end()-1);
+  flag.assign(size, -1);
+  
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    const unsigned long *conn = &connElems[iElem*SU2_CONN_SIZE];
+    const unsigned short nNodes = GetNumberOfNodes(conn[1]);
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+      const int iRank = pointPartitioner.GetRankContainingIndex(conn[SU2_CONN_SKIP+iNode]);
+      if (flag[iRank] == (int)iElem) continue;
+      flag[iRank] = iElem;
+      copy_n(conn, SU2_CONN_SIZE, &sendBuf[index[iRank]]);
+      index[iRank] += SU2_CONN_SIZE;
+    }
+  }
+  
+  /*--- Exchange the counts and then the elements. ---*/
+  
+  vector<int> nRecv(size), recvCount(size), recvDisp(size+1, 0);
+  
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  
+  for (int iRank = 0; iRank < size; iRank++) {
+    recvCount[iRank] = nRecv[iRank]*SU2_CONN_SIZE;
+    recvDisp[iRank+1] = recvDisp[iRank] + recvCount[iRank];
+  }
+  
+  localVolumeElementConnectivity.resize(recvDisp[size]);
+  
+  SU2_MPI::Alltoallv(sendBuf.data(), sendCount.data(), sendDisp.data(), MPI_UNSIGNED_LONG,
+                     localVolumeElementConnectivity.data(), recvCount.data(), recvDisp.data(),
+                     MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  
+  numberOfLocalElements = recvDisp[size] / SU2_CONN_SIZE;
+  
+}
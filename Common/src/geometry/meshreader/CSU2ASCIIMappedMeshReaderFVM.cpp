@@ -0,0 +1,642 @@
+/*!
+ * \file CSU2ASCIIMappedMeshReaderFVM.cpp
+ * \brief Reads a native SU2 ASCII grid into linear partitions for the
+ *        finite volume solver (FVM), by memory mapping the file.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2ASCIIMappedMeshReaderFVM.hpp"
+#include "../../../include/omp_structure.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <numeric>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SU2_MMAP_FILE
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/*!
+ * \class CSU2ASCIIMappedMeshReaderFVM::CMappedFile
+ * \brief Read-only view of an entire file, memory mapped when the platform allows it,
+ *        otherwise the file is loaded into a buffer.
+ */
+class CSU2ASCIIMappedMeshReaderFVM::CMappedFile {
+private:
+  const char* data = nullptr;  /*!< \brief Start of the file contents. */
+  uint64_t nBytes = 0;         /*!< \brief Size of the file. */
+
+#ifdef SU2_MMAP_FILE
+  void* map = MAP_FAILED;
+#else
+  vector<char> buffer;
+#endif
+
+public:
+  explicit CMappedFile(const string& filename) {
+
+    bool fail = true;
+#ifdef SU2_MMAP_FILE
+    const int fd = open(filename.c_str(), O_RDONLY);
+    struct stat info;
+    if ((fd >= 0) && (fstat(fd, &info) == 0) && (info.st_size > 0)) {
+      nBytes = info.st_size;
+      map = mmap(nullptr, nBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+      fail = (map == MAP_FAILED);
+      if (!fail) data = static_cast<const char*>(map);
+    }
+    if (fd >= 0) close(fd);
+#else
+    FILE *fhw = fopen(filename.c_str(), "rb");
+    if (fhw) {
+      fseek(fhw, 0, SEEK_END);
+      buffer.resize(ftell(fhw));
+      fseek(fhw, 0, SEEK_SET);
+      fail = buffer.empty() || (fread(buffer.data(), 1, buffer.size(), fhw) != buffer.size());
+      fclose(fhw);
+      data = buffer.data();
+      nBytes = buffer.size();
+    }
+#endif
+    if (fail) {
+      SU2_MPI::Error(string("Error opening SU2 ASCII grid.") +
+                     string(" \n Check that the file exists."), CURRENT_FUNCTION);
+    }
+  }
+
+  ~CMappedFile() {
+#ifdef SU2_MMAP_FILE
+    if (map != MAP_FAILED) munmap(map, nBytes);
+#endif
+  }
+
+  CMappedFile(const CMappedFile&) = delete;
+  CMappedFile& operator=(const CMappedFile&) = delete;
+
+  inline const char* begin() const { return data; }
+  inline const char* end() const { return data + nBytes; }
+};
+
+namespace {
+
+/*--- Helpers to walk the lines of a byte range, and parse their contents. ---*/
+
+inline const char* EndOfLine(const char* p, const char* end) {
+  const void* eol = memchr(p, '\n', end-p);
+  return eol? static_cast<const char*>(eol) : end;
+}
+
+inline const char* NextLine(const char* p, const char* end) {
+  const char* eol = EndOfLine(p, end);
+  return (eol < end)? eol+1 : end;
+}
+
+/*!
+ * \brief Find a keyword anywhere in a line (like the line based reader does).
+ * \param[out] value - Position after the keyword.
+ */
+inline bool FindKeyword(const char* p, const char* eol, const char* key, const char*& value) {
+  const size_t len = strlen(key);
+  const char* pos = search(p, eol, key, key+len);
+  if (pos == eol) return false;
+  value = pos + len;
+  return true;
+}
+
+inline void SkipBlanks(const char*& p, const char* eol) {
+  while ((p < eol) && ((*p == ' ') || (*p == '\t') || (*p == '\r'))) ++p;
+}
+
+inline bool ParseUnsigned(const char*& p, const char* eol, unsigned long& value) {
+  SkipBlanks(p, eol);
+  const char* start = p;
+  unsigned long v = 0;
+  for (; (p < eol) && (static_cast<unsigned>(*p - '0') < 10u); ++p) v = 10*v + (*p - '0');
+  value = v;
+  return (p != start);
+}
+
+/*!
+ * \brief Parse a floating point number. Mantissas of up to 19 digits (below 2^53) with decimal
+ *        exponents up to 22 are exact in double precision, those are converted with a single
+ *        (correctly rounded) product or division, other numbers go through strtod.
+ */
+inline bool ParseDouble(const char*& p, const char* eol, passivedouble& value) {
+
+  static const passivedouble pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  SkipBlanks(p, eol);
+  const char* start = p;
+
+  bool negative = false;
+  if ((p < eol) && ((*p == '-') || (*p == '+'))) negative = (*p++ == '-');
+
+  uint64_t mantissa = 0;
+  int nDigits = 0, exponent = 0;
+  bool exact = true, anyDigit = false;
+
+  for (; (p < eol) && (static_cast<unsigned>(*p - '0') < 10u); ++p) {
+    anyDigit = true;
+    if (nDigits < 19) { mantissa = 10*mantissa + (*p - '0'); nDigits += (mantissa != 0); }
+    else { exact = false; }
+  }
+  if ((p < eol) && (*p == '.')) {
+    for (++p; (p < eol) && (static_cast<unsigned>(*p - '0') < 10u); ++p) {
+      anyDigit = true;
+      if (nDigits < 19) { mantissa = 10*mantissa + (*p - '0'); nDigits += (mantissa != 0); --exponent; }
+      else { exact = false; }
+    }
+  }
+  if (!anyDigit) return false;
+
+  if ((p < eol) && ((*p == 'e') || (*p == 'E'))) {
+    ++p;
+    bool negativeExp = false;
+    if ((p < eol) && ((*p == '-') || (*p == '+'))) negativeExp = (*p++ == '-');
+    if ((p == eol) || (static_cast<unsigned>(*p - '0') >= 10u)) return false;
+    int e = 0;
+    for (; (p < eol) && (static_cast<unsigned>(*p - '0') < 10u); ++p) e = min(10*e + (*p - '0'), 100000);
+    exponent += negativeExp? -e : e;
+  }
+
+  if (exact && (mantissa <= (uint64_t(1) << 53)) && (exponent >= -22) && (exponent <= 22)) {
+    value = (exponent < 0)? passivedouble(mantissa) / pow10[-exponent] : passivedouble(mantissa) * pow10[exponent];
+    if (negative) value = -value;
+  }
+  else {
+    value = strtod(string(start, p).c_str(), nullptr);
+  }
+  return true;
+}
+
+/*!
+ * \brief Skip the lines of a section, storing the byte offsets at which the linear partitions start.
+ * \return Position after the section, nullptr if the file ends before.
+ */
+const char* ScanSection(const char* begin, const char* p, const char* end, unsigned long nLines,
+                        int nRank, vector<unsigned long>& offsets) {
+
+  CLinearPartitioner partitioner(nLines,0);
+  offsets.resize(nRank+1);
+
+  unsigned long iLine = 0;
+  for (int iRank = 0; iRank <= nRank; ++iRank) {
+    const unsigned long first = (iRank < nRank)? partitioner.GetFirstIndexOnRank(iRank) : nLines;
+    for (; iLine < first; ++iLine) {
+      if (p == end) return nullptr;
+      p = NextLine(p, end);
+    }
+    offsets[iRank] = p - begin;
+  }
+  return p;
+}
+
+/*!
+ * \brief Skip the marker sections (to keep scanning the zone after them).
+ * \return Position after the markers, nullptr if they are not well formed.
+ */
+const char* SkipMarkers(const char* p, const char* end, unsigned long nMarker) {
+
+  const char* value = nullptr;
+  for (unsigned long iMarker = 0; iMarker < nMarker; ++iMarker) {
+    p = NextLine(p, end);
+    const char* eol = EndOfLine(p, end);
+    unsigned long nElem = 0;
+    if (!FindKeyword(p, eol, "MARKER_ELEMS=", value) || !ParseUnsigned(value, eol, nElem)) return nullptr;
+    p = NextLine(p, end);
+    for (unsigned long iElem = 0; iElem < nElem; ++iElem) {
+      if (p == end) return nullptr;
+      p = NextLine(p, end);
+    }
+  }
+  return p;
+}
+
+/*!
+ * \brief Parse the nLines lines of [begin, end) in parallel, with parseLine(iLine, lineBegin, lineEnd).
+ * \note The range is split in chunks that start at a line, the lines of each chunk are counted first
+ *       to know the index of the first line of the chunks.
+ * \return False if the number of lines does not match or parseLine returns false for some line.
+ */
+template<class ParseLineFunc>
+bool ParseLines(const char* begin, const char* end, unsigned long nLines, const ParseLineFunc& parseLine) {
+
+  const uint64_t minChunkBytes = 1<<20;
+  const uint64_t nBytes = end - begin;
+  const int nChunk = max<int>(1, min<uint64_t>(4*omp_get_max_threads(), nBytes/minChunkBytes));
+
+  vector<const char*> chunk(nChunk+1, end);
+  chunk[0] = begin;
+  for (int iChunk = 1; iChunk < nChunk; ++iChunk) {
+    const char* p = max(begin + nBytes*iChunk/nChunk, chunk[iChunk-1]);
+    if ((p > begin) && (p[-1] != '\n')) p = NextLine(p, end);
+    chunk[iChunk] = p;
+  }
+
+  vector<unsigned long> firstLine(nChunk+1, 0);
+
+  SU2_OMP_PARALLEL_(for schedule(static,1))
+  for (int iChunk = 0; iChunk < nChunk; ++iChunk) {
+    const char *b = chunk[iChunk], *e = chunk[iChunk+1];
+    firstLine[iChunk+1] = count(b, e, '\n') + ((e > b) && (e[-1] != '\n'));
+  }
+  partial_sum(firstLine.begin(), firstLine.end(), firstLine.begin());
+
+  if (firstLine[nChunk] != nLines) return false;
+
+  bool ok = true;
+
+  SU2_OMP_PARALLEL_(for schedule(dynamic,1) reduction(&&:ok))
+  for (int iChunk = 0; iChunk < nChunk; ++iChunk) {
+    unsigned long iLine = firstLine[iChunk];
+    for (const char* p = chunk[iChunk]; p < chunk[iChunk+1]; ++iLine) {
+      const char* eol = EndOfLine(p, chunk[iChunk+1]);
+      ok = parseLine(iLine, p, eol) && ok;
+      p = (eol < chunk[iChunk+1])? eol+1 : eol;
+    }
+  }
+  return ok;
+}
+
+}
+
+CSU2ASCIIMappedMeshReaderFVM::CSU2ASCIIMappedMeshReaderFVM(CConfig        *val_config,
+                                                           unsigned short val_iZone,
+                                                           unsigned short val_nZone)
+: CMeshReaderFVM(val_config, val_iZone, val_nZone) {
+
+  /* Store the current zone to be read and the total number of zones. */
+  myZone = val_iZone;
+  nZones = val_nZone;
+
+  meshFilename = config->GetMesh_FileName();
+
+  /* All ranks map the file, each one only touches its own part. */
+  CMappedFile file(meshFilename);
+
+  /* Find the sections and read the basic metadata, then read and store the
+   points and interior elements on our rank's linear partition, the master
+   stores the entire set of surface connectivity. */
+  ReadMetadata(file);
+  ReadPointCoordinates(file);
+  ReadVolumeElementConnectivity(file);
+  ReadSurfaceElementConnectivity(file);
+
+}
+
+CSU2ASCIIMappedMeshReaderFVM::~CSU2ASCIIMappedMeshReaderFVM(void) { }
+
+bool CSU2ASCIIMappedMeshReaderFVM::CanRead(const CConfig *val_config) {
+
+  /*--- Same condition used by CSU2ASCIIMeshReaderFVM to split actuator disks. ---*/
+
+  const bool actuator_disk = (((val_config->GetnMarker_ActDiskInlet() != 0) ||
+                               (val_config->GetnMarker_ActDiskOutlet() != 0)) &&
+                              ((val_config->GetKind_SU2() == SU2_CFD) ||
+                               ((val_config->GetKind_SU2() == SU2_DEF) &&
+                                (val_config->GetActDisk_SU2_DEF()))) &&
+                              !val_config->GetActDisk_DoubleSurface());
+
+  return val_config->GetMesh_Mapped_Read() && !actuator_disk;
+}
+
+void CSU2ASCIIMappedMeshReaderFVM::ReadMetadata(const CMappedFile& file) {
+
+  const bool harmonic_balance = config->GetTime_Marching() == HARMONIC_BALANCE;
+  const bool multizone_file = config->GetMultizone_Mesh();
+
+  /*--- The master scans the file once, skipping over the data sections (only
+   their line breaks are located) while storing the offsets at which the linear
+   partitions of each rank start, and then broadcasts the metadata. ---*/
+
+  enum {FOUND_NDIME = 1, FOUND_NPOIN = 2, FOUND_NELEM = 4, FOUND_NMARK = 8};
+
+  unsigned long metadata[6] = {0};
+  passivedouble angleOffsets[2] = {0.0, 0.0};
+
+  pointOffset.resize(size+1);
+  elemOffset.resize(size+1);
+
+  if (rank == MASTER_NODE) {
+
+    const char *begin = file.begin(), *end = file.end(), *p = begin, *value = nullptr;
+
+    /*--- If more than one, find the current zone in the mesh file. ---*/
+
+    if ((nZones > 1 && multizone_file) || harmonic_balance) {
+      if (harmonic_balance) {
+        cout << "Reading time instance " << config->GetiInst()+1 << "." << endl;
+      } else {
+        bool foundZone = false;
+        for (; (p < end) && !foundZone; p = NextLine(p, end)) {
+          const char* eol = EndOfLine(p, end);
+          unsigned long jZone = 0;
+          if (FindKeyword(p, eol, "IZONE=", value) && ParseUnsigned(value, eol, jZone))
+            foundZone = (jZone == myZone+1ul);
+        }
+        if (!foundZone) {
+          SU2_MPI::Error(string("Could not find the IZONE= keyword or the zone contents.") +
+                         string(" \n Check the SU2 ASCII file format."),
+                         CURRENT_FUNCTION);
+        }
+        cout << "Reading zone " << myZone << " from native SU2 ASCII mesh." << endl;
+      }
+    }
+
+    unsigned long nDim = 0, nPoint = 0, nElem = 0, nMarker = 0, found = 0;
+
+    while (p < end) {
+
+      const char* eol = EndOfLine(p, end);
+      const char* next = (eol < end)? eol+1 : end;
+
+      if (FindKeyword(p, eol, "NDIME=", value)) {
+        ParseUnsigned(value, eol, nDim);
+        found |= FOUND_NDIME;
+      }
+
+      if (FindKeyword(p, eol, "AOA_OFFSET=", value)) ParseDouble(value, eol, angleOffsets[0]);
+      if (FindKeyword(p, eol, "AOS_OFFSET=", value)) ParseDouble(value, eol, angleOffsets[1]);
+
+      if (FindKeyword(p, eol, "NPOIN=", value)) {
+        ParseUnsigned(value, eol, nPoint);
+        next = ScanSection(begin, next, end, nPoint, size, pointOffset);
+        if (next == nullptr) {
+          SU2_MPI::Error(string("The file ends before the NPOIN= points.") +
+                         string(" \n Check the SU2 ASCII file format."), CURRENT_FUNCTION);
+        }
+        found |= FOUND_NPOIN;
+      }
+
+      if (FindKeyword(p, eol, "NELEM=", value)) {
+        ParseUnsigned(value, eol, nElem);
+        next = ScanSection(begin, next, end, nElem, size, elemOffset);
+        if (next == nullptr) {
+          SU2_MPI::Error(string("The file ends before the NELEM= elements.") +
+                         string(" \n Check the SU2 ASCII file format."), CURRENT_FUNCTION);
+        }
+        found |= FOUND_NELEM;
+      }
+
+      if (FindKeyword(p, eol, "NMARK=", value)) {
+        ParseUnsigned(value, eol, nMarker);
+        markerOffset = next - begin;
+        next = SkipMarkers(next, end, nMarker);
+        if (next == nullptr) {
+          SU2_MPI::Error(string("Could not read the NMARK= markers.") +
+                         string(" \n Check the SU2 ASCII file format."), CURRENT_FUNCTION);
+        }
+        found |= FOUND_NMARK;
+      }
+
+      /*--- Error check for the deprecated periodic BC format. ---*/
+
+      if (FindKeyword(p, eol, "NPERIODIC=", value)) {
+        unsigned long nPeriodic = 0;
+        ParseUnsigned(value, eol, nPeriodic);
+        if (nPeriodic != 1)
+          SU2_MPI::Error(string("Mesh file contains deprecated periodic format!\n\n") +
+                         string("For SU2 v7.0.0 and later, preprocessing of periodic grids by SU2_MSH\n") +
+                         string("is no longer necessary. Please use the original mesh file (prior to SU2_MSH)\n") +
+                         string("with the same MARKER_PERIODIC definition in the configuration file.") , CURRENT_FUNCTION);
+      }
+
+      /* Stop before we reach the next zone then check for errors below. */
+      if (FindKeyword(p, eol, "IZONE=", value)) break;
+
+      p = next;
+    }
+
+    /* Throw an error if any of the keywords was not found. */
+    if (!(found & FOUND_NDIME)) {
+      SU2_MPI::Error(string("Could not find NDIME= keyword.") +
+                     string(" \n Check the SU2 ASCII file format."),
+                     CURRENT_FUNCTION);
+    }
+    if (!(found & FOUND_NPOIN)) {
+      SU2_MPI::Error(string("Could not find NPOIN= keyword.") +
+                     string(" \n Check the SU2 ASCII file format."),
+                     CURRENT_FUNCTION);
+    }
+    if (!(found & FOUND_NELEM)) {
+      SU2_MPI::Error(string("Could not find NELEM= keyword.") +
+                     string(" \n Check the SU2 ASCII file format."),
+                     CURRENT_FUNCTION);
+    }
+    if (!(found & FOUND_NMARK)) {
+      SU2_MPI::Error(string("Could not find NMARK= keyword.") +
+                     string(" \n Check the SU2 ASCII file format."),
+                     CURRENT_FUNCTION);
+    }
+
+    metadata[0] = nDim;    metadata[1] = nPoint;
+    metadata[2] = nElem;   metadata[3] = nMarker;
+    metadata[4] = markerOffset;
+  }
+
+  SU2_MPI::Bcast(metadata, 6, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(angleOffsets, 2, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(pointOffset.data(), size+1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(elemOffset.data(), size+1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+
+  dimension              = metadata[0];
+  numberOfGlobalPoints   = metadata[1];
+  numberOfGlobalElements = metadata[2];
+  numberOfMarkers        = metadata[3];
+  markerOffset           = metadata[4];
+
+  /*--- Apply the angle of attack and sideslip offsets (in deg). ---*/
+
+  const su2double AoA_Offset = angleOffsets[0];
+  const su2double AoS_Offset = angleOffsets[1];
+
+  if (config->GetDiscard_InFiles() == false) {
+    const su2double AoA_Current = config->GetAoA() + AoA_Offset;
+    const su2double AoS_Current = config->GetAoS() + AoS_Offset;
+
+    if ((rank == MASTER_NODE) && (AoA_Offset != 0.0)) {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
+      cout << "         AoA offset in mesh file (" << AoA_Offset << " deg.) = " << AoA_Current << " deg." << endl;
+    }
+    if ((rank == MASTER_NODE) && (AoS_Offset != 0.0)) {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
+      cout << "         AoS offset in mesh file (" << AoS_Offset << " deg.) = " << AoS_Current << " deg." << endl;
+    }
+    if (AoA_Offset != 0.0) { config->SetAoA_Offset(AoA_Offset); config->SetAoA(AoA_Current); }
+    if (AoS_Offset != 0.0) { config->SetAoS_Offset(AoS_Offset); config->SetAoS(AoS_Current); }
+  }
+  else {
+    if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))
+      cout <<"WARNING: Discarding the AoA offset in the geometry file." << endl;
+    if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))
+      cout <<"WARNING: Discarding the AoS offset in the geometry file." << endl;
+  }
+
+}
+
+void CSU2ASCIIMappedMeshReaderFVM::ReadPointCoordinates(const CMappedFile& file) {
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+
+  localPointCoordinates.assign(dimension, vector<passivedouble>(numberOfLocalPoints));
+
+  /*--- Parse the lines of our linear partition, extra columns (the
+   legacy global index of the point) are ignored. ---*/
+
+  auto& coords = localPointCoordinates;
+  const unsigned short nDim = dimension;
+
+  const bool ok = ParseLines(file.begin()+pointOffset[rank], file.begin()+pointOffset[rank+1], numberOfLocalPoints,
+    [&coords, nDim](unsigned long iPoint, const char* p, const char* eol) {
+      bool ok = true;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) ok = ok && ParseDouble(p, eol, coords[iDim][iPoint]);
+      return ok;
+    });
+
+  if (!ok) {
+    SU2_MPI::Error(string("Invalid line in the NPOIN= section.") +
+                   string(" \n Check the SU2 ASCII file format."), CURRENT_FUNCTION);
+  }
+
+}
+
+void CSU2ASCIIMappedMeshReaderFVM::ReadVolumeElementConnectivity(const CMappedFile& file) {
+
+  /*--- Parse the elements of our linear partition in the format
+   [globalID vtkType n0 ... n7], they are then sent to all the ranks
+   that own one of their points (i.e., there will be element redundancy
+   like in the line based reader). ---*/
+
+  CLinearPartitioner elemPartitioner(numberOfGlobalElements,0);
+  const unsigned long firstElem = elemPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long nElemRead = elemPartitioner.GetSizeOnRank(rank);
+  const unsigned long nPoint = numberOfGlobalPoints;
+
+  vector<unsigned long> connElems(nElemRead*SU2_CONN_SIZE, 0);
+
+  const bool ok = ParseLines(file.begin()+elemOffset[rank], file.begin()+elemOffset[rank+1], nElemRead,
+    [&connElems, firstElem, nPoint](unsigned long iElem, const char* p, const char* eol) {
+      unsigned long* conn = &connElems[iElem*SU2_CONN_SIZE];
+      conn[0] = firstElem + iElem;
+      if (!ParseUnsigned(p, eol, conn[1])) return false;
+      const unsigned short nNodes = GetNumberOfNodes(conn[1]);
+      if (nNodes == 0) return false;
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+        unsigned long& node = conn[SU2_CONN_SKIP+iNode];
+        if (!ParseUnsigned(p, eol, node) || (node >= nPoint)) return false;
+      }
+      return true;
+    });
+
+  if (!ok) {
+    SU2_MPI::Error(string("Invalid element in the NELEM= section.") +
+                   string(" \n Check the SU2 ASCII file format."), CURRENT_FUNCTION);
+  }
+
+  DistributeVolumeElements(connElems);
+
+}
+
+void CSU2ASCIIMappedMeshReaderFVM::ReadSurfaceElementConnectivity(const CMappedFile& file) {
+
+  /* We already read in the number of markers with the metadata. */
+  surfaceElementConnectivity.resize(numberOfMarkers);
+  markerNames.resize(numberOfMarkers);
+
+  /*--- The surface connectivity is handled by the master node
+   (and eventually distributed by the master as well). ---*/
+
+  if (rank != MASTER_NODE) return;
+
+  const char *p = file.begin()+markerOffset, *end = file.end(), *value = nullptr;
+
+  for (unsigned long iMarker = 0; iMarker < numberOfMarkers; iMarker++) {
+
+    const char* eol = EndOfLine(p, end);
+    if (!FindKeyword(p, eol, "MARKER_TAG=", value)) {
+      SU2_MPI::Error(string("Could not find the MARKER_TAG= keyword.") +
+                     string(" \n Check the SU2 ASCII file format."), CURRENT_FUNCTION);
+    }
+    string& tag = markerNames[iMarker];
+    for (; value < eol; ++value)
+      if ((*value != ' ') && (*value != '\t') && (*value != '\r')) tag += *value;
+
+    /*--- Throw an error if we find deprecated references to SEND_RECEIVE
+     boundaries in the mesh. ---*/
+    if (tag == "SEND_RECEIVE") {
+      SU2_MPI::Error(string("Mesh file contains deprecated SEND_RECEIVE marker!\n\n") +
+                     string("Please remove any SEND_RECEIVE markers from the SU2 ASCII mesh."),
+                     CURRENT_FUNCTION);
+    }
+
+    p = NextLine(p, end);
+    eol = EndOfLine(p, end);
+    unsigned long nElem_Bound = 0;
+    if (!FindKeyword(p, eol, "MARKER_ELEMS=", value) || !ParseUnsigned(value, eol, nElem_Bound)) {
+      SU2_MPI::Error(string("Could not read the MARKER_ELEMS= keyword of marker ") + tag +
+                     string(".\n Check the SU2 ASCII file format."), CURRENT_FUNCTION);
+    }
+    p = NextLine(p, end);
+
+    auto& conn = surfaceElementConnectivity[iMarker];
+    conn.assign(nElem_Bound*SU2_CONN_SIZE, 0);
+
+    for (unsigned long iElem = 0; iElem < nElem_Bound; iElem++) {
+
+      eol = EndOfLine(p, end);
+      unsigned long* elem = &conn[iElem*SU2_CONN_SIZE];
+
+      bool ok = ParseUnsigned(p, eol, elem[1]);
+      const unsigned long VTK_Type = elem[1];
+      ok = ok && ((VTK_Type == LINE) || (VTK_Type == TRIANGLE) || (VTK_Type == QUADRILATERAL));
+      if (!ok) {
+        SU2_MPI::Error(string("Invalid boundary element of marker ") + tag +
+                       string(".\n Check the SU2 ASCII file format."), CURRENT_FUNCTION);
+      }
+      if ((VTK_Type == LINE) && (dimension == 3)) {
+        SU2_MPI::Error(string("Line boundary conditions are not possible for 3D calculations.") +
+                       string("Please check the SU2 ASCII mesh file."), CURRENT_FUNCTION);
+      }
+      for (unsigned short iNode = 0; iNode < GetNumberOfNodes(VTK_Type); iNode++) {
+        unsigned long& node = elem[SU2_CONN_SKIP+iNode];
+        if (!ParseUnsigned(p, eol, node) || (node >= numberOfGlobalPoints)) {
+          SU2_MPI::Error(string("Invalid boundary element of marker ") + tag +
+                         string(".\n Check the SU2 ASCII file format."), CURRENT_FUNCTION);
+        }
+      }
+
+      p = NextLine(p, end);
+    }
+  }
+
+}
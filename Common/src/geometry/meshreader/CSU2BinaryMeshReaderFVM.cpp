@@ -0,0 +1,596 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.cpp
+ * \brief Reads a native SU2 binary grid into linear partitions for the
+ *        finite volume solver (FVM), and writes such grids.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+#include "../../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
+#include "../../../include/geometry/meshreader/CSU2ASCIIMappedMeshReaderFVM.hpp"
+#include "../../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
+
+#include <cstdio>
+#include <algorithm>
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM::CFile
+ * \brief Reads and writes at explicit offsets of a file, with MPI-IO when available.
+ * \note The "All" versions are collective, large requests are split in chunks and all
+ *       ranks perform the same number of calls.
+ */
+class CSU2BinaryMeshReaderFVM::CFile {
+private:
+  static constexpr uint64_t maxChunk = uint64_t(1) << 30;  /*!< \brief Max bytes per call. */
+
+#ifdef HAVE_MPI
+  MPI_File fh;
+#else
+  FILE *fh = nullptr;
+#endif
+
+  /*!
+   * \brief Number of chunks needed by the largest request of all ranks.
+   */
+  static unsigned long NumChunks(uint64_t nBytes) {
+    unsigned long nChunk = (nBytes + maxChunk - 1) / maxChunk, nChunkMax = nChunk;
+    SU2_MPI::Allreduce(&nChunk, &nChunkMax, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+    return nChunkMax;
+  }
+
+public:
+  CFile(const string& filename, bool write) {
+#ifdef HAVE_MPI
+    const int mode = write? (MPI_MODE_WRONLY | MPI_MODE_CREATE) : MPI_MODE_RDONLY;
+    if (write && (SU2_MPI::GetRank() == MASTER_NODE)) MPI_File_delete(filename.c_str(), MPI_INFO_NULL);
+    if (write) SU2_MPI::Barrier(MPI_COMM_WORLD);
+    const int ierr = MPI_File_open(MPI_COMM_WORLD, filename.c_str(), mode, MPI_INFO_NULL, &fh);
+    if (ierr) fh = MPI_FILE_NULL;
+    const bool fail = (fh == MPI_FILE_NULL);
+#else
+    fh = fopen(filename.c_str(), write? "wb" : "rb");
+    const bool fail = (fh == nullptr);
+#endif
+    if (fail) {
+      SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + filename, CURRENT_FUNCTION);
+    }
+  }
+
+  ~CFile() {
+#ifdef HAVE_MPI
+    MPI_File_close(&fh);
+#else
+    fclose(fh);
+#endif
+  }
+
+  CFile(const CFile&) = delete;
+  CFile& operator=(const CFile&) = delete;
+
+  /*!
+   * \brief Independent read of nBytes at offset.
+   */
+  void ReadAt(uint64_t offset, uint64_t nBytes, void* buf) {
+    char* ptr = static_cast<char*>(buf);
+    for (uint64_t done = 0; done < nBytes; ) {
+      const uint64_t n = min(nBytes-done, maxChunk);
+#ifdef HAVE_MPI
+      SU2_MPI::Status status;
+      MPI_File_read_at(fh, MPI_Offset(offset+done), ptr+done, int(n), MPI_BYTE, &status);
+      int count = 0;
+      MPI_Get_count(&status, MPI_BYTE, &count);
+      const bool fail = (uint64_t(count) != n);
+#else
+      fseek(fh, long(offset+done), SEEK_SET);
+      const bool fail = (fread(ptr+done, 1, n, fh) != n);
+#endif
+      if (fail) SU2_MPI::Error("Unexpected end of the SU2 binary mesh file.", CURRENT_FUNCTION);
+      done += n;
+    }
+  }
+
+  /*!
+   * \brief Independent write of nBytes at offset.
+   */
+  void WriteAt(uint64_t offset, uint64_t nBytes, const void* buf) {
+    const char* ptr = static_cast<const char*>(buf);
+    for (uint64_t done = 0; done < nBytes; ) {
+      const uint64_t n = min(nBytes-done, maxChunk);
+#ifdef HAVE_MPI
+      MPI_File_write_at(fh, MPI_Offset(offset+done), const_cast<char*>(ptr+done), int(n), MPI_BYTE, MPI_STATUS_IGNORE);
+#else
+      fseek(fh, long(offset+done), SEEK_SET);
+      fwrite(ptr+done, 1, n, fh);
+#endif
+      done += n;
+    }
+  }
+
+  /*!
+   * \brief Collective read of nBytes at offset (each rank with its own offset and size).
+   */
+  void ReadAtAll(uint64_t offset, uint64_t nBytes, void* buf) {
+#ifdef HAVE_MPI
+    char* ptr = static_cast<char*>(buf);
+    const auto nChunk = NumChunks(nBytes);
+    uint64_t done = 0;
+    for (unsigned long iChunk = 0; iChunk < nChunk; ++iChunk) {
+      const uint64_t n = min(nBytes-done, maxChunk);
+      SU2_MPI::Status status;
+      MPI_File_read_at_all(fh, MPI_Offset(offset+done), ptr+done, int(n), MPI_BYTE, &status);
+      int count = 0;
+      MPI_Get_count(&status, MPI_BYTE, &count);
+      if (uint64_t(count) != n) SU2_MPI::Error("Unexpected end of the SU2 binary mesh file.", CURRENT_FUNCTION);
+      done += n;
+    }
+#else
+    ReadAt(offset, nBytes, buf);
+#endif
+  }
+
+  /*!
+   * \brief Collective write of nBytes at offset (each rank with its own offset and size).
+   */
+  void WriteAtAll(uint64_t offset, uint64_t nBytes, const void* buf) {
+#ifdef HAVE_MPI
+    const char* ptr = static_cast<const char*>(buf);
+    const auto nChunk = NumChunks(nBytes);
+    uint64_t done = 0;
+    for (unsigned long iChunk = 0; iChunk < nChunk; ++iChunk) {
+      const uint64_t n = min(nBytes-done, maxChunk);
+      MPI_File_write_at_all(fh, MPI_Offset(offset+done), const_cast<char*>(ptr+done), int(n), MPI_BYTE, MPI_STATUS_IGNORE);
+      done += n;
+    }
+#else
+    WriteAt(offset, nBytes, buf);
+#endif
+  }
+};
+
+namespace {
+
+/*!
+ * \brief Exchange elements (SU2_CONN_SIZE entries each) according to the destination counts.
+ * \param[in] nSend - Number of elements sent to each rank.
+ * \param[in] sendBuf - Elements, grouped by destination rank.
+ * \return The received elements, grouped by source rank.
+ */
+vector<unsigned long> ExchangeElements(const vector<int>& nSend, vector<unsigned long>& sendBuf) {
+
+  const int size = SU2_MPI::GetSize();
+
+  vector<int> nRecv(size), sendCount(size), sendDisp(size+1, 0), recvCount(size), recvDisp(size+1, 0);
+
+  SU2_MPI::Alltoall(const_cast<int*>(nSend.data()), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    sendCount[iRank] = nSend[iRank]*SU2_CONN_SIZE;
+    recvCount[iRank] = nRecv[iRank]*SU2_CONN_SIZE;
+    sendDisp[iRank+1] = sendDisp[iRank] + sendCount[iRank];
+    recvDisp[iRank+1] = recvDisp[iRank] + recvCount[iRank];
+  }
+
+  vector<unsigned long> recvBuf(recvDisp[size]);
+
+  SU2_MPI::Alltoallv(sendBuf.data(), sendCount.data(), sendDisp.data(), MPI_UNSIGNED_LONG,
+                     recvBuf.data(), recvCount.data(), recvDisp.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  return recvBuf;
+}
+
+}
+
+CSU2BinaryMeshReaderFVM::CSU2BinaryMeshReaderFVM(CConfig        *val_config,
+                                                 unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+: CMeshReaderFVM(val_config, val_iZone, val_nZone) {
+
+  if ((val_nZone > 1) && config->GetMultizone_Mesh()) {
+    SU2_MPI::Error(string("SU2 binary meshes contain a single zone.\n") +
+                   string("Use one mesh file per zone (MULTIZONE_MESH= NO)."), CURRENT_FUNCTION);
+  }
+
+  /* Single surface actuator disks are split by the ASCII reader, the
+   split must be done before converting the mesh. */
+  const bool actuator_disk = (((config->GetnMarker_ActDiskInlet() != 0) ||
+                               (config->GetnMarker_ActDiskOutlet() != 0)) &&
+                              ((config->GetKind_SU2() == SU2_CFD) ||
+                               ((config->GetKind_SU2() == SU2_DEF) &&
+                                (config->GetActDisk_SU2_DEF()))) &&
+                              !config->GetActDisk_DoubleSurface());
+  if (actuator_disk) {
+    SU2_MPI::Error(string("Actuator disks cannot be split when reading SU2 binary meshes.\n") +
+                   string("Convert a mesh with double surfaces (ACTDISK_DOUBLE_SURFACE= YES)."), CURRENT_FUNCTION);
+  }
+
+  meshFilename = config->GetMesh_FileName();
+
+  CFile file(meshFilename, false);
+
+  /* Read the header, then the points and interior elements on our rank's
+   linear partition. The master reads the entire set of surface connectivity. */
+  ReadMetadata(file);
+  ReadPointCoordinates(file);
+  ReadVolumeElementConnectivity(file);
+  ReadSurfaceElementConnectivity(file);
+
+}
+
+CSU2BinaryMeshReaderFVM::~CSU2BinaryMeshReaderFVM(void) { }
+
+void CSU2BinaryMeshReaderFVM::ReadHeader(const string& val_filename, int64_t* header,
+                                         passivedouble* headerDouble) {
+
+  FILE *fhw = fopen(val_filename.c_str(), "rb");
+  if (!fhw) {
+    SU2_MPI::Error(string("The SU2 binary mesh file named ") + val_filename + string(" was not found."), CURRENT_FUNCTION);
+  }
+
+  passivedouble tmp[N_HEADER_DOUBLE];
+  if (headerDouble == nullptr) headerDouble = tmp;
+
+  bool fail = (fread(header, sizeof(int64_t), N_HEADER_INT, fhw) != size_t(N_HEADER_INT));
+  fail |= (fread(headerDouble, sizeof(passivedouble), N_HEADER_DOUBLE, fhw) != size_t(N_HEADER_DOUBLE));
+  fclose(fhw);
+
+  if (fail || (header[MAGIC_NUMBER] != SU2_BINARY_MESH_ID)) {
+    SU2_MPI::Error(val_filename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadMetadata(CFile& file) {
+
+  /*--- All ranks read the (small) header. ---*/
+
+  int64_t header[N_HEADER_INT];
+  passivedouble headerDouble[N_HEADER_DOUBLE];
+
+  file.ReadAtAll(0, sizeof(header), header);
+  file.ReadAtAll(sizeof(header), sizeof(headerDouble), headerDouble);
+
+  if (header[MAGIC_NUMBER] != SU2_BINARY_MESH_ID) {
+    SU2_MPI::Error(meshFilename + string(" is not an SU2 binary mesh file (or its byte order does not match).\n") +
+                   string("Set MESH_FORMAT to the format of the file."), CURRENT_FUNCTION);
+  }
+  if (header[VERSION] > SU2_BINARY_MESH_VERSION) {
+    SU2_MPI::Error(meshFilename + string(" was written by a newer version of SU2."), CURRENT_FUNCTION);
+  }
+
+  dimension              = header[NDIME];
+  numberOfGlobalPoints   = header[NPOIN];
+  numberOfGlobalElements = header[NELEM];
+  numberOfMarkers        = header[NMARK];
+
+  if ((dimension != 2) && (dimension != 3)) {
+    SU2_MPI::Error("Invalid dimension in the SU2 binary mesh file.", CURRENT_FUNCTION);
+  }
+
+  /*--- Apply the AoA and AoS offsets, as the ASCII reader does. ---*/
+
+  const su2double AoA_Offset = headerDouble[AOA_OFFSET];
+  const su2double AoS_Offset = headerDouble[AOS_OFFSET];
+
+  if (config->GetDiscard_InFiles() == false) {
+    const su2double AoA_Current = config->GetAoA() + AoA_Offset;
+    const su2double AoS_Current = config->GetAoS() + AoS_Offset;
+
+    if ((rank == MASTER_NODE) && (AoA_Offset != 0.0)) {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
+      cout << "         AoA offset in mesh file (" << AoA_Offset << " deg.) = " << AoA_Current << " deg." << endl;
+    }
+    if ((rank == MASTER_NODE) && (AoS_Offset != 0.0)) {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
+      cout << "         AoS offset in mesh file (" << AoS_Offset << " deg.) = " << AoS_Current << " deg." << endl;
+    }
+    if (AoA_Offset != 0.0) { config->SetAoA_Offset(AoA_Offset); config->SetAoA(AoA_Current); }
+    if (AoS_Offset != 0.0) { config->SetAoS_Offset(AoS_Offset); config->SetAoS(AoS_Current); }
+  }
+  else if ((rank == MASTER_NODE) && ((AoA_Offset != 0.0) || (AoS_Offset != 0.0))) {
+    cout <<"WARNING: Discarding the AoA and AoS offsets in the geometry file." << endl;
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadPointCoordinates(CFile& file) {
+
+  /*--- The points of our linear partition are contiguous in the file. ---*/
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+  const uint64_t firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  vector<passivedouble> coords(numberOfLocalPoints*dimension);
+
+  file.ReadAtAll(PointOffset() + firstPoint*dimension*sizeof(passivedouble),
+                 coords.size()*sizeof(passivedouble), coords.data());
+
+  /*--- Transpose into our data structure. ---*/
+
+  localPointCoordinates.resize(dimension);
+  for (int k = 0; k < dimension; k++) {
+    localPointCoordinates[k].resize(numberOfLocalPoints);
+    for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++)
+      localPointCoordinates[k][iPoint] = coords[iPoint*dimension+k];
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadVolumeElementConnectivity(CFile& file) {
+
+  /*--- Each rank reads a linear partition of the elements. ---*/
+
+  CLinearPartitioner elemPartitioner(numberOfGlobalElements,0);
+  const unsigned long nElemRead = elemPartitioner.GetSizeOnRank(rank);
+  const uint64_t firstElem = elemPartitioner.GetFirstIndexOnRank(rank);
+
+  vector<int64_t> records(nElemRead*VOL_RECORD);
+
+  file.ReadAtAll(ElemOffset(dimension, numberOfGlobalPoints) + firstElem*VOL_RECORD*sizeof(int64_t),
+                 records.size()*sizeof(int64_t), records.data());
+
+  /*--- Convert to the format [globalID vtkType n0 ... n7] and send every element to
+   the ranks owning one of its points (i.e. there will be element redundancy, like
+   in the other readers). ---*/
+
+  vector<unsigned long> connElems(nElemRead*SU2_CONN_SIZE, 0);
+
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    const int64_t* rec = &records[iElem*VOL_RECORD];
+    if (GetNumberOfNodes(rec[0]) == 0) {
+      SU2_MPI::Error("Unknown element type in the SU2 binary mesh file.", CURRENT_FUNCTION);
+    }
+    unsigned long* conn = &connElems[iElem*SU2_CONN_SIZE];
+    conn[0] = firstElem + iElem;
+    for (unsigned short i = 0; i < VOL_RECORD; i++) conn[1+i] = rec[i];
+  }
+
+  vector<int64_t>().swap(records);
+
+  DistributeVolumeElements(connElems);
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadSurfaceElementConnectivity(CFile& file) {
+
+  surfaceElementConnectivity.resize(numberOfMarkers);
+  markerNames.resize(numberOfMarkers);
+
+  /*--- The surface connectivity is handled by the master node, the
+   other ranks do not take part in this (non-collective) read. ---*/
+
+  if (rank != MASTER_NODE) return;
+
+  uint64_t offset = MarkerOffset(dimension, numberOfGlobalPoints, numberOfGlobalElements);
+
+  for (unsigned long iMarker = 0; iMarker < numberOfMarkers; iMarker++) {
+
+    char name[MARKER_NAME_SIZE+1] = {'\0'};
+    int64_t nElem_Bound = 0;
+
+    file.ReadAt(offset, MARKER_NAME_SIZE, name);
+    offset += MARKER_NAME_SIZE;
+    file.ReadAt(offset, sizeof(int64_t), &nElem_Bound);
+    offset += sizeof(int64_t);
+
+    markerNames[iMarker] = name;
+
+    vector<int64_t> records(nElem_Bound*SURF_RECORD);
+    file.ReadAt(offset, records.size()*sizeof(int64_t), records.data());
+    offset += records.size()*sizeof(int64_t);
+
+    auto& conn = surfaceElementConnectivity[iMarker];
+    conn.assign(nElem_Bound*SU2_CONN_SIZE, 0);
+
+    for (int64_t iElem = 0; iElem < nElem_Bound; iElem++) {
+      const int64_t* rec = &records[iElem*SURF_RECORD];
+      if ((rec[0] == LINE) && (dimension == 3)) {
+        SU2_MPI::Error(string("Line boundary conditions are not possible for 3D calculations.") +
+                       string("Please check the SU2 binary mesh file."), CURRENT_FUNCTION);
+      }
+      for (unsigned short i = 0; i < SURF_RECORD; i++)
+        conn[iElem*SU2_CONN_SIZE + 1 + i] = rec[i];
+    }
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::WriteMesh(const CConfig* val_config, const CMeshReaderFVM& mesh,
+                                        const string& val_filename) {
+
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+
+  const uint64_t nDim = mesh.GetDimension();
+  const uint64_t nPoint = mesh.GetNumberOfGlobalPoints();
+  const uint64_t nElem = mesh.GetNumberOfGlobalElements();
+  const unsigned long nMarker = mesh.GetNumberOfMarkers();
+
+  CFile file(val_filename, true);
+
+  /*--- Header. ---*/
+
+  if (rank == MASTER_NODE) {
+    int64_t header[N_HEADER_INT] = {0};
+    passivedouble headerDouble[N_HEADER_DOUBLE] = {0.0};
+
+    header[MAGIC_NUMBER] = SU2_BINARY_MESH_ID;
+    header[VERSION] = SU2_BINARY_MESH_VERSION;
+    header[NDIME] = nDim;
+    header[NPOIN] = nPoint;
+    header[NELEM] = nElem;
+    header[NMARK] = nMarker;
+    headerDouble[AOA_OFFSET] = SU2_TYPE::GetValue(val_config->GetAoA_Offset());
+    headerDouble[AOS_OFFSET] = SU2_TYPE::GetValue(val_config->GetAoS_Offset());
+
+    file.WriteAt(0, sizeof(header), header);
+    file.WriteAt(sizeof(header), sizeof(headerDouble), headerDouble);
+  }
+
+  /*--- Points, the reader holds our linear partition. ---*/
+
+  {
+    CLinearPartitioner pointPartitioner(nPoint,0);
+    const uint64_t firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+    const auto& gridCoords = mesh.GetLocalPointCoordinates();
+    const unsigned long nPointLocal = mesh.GetNumberOfLocalPoints();
+
+    vector<passivedouble> coords(nPointLocal*nDim);
+    for (unsigned long iPoint = 0; iPoint < nPointLocal; iPoint++)
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        coords[iPoint*nDim+iDim] = gridCoords[iDim][iPoint];
+
+    file.WriteAtAll(PointOffset() + firstPoint*nDim*sizeof(passivedouble),
+                    coords.size()*sizeof(passivedouble), coords.data());
+  }
+
+  /*--- Volume elements. Each element is held by all the ranks owning one of
+   its points, it is sent by the owner of its first point to the rank of the
+   linear partition of the elements that contains it. ---*/
+
+  {
+    CLinearPartitioner pointPartitioner(nPoint,0);
+    CLinearPartitioner elemPartitioner(nElem,0);
+
+    const auto& connLocal = mesh.GetLocalVolumeElementConnectivity();
+    const unsigned long nElemLocal = mesh.GetNumberOfLocalElements();
+
+    vector<int> nSend(size, 0);
+    vector<int> dest(nElemLocal, -1);
+
+    for (unsigned long iElem = 0; iElem < nElemLocal; iElem++) {
+      const unsigned long* conn = &connLocal[iElem*SU2_CONN_SIZE];
+      if ((int)pointPartitioner.GetRankContainingIndex(conn[SU2_CONN_SKIP]) != rank) continue;
+      dest[iElem] = elemPartitioner.GetRankContainingIndex(conn[0]);
+      nSend[dest[iElem]]++;
+    }
+
+    vector<unsigned long> index(size+1, 0);
+    for (int iRank = 0; iRank < size; iRank++) index[iRank+1] = index[iRank] + nSend[iRank]*SU2_CONN_SIZE;
+
+    vector<unsigned long> sendBuf(index[size]);
+    for (unsigned long iElem = 0; iElem < nElemLocal; iElem++) {
+      if (dest[iElem] < 0) continue;
+      copy_n(&connLocal[iElem*SU2_CONN_SIZE], SU2_CONN_SIZE, &sendBuf[index[dest[iElem]]]);
+      index[dest[iElem]] += SU2_CONN_SIZE;
+    }
+
+    const auto recvBuf = ExchangeElements(nSend, sendBuf);
+    vector<unsigned long>().swap(sendBuf);
+
+    const uint64_t firstElem = elemPartitioner.GetFirstIndexOnRank(rank);
+    const unsigned long nElemSlice = elemPartitioner.GetSizeOnRank(rank);
+
+    if (recvBuf.size() != nElemSlice*SU2_CONN_SIZE) {
+      SU2_MPI::Error("Inconsistent volume elements in the mesh to convert.", CURRENT_FUNCTION);
+    }
+
+    vector<int64_t> records(nElemSlice*VOL_RECORD, 0);
+    for (unsigned long iElem = 0; iElem < nElemSlice; iElem++) {
+      const unsigned long* conn = &recvBuf[iElem*SU2_CONN_SIZE];
+      int64_t* rec = &records[(conn[0]-firstElem)*VOL_RECORD];
+      for (unsigned short i = 0; i < VOL_RECORD; i++) rec[i] = conn[1+i];
+    }
+
+    file.WriteAtAll(ElemOffset(nDim, nPoint) + firstElem*VOL_RECORD*sizeof(int64_t),
+                    records.size()*sizeof(int64_t), records.data());
+  }
+
+  /*--- Markers, the surface elements may be held by any rank (each element by
+   exactly one), they are gathered on the master which writes them. ---*/
+
+  const auto& names = mesh.GetMarkerNames();
+  uint64_t offset = MarkerOffset(nDim, nPoint, nElem);
+
+  for (unsigned long iMarker = 0; iMarker < nMarker; iMarker++) {
+
+    const auto& conn = mesh.GetSurfaceElementConnectivityForMarker(iMarker);
+    const unsigned long nElemLocal = conn.size() / SU2_CONN_SIZE;
+
+    vector<unsigned long> sendBuf(nElemLocal*SURF_RECORD);
+    for (unsigned long iElem = 0; iElem < nElemLocal; iElem++)
+      for (unsigned short i = 0; i < SURF_RECORD; i++)
+        sendBuf[iElem*SURF_RECORD + i] = conn[iElem*SU2_CONN_SIZE + 1 + i];
+
+    vector<int> sendCount(size, 0), sendDisp(size, 0), recvCount(size, 0), recvDisp(size+1, 0);
+    sendCount[MASTER_NODE] = sendBuf.size();
+
+    SU2_MPI::Alltoall(sendCount.data(), 1, MPI_INT, recvCount.data(), 1, MPI_INT, MPI_COMM_WORLD);
+    for (int iRank = 0; iRank < size; iRank++) recvDisp[iRank+1] = recvDisp[iRank] + recvCount[iRank];
+
+    vector<unsigned long> recvBuf(recvDisp[size]);
+    SU2_MPI::Alltoallv(sendBuf.data(), sendCount.data(), sendDisp.data(), MPI_UNSIGNED_LONG,
+                       recvBuf.data(), recvCount.data(), recvDisp.data(), MPI_UNSIGNED_LONG,
+                       MPI_COMM_WORLD);
+
+    if (rank != MASTER_NODE) continue;
+
+    if (names[iMarker].size() > size_t(MARKER_NAME_SIZE)) {
+      SU2_MPI::Error(string("Marker tag ") + names[iMarker] + string(" is too long for the SU2 binary mesh format."),
+                     CURRENT_FUNCTION);
+    }
+    char name[MARKER_NAME_SIZE] = {'\0'};
+    copy(names[iMarker].begin(), names[iMarker].end(), name);
+
+    const int64_t nElem_Bound = recvBuf.size() / SURF_RECORD;
+    const vector<int64_t> records(recvBuf.begin(), recvBuf.end());
+
+    file.WriteAt(offset, MARKER_NAME_SIZE, name);
+    offset += MARKER_NAME_SIZE;
+    file.WriteAt(offset, sizeof(int64_t), &nElem_Bound);
+    offset += sizeof(int64_t);
+    file.WriteAt(offset, records.size()*sizeof(int64_t), records.data());
+    offset += records.size()*sizeof(int64_t);
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ConvertMesh(CConfig* val_config, unsigned short val_iZone,
+                                          unsigned short val_nZone, const string& val_filename) {
+
+  CMeshReaderFVM *mesh = nullptr;
+
+  switch (val_config->GetMesh_FileFormat()) {
+    case SU2:
+      if (CSU2ASCIIMappedMeshReaderFVM::CanRead(val_config))
+        mesh = new CSU2ASCIIMappedMeshReaderFVM(val_config, val_iZone, val_nZone);
+      else
+        mesh = new CSU2ASCIIMeshReaderFVM(val_config, val_iZone, val_nZone);
+      break;
+    case CGNS_GRID:
+      mesh = new CCGNSMeshReaderFVM(val_config, val_iZone, val_nZone);
+      break;
+    default:
+      SU2_MPI::Error("Only SU2 ASCII and CGNS meshes can be converted to the SU2 binary format.", CURRENT_FUNCTION);
+      break;
+  }
+
+  if (SU2_MPI::GetRank() == MASTER_NODE)
+    cout << "Writing SU2 binary mesh " << val_filename << "." << endl;
+
+  WriteMesh(val_config, *mesh, val_filename);
+
+  delete mesh;
+
+}
@@ -29,6 +29,8 @@
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 
+#include <numeric>
+
 
 CInterpolator::CInterpolator(CGeometry ****geometry_container, const CConfig* const* config,
                              unsigned int iZone, unsigned int jZone) :
@@ -110,6 +112,179 @@ void CInterpolator::Collect_VertexInfo(int markDonor, int markTarget,
                      Buffer_Receive_GlobalPoint, nBuffer_Point, MPI_LONG, MPI_COMM_WORLD);
 }
 
+void CInterpolator::Collect_OverlappingVertexInfo(int markDonor, int markTarget, unsigned short nDim,
+                                                  unsigned long nNeighbor, vector<su2double>& coord,
+                                                  vector<long>& globalPoint, vector<int>& proc) const {
+
+  const su2double inf = numeric_limits<passivedouble>::max();
+
+  /*--- Owned vertices and their bounding box (min, max), the box of an empty set is inverted. ---*/
+  auto OwnedVertices = [&](const CGeometry* geometry, int marker, vector<unsigned long>& points, su2double* box) {
+    for (auto iDim = 0u; iDim < nDim; iDim++) { box[iDim] = inf; box[nDim+iDim] = -inf; }
+    if (marker < 0) return;
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(marker); iVertex++) {
+      const auto iPoint = geometry->vertex[marker][iVertex]->GetNode();
+      if (!geometry->nodes->GetDomain(iPoint)) continue;
+      points.push_back(iPoint);
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        box[iDim] = min(box[iDim], geometry->nodes->GetCoord(iPoint, iDim));
+        box[nDim+iDim] = max(box[nDim+iDim], geometry->nodes->GetCoord(iPoint, iDim));
+      }
+    }
+  };
+
+  /*--- Exchange the target and donor boxes and the number of donors of each rank. ---*/
+  const auto nBox = 4*nDim;
+
+  vector<unsigned long> donorPoints, targetPoints;
+  vector<su2double> myBoxes(nBox), allBoxes(nBox*size);
+  OwnedVertices(target_geometry, markTarget, targetPoints, &myBoxes[0]);
+  OwnedVertices(donor_geometry, markDonor, donorPoints, &myBoxes[2*nDim]);
+
+  SU2_MPI::Allgather(myBoxes.data(), nBox, MPI_DOUBLE, allBoxes.data(), nBox, MPI_DOUBLE, MPI_COMM_WORLD);
+
+  unsigned long nDonorLocal = donorPoints.size();
+  vector<unsigned long> nDonorRank(size);
+  SU2_MPI::Allgather(&nDonorLocal, 1, MPI_UNSIGNED_LONG, nDonorRank.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  /*--- Halo of the targets of this rank. Any point of the target box is within the largest corner-to-corner
+   *    distance of every donor of a rank, the closest ranks that together own nNeighbor donors bound the
+   *    distance to the nNeighbor-th closest donor. ---*/
+  su2double radius = 0.0;
+
+  if (!targetPoints.empty() && nNeighbor > 0) {
+    const su2double* targetBox = &myBoxes[0];
+    vector<pair<su2double, unsigned long> > farDist;
+
+    for (int iRank = 0; iRank < size; iRank++) {
+      if (nDonorRank[iRank] == 0) continue;
+      const su2double* donorBox = &allBoxes[iRank*nBox + 2*nDim];
+      su2double dist2 = 0.0;
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        const su2double ds = max(targetBox[nDim+iDim] - donorBox[iDim], donorBox[nDim+iDim] - targetBox[iDim]);
+        dist2 += ds*ds;
+      }
+      farDist.emplace_back(dist2, nDonorRank[iRank]);
+    }
+    sort(farDist.begin(), farDist.end());
+
+    unsigned long nFound = 0;
+    for (const auto& rankDist : farDist) {
+      nFound += rankDist.second;
+      radius = max(radius, sqrt(rankDist.first));
+      if (nFound >= nNeighbor) break;
+    }
+  }
+
+  /*--- Guard against round-off in the box tests. ---*/
+  radius *= 1.0 + 1e-6;
+
+  vector<su2double> allRadius(size);
+  SU2_MPI::Allgather(&radius, 1, MPI_DOUBLE, allRadius.data(), 1, MPI_DOUBLE, MPI_COMM_WORLD);
+
+  /*--- Owned donors inside the grown target box of each rank. ---*/
+  vector<vector<unsigned long> > sendPoints(size);
+  vector<int> nSend(size, 0), nRecv(size, 0);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    const su2double* targetBox = &allBoxes[iRank*nBox];
+    const su2double* donorBox = &myBoxes[2*nDim];
+
+    bool overlap = !donorPoints.empty();
+    for (auto iDim = 0u; iDim < nDim && overlap; iDim++)
+      overlap = (targetBox[iDim] <= targetBox[nDim+iDim]) &&
+                (donorBox[iDim] <= targetBox[nDim+iDim] + allRadius[iRank]) &&
+                (donorBox[nDim+iDim] >= targetBox[iDim] - allRadius[iRank]);
+    if (!overlap) continue;
+
+    for (const auto iPoint : donorPoints) {
+      bool inside = true;
+      for (auto iDim = 0u; iDim < nDim && inside; iDim++) {
+        const auto x = donor_geometry->nodes->GetCoord(iPoint, iDim);
+        inside = (x >= targetBox[iDim] - allRadius[iRank]) && (x <= targetBox[nDim+iDim] + allRadius[iRank]);
+      }
+      if (inside) sendPoints[iRank].push_back(iPoint);
+    }
+    nSend[iRank] = sendPoints[iRank].size();
+  }
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  /*--- Pack and exchange the coordinates and global indices. ---*/
+  vector<unsigned long> sendStart(size+1, 0), recvStart(size+1, 0);
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendStart[iRank+1] = sendStart[iRank] + nSend[iRank];
+    recvStart[iRank+1] = recvStart[iRank] + nRecv[iRank];
+  }
+
+  vector<su2double> sendCoord(sendStart.back()*nDim);
+  vector<long> sendGlobal(sendStart.back());
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    for (auto iSend = 0ul; iSend < sendPoints[iRank].size(); iSend++) {
+      const auto iPoint = sendPoints[iRank][iSend];
+      const auto pos = sendStart[iRank] + iSend;
+      sendGlobal[pos] = donor_geometry->nodes->GetGlobalIndex(iPoint);
+      for (auto iDim = 0u; iDim < nDim; iDim++)
+        sendCoord[pos*nDim+iDim] = donor_geometry->nodes->GetCoord(iPoint, iDim);
+    }
+  }
+
+  vector<su2double> recvCoord(recvStart.back()*nDim);
+  vector<long> recvGlobal(recvStart.back());
+
+  copy(sendCoord.begin() + sendStart[rank]*nDim, sendCoord.begin() + sendStart[rank+1]*nDim,
+       recvCoord.begin() + recvStart[rank]*nDim);
+  copy(sendGlobal.begin() + sendStart[rank], sendGlobal.begin() + sendStart[rank+1],
+       recvGlobal.begin() + recvStart[rank]);
+
+#ifdef HAVE_MPI
+  vector<SU2_MPI::Request> requests;
+  requests.reserve(4*size);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank == rank || nRecv[iRank] == 0) continue;
+    requests.emplace_back();
+    SU2_MPI::Irecv(&recvCoord[recvStart[iRank]*nDim], nRecv[iRank]*nDim, MPI_DOUBLE,
+                   iRank, 0, MPI_COMM_WORLD, &requests.back());
+    requests.emplace_back();
+    SU2_MPI::Irecv(&recvGlobal[recvStart[iRank]], nRecv[iRank], MPI_LONG,
+                   iRank, 1, MPI_COMM_WORLD, &requests.back());
+  }
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank == rank || nSend[iRank] == 0) continue;
+    requests.emplace_back();
+    SU2_MPI::Isend(&sendCoord[sendStart[iRank]*nDim], nSend[iRank]*nDim, MPI_DOUBLE,
+                   iRank, 0, MPI_COMM_WORLD, &requests.back());
+    requests.emplace_back();
+    SU2_MPI::Isend(&sendGlobal[sendStart[iRank]], nSend[iRank], MPI_LONG,
+                   iRank, 1, MPI_COMM_WORLD, &requests.back());
+  }
+  SU2_MPI::Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+#endif
+
+  /*--- Sort the received vertices by global index, which makes the order independent of the partitioning. ---*/
+  const auto nRecvTotal = recvStart.back();
+  vector<unsigned long> order(nRecvTotal);
+  iota(order.begin(), order.end(), 0ul);
+  sort(order.begin(), order.end(), [&](unsigned long a, unsigned long b) { return recvGlobal[a] < recvGlobal[b]; });
+
+  vector<int> recvProc(nRecvTotal);
+  for (int iRank = 0; iRank < size; iRank++)
+    fill(recvProc.begin() + recvStart[iRank], recvProc.begin() + recvStart[iRank+1], iRank);
+
+  coord.resize(nRecvTotal*nDim);
+  globalPoint.resize(nRecvTotal);
+  proc.resize(nRecvTotal);
+
+  for (auto i = 0ul; i < nRecvTotal; i++) {
+    const auto j = order[i];
+    globalPoint[i] = recvGlobal[j];
+    proc[i] = recvProc[j];
+    for (auto iDim = 0u; iDim < nDim; iDim++) coord[i*nDim+iDim] = recvCoord[j*nDim+iDim];
+  }
+}
+
 unsigned long CInterpolator::Collect_ElementInfo(int markDonor, unsigned short nDim, bool compress,
                              vector<unsigned long>& allNumElem, vector<unsigned short>& numNodes,
                              su2matrix<long>& idxNodes) const {
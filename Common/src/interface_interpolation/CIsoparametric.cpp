@@ -30,22 +30,12 @@
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/adt_structure.hpp"
 #include <unordered_map>
 
 using namespace GeometryToolbox;
 
 
-/*! \brief Helper struct to store information about candidate donor elements. */
-struct DonorInfo {
-  su2double isoparams[4] = {0.0};  /*!< \brief Interpolation coefficients. */
-  su2double distance = 0.0;        /*!< \brief Distance from target to final mapped point on donor plane. */
-  unsigned iElem = 0;              /*!< \brief Identification of the element. */
-  int error = 0;                   /*!< \brief If the mapped point is "outside" of the donor. */
-
-  /*--- Best donor is one for which the mapped point is closest to target. ---*/
-  bool operator< (const DonorInfo& other) const { return distance < other.distance; }
-};
-
 CIsoparametric::CIsoparametric(CGeometry ****geometry_container, const CConfig* const* config, unsigned int iZone,
                                unsigned int jZone) : CInterpolator(geometry_container, config, iZone, jZone) {
   SetTransferCoeff(config);
@@ -67,6 +57,11 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
 
   Buffer_Receive_nVertex_Donor = new unsigned long [nProcessor];
 
+  /*--- The coefficients are recomputed when recording, to keep their dependency on the coordinates. ---*/
+  const bool useCache = !config[donorZone]->GetDiscrete_Adjoint();
+  rigidCache.resize(nMarkerInt);
+  coeffChanged = false;
+
   /*--- Init stats. ---*/
   MaxDistance = 0.0; ErrorCounter = 0;
   unsigned long nGlobalVertexTarget = 0;
@@ -90,6 +85,20 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
     /*--- Checks if the zone contains the interface, if not continue to the next step. ---*/
     if (!CheckInterfaceBoundary(markDonor, markTarget)) continue;
 
+    /*--- If the interface only moved rigidly since the coefficients were computed they remain valid. ---*/
+    auto& cache = rigidCache[iMarkerInt];
+
+    if (CheckRigidMotionCache(cache, markDonor, markTarget, nDim)) {
+      MaxDistance = max(MaxDistance, cache.maxDist);
+      ErrorCounter += cache.errorCount;
+      nGlobalVertexTarget += cache.nTarget;
+      continue;
+    }
+    cache.valid = false;
+    cache.maxDist = 0.0;
+    cache.errorCount = cache.nTarget = 0;
+    coeffChanged = true;
+
     unsigned long nVertexDonor = 0, nVertexTarget = 0;
     if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
     if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
@@ -145,14 +154,28 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
     const auto nGlobalElemDonor = Collect_ElementInfo(markDonor, nDim, true,
                                     allNumElem, elemNumNodes, elemIdxNodes);
 
-    /*--- Map the node to "local" indices and create a list of connected elements for each vertex. ---*/
+    /*--- Map the nodes to "local" indices and build an ADT of the donor elements. ---*/
+
+    vector<su2double> elemCoord(nGlobalVertexDonor*nDim);
+    for (auto iVertex = 0ul; iVertex < nGlobalVertexDonor; ++iVertex)
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        elemCoord[iVertex*nDim+iDim] = donorCoord(iVertex,iDim);
 
-    vector<vector<unsigned> > vertexElements(nGlobalVertexDonor);
+    vector<unsigned long> elemConn, elemID(nGlobalElemDonor);
+    vector<unsigned short> elemType(nGlobalElemDonor), elemMarker(nGlobalElemDonor, 0);
+    iota(elemID.begin(), elemID.end(), 0ul);
 
     for (auto iElem = 0u; iElem < nGlobalElemDonor; ++iElem) {
 
       const auto nNode = elemNumNodes[iElem];
 
+      switch (nNode) {
+        case 2: elemType[iElem] = LINE; break;
+        case 3: elemType[iElem] = TRIANGLE; break;
+        case 4: elemType[iElem] = QUADRILATERAL; break;
+        default: SU2_MPI::Error("Unsupported donor element type.", CURRENT_FUNCTION); break;
+      }
+
       for (auto iNode = 0u; iNode < nNode; ++iNode) {
 
         assert(globalToLocalMap.count(elemIdxNodes(iElem,iNode)) &&
@@ -160,13 +183,20 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
         const auto iVertex = globalToLocalMap.at(elemIdxNodes(iElem,iNode));
         elemIdxNodes(iElem,iNode) = iVertex;
 
-        vertexElements[iVertex].push_back(iElem);
+        elemConn.push_back(iVertex);
       }
     }
 
+    CADTElemClass donorADT(nDim, elemCoord, elemConn, elemType, elemMarker, elemID, false);
+
+    if (donorADT.IsEmpty())
+      SU2_MPI::Error("The donor side of an isoparametric interface has no elements.", CURRENT_FUNCTION);
+
     /*--- Compute transfer coefficients for each target point. ---*/
     SU2_OMP_PARALLEL
     {
+    /*--- Working variables of this thread. ---*/
+    su2double coords[4][3], isoparams[4];
     su2double maxDist = 0.0;
     unsigned long errorCount = 0, totalCount = 0;
 
@@ -182,78 +212,62 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
       /*--- Coordinates of the target point. ---*/
       const su2double* coord_i = target_geometry->nodes->GetCoord(iPoint);
 
-      /*--- Find the closest donor vertex. ---*/
-      su2double minDist = 1e9;
-      unsigned iClosestVertex = 0;
-      for (auto iVertexDonor = 0u; iVertexDonor < nGlobalVertexDonor; ++iVertexDonor) {
-        su2double d = SquaredDistance(nDim, coord_i, donorCoord[iVertexDonor]);
-        if (d < minDist) {
-          minDist = d;
-          iClosestVertex = iVertexDonor;
-        }
+      /*--- Find the closest donor element. ---*/
+      su2double elemDist;
+      unsigned short iMarker;
+      unsigned long iElem;
+      int iRank;
+      donorADT.DetermineNearestElement(coord_i, elemDist, iMarker, iElem, iRank);
+
+      const auto nNode = elemNumNodes[iElem];
+
+      for (auto iNode = 0u; iNode < nNode; ++iNode) {
+        const auto iVertex = elemIdxNodes(iElem, iNode);
+        for (auto iDim = 0u; iDim < 3u; ++iDim)
+          coords[iNode][iDim] = (iDim < nDim)? donorCoord(iVertex,iDim) : su2double(0.0);
       }
 
-      if (minDist < matchingVertexTol) {
+      auto iMatch = 0u;
+      while (iMatch < nNode && SquaredDistance(nDim, coord_i, coords[iMatch]) >= matchingVertexTol) ++iMatch;
+
+      if (iMatch < nNode) {
         /*--- Perfect match. ---*/
+        const auto iVertex = elemIdxNodes(iElem, iMatch);
         target_vertex->Allocate_DonorInfo(1);
         target_vertex->SetDonorCoeff(0, 1.0);
-        target_vertex->SetInterpDonorPoint(0, donorPoint[iClosestVertex]);
-        target_vertex->SetInterpDonorProcessor(0, donorProc[iClosestVertex]);
+        target_vertex->SetInterpDonorPoint(0, donorPoint[iVertex]);
+        target_vertex->SetInterpDonorProcessor(0, donorProc[iVertex]);
         continue;
       }
 
-      /*--- Evaluate interpolation for the elements connected to the closest vertex. ---*/
-      DonorInfo donor;
-      donor.error = 2;
-      donor.distance = 1e9;
-      for (auto iElem : vertexElements[iClosestVertex]) {
-        /*--- Fetch element info. ---*/
-        DonorInfo candidate;
-        candidate.iElem = iElem;
-        const auto nNode = elemNumNodes[iElem];
-        su2double coords[4][3] = {{0.0}};
-
-        for (auto iNode = 0u; iNode < nNode; ++iNode) {
-          const auto iVertex = elemIdxNodes(iElem, iNode);
-          for (auto iDim = 0u; iDim < nDim; ++iDim)
-            coords[iNode][iDim] = donorCoord(iVertex,iDim);
-        }
-
-        /*--- Compute the interpolation coefficients. ---*/
-        switch (nNode) {
-          case 2: candidate.error = LineIsoparameters(coords, coord_i, candidate.isoparams); break;
-          case 3: candidate.error = TriangleIsoparameters(coords, coord_i, candidate.isoparams); break;
-          case 4: candidate.error = QuadrilateralIsoparameters(coords, coord_i, candidate.isoparams); break;
-        }
-
-        /*--- Evaluate distance from target to final mapped point. ---*/
-        su2double finalCoord[3] = {0.0};
-        for (auto iDim = 0u; iDim < nDim; ++iDim)
-          for (auto iNode = 0u; iNode < nNode; ++iNode)
-            finalCoord[iDim] += coords[iNode][iDim] * candidate.isoparams[iNode];
-
-        candidate.distance = Distance(nDim, coord_i, finalCoord);
-
-        /*--- Detect a very bad candidate (NaN). ---*/
-        if (candidate.distance != candidate.distance) continue;
-
-        /*--- Check if the candidate is an improvement, update donor if so. ---*/
-        if (candidate < donor) donor = candidate;
+      /*--- Compute the interpolation coefficients. ---*/
+      int error = 0;
+      switch (nNode) {
+        case 2: error = LineIsoparameters(coords, coord_i, isoparams); break;
+        case 3: error = TriangleIsoparameters(coords, coord_i, isoparams); break;
+        case 4: error = QuadrilateralIsoparameters(coords, coord_i, isoparams); break;
       }
 
-      if (donor.error > 1)
-        SU2_MPI::Error("Isoparametric interpolation failed, NaN detected.", CURRENT_FUNCTION);
+      /*--- Evaluate distance from target to final mapped point. ---*/
+      su2double finalCoord[3] = {0.0};
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        for (auto iNode = 0u; iNode < nNode; ++iNode)
+          finalCoord[iDim] += coords[iNode][iDim] * isoparams[iNode];
+
+      const su2double distance = Distance(nDim, coord_i, finalCoord);
 
-      errorCount += donor.error;
-      maxDist = max(maxDist, donor.distance);
+      /*--- Detect a very bad donor (NaN). ---*/
+      if (distance != distance)
+        SU2_MPI::Error("Isoparametric interpolation failed, NaN detected.", CURRENT_FUNCTION);
 
-      const auto nNode = elemNumNodes[donor.iElem];
+      errorCount += error;
+      maxDist = max(maxDist, distance);
 
       target_vertex->Allocate_DonorInfo(nNode);
 
       for (auto iNode = 0u; iNode < nNode; ++iNode) {
-        const auto iVertex = elemIdxNodes(donor.iElem, iNode);
-        target_vertex->SetDonorCoeff(iNode, donor.isoparams[iNode]);
+        const auto iVertex = elemIdxNodes(iElem, iNode);
+        target_vertex->SetDonorCoeff(iNode, isoparams[iNode]);
         target_vertex->SetInterpDonorPoint(iNode, donorPoint[iVertex]);
         target_vertex->SetInterpDonorProcessor(iNode, donorProc[iVertex]);
       }
@@ -261,12 +275,18 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
     }
     SU2_OMP_CRITICAL
     {
-      MaxDistance = max(MaxDistance, maxDist);
-      ErrorCounter += errorCount;
-      nGlobalVertexTarget += totalCount;
+      cache.maxDist = max(cache.maxDist, maxDist);
+      cache.errorCount += errorCount;
+      cache.nTarget += totalCount;
     }
     } // end SU2_OMP_PARALLEL
 
+    if (useCache) SetRigidMotionCache(cache, markDonor, markTarget, nDim, donorCoord, donorPoint, donorProc);
+
+    MaxDistance = max(MaxDistance, cache.maxDist);
+    ErrorCounter += cache.errorCount;
+    nGlobalVertexTarget += cache.nTarget;
+
   } // end nMarkerInt loop
 
   /*--- Final reduction of statistics. ---*/
@@ -280,6 +300,154 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
 
 }
 
+void CIsoparametric::SetRigidMotionCache(CRigidMotionCache& cache, int markDonor, int markTarget, unsigned short nDim,
+                                         const su2activematrix& donorCoord, const vector<long>& donorPoint,
+                                         const vector<int>& donorProc) const {
+
+  /*--- The coefficients only depend on the distances between each target and the donor points, these
+   *    are determined by the distances to a set of donor points that spans the affine hull of the donor
+   *    interface. The reference points are chosen greedily, each one the farthest from the hull of the
+   *    previous ones, the gathered donor data is the same on all ranks so they choose the same. ---*/
+
+  const auto nDonor = donorCoord.rows();
+
+  cache.refPoint.clear();
+  cache.refRank.clear();
+  cache.refVertex.clear();
+
+  if (nDonor == 0) return;
+
+  vector<unsigned long> refIndex(1, 0);
+  vector<array<passivedouble,3> > basis;
+  passivedouble length = 0.0;
+
+  while (refIndex.size() < nDim+1ul) {
+    passivedouble maxDist = 0.0;
+    unsigned long iFarthest = 0;
+
+    for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+      passivedouble delta[3] = {0.0};
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        delta[iDim] = SU2_TYPE::GetValue(donorCoord(iDonor,iDim) - donorCoord(refIndex[0],iDim));
+
+      for (const auto& e : basis) {
+        const auto proj = DotProduct(nDim, delta, e.data());
+        for (auto iDim = 0u; iDim < nDim; ++iDim) delta[iDim] -= proj * e[iDim];
+      }
+      const auto dist = Norm(nDim, delta);
+      if (dist > maxDist) { maxDist = dist; iFarthest = iDonor; }
+    }
+
+    if (basis.empty()) length = maxDist;
+    if (maxDist <= 1e-9*length || maxDist == 0.0) break;
+
+    array<passivedouble,3> e{};
+    for (auto iDim = 0u; iDim < nDim; ++iDim)
+      e[iDim] = SU2_TYPE::GetValue(donorCoord(iFarthest,iDim) - donorCoord(refIndex[0],iDim));
+    for (const auto& f : basis) {
+      const auto proj = DotProduct(nDim, e.data(), f.data());
+      for (auto iDim = 0u; iDim < nDim; ++iDim) e[iDim] -= proj * f[iDim];
+    }
+    for (auto iDim = 0u; iDim < nDim; ++iDim) e[iDim] /= maxDist;
+
+    basis.push_back(e);
+    refIndex.push_back(iFarthest);
+  }
+
+  const auto nRef = refIndex.size();
+  cache.tolerance = 1e-8*length;
+
+  for (const auto iDonor : refIndex) {
+    cache.refPoint.push_back(donorPoint[iDonor]);
+    cache.refRank.push_back(donorProc[iDonor]);
+  }
+
+  /*--- The owners of the reference points find their vertices. ---*/
+
+  cache.refVertex.assign(nRef, 0);
+
+  const auto nVertexDonor = (markDonor != -1)? donor_geometry->GetnVertex(markDonor) : 0ul;
+
+  for (auto iVertex = 0ul; iVertex < nVertexDonor; ++iVertex) {
+    const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+    if (!donor_geometry->nodes->GetDomain(iPoint)) continue;
+
+    for (auto iRef = 0ul; iRef < nRef; ++iRef)
+      if (cache.refRank[iRef] == rank && cache.refPoint[iRef] == long(donor_geometry->nodes->GetGlobalIndex(iPoint)))
+        cache.refVertex[iRef] = iVertex;
+  }
+
+  /*--- Distances of all the interface vertices of this rank to the reference points. ---*/
+
+  su2activematrix refCoord(nRef, nDim);
+  for (auto iRef = 0ul; iRef < nRef; ++iRef)
+    for (auto iDim = 0u; iDim < nDim; ++iDim)
+      refCoord(iRef,iDim) = donorCoord(refIndex[iRef],iDim);
+
+  GetReferenceDistances(markDonor, markTarget, nDim, refCoord, cache.donorDist, cache.targetDist);
+
+  cache.valid = true;
+}
+
+bool CIsoparametric::CheckRigidMotionCache(const CRigidMotionCache& cache, int markDonor, int markTarget,
+                                           unsigned short nDim) const {
+
+  /*--- Validity is the same on all ranks. ---*/
+  if (!cache.valid) return false;
+
+  const auto nRef = cache.refPoint.size();
+
+  /*--- Current coordinates of the reference points. ---*/
+
+  su2activematrix myRefCoord(nRef, nDim), refCoord(nRef, nDim);
+  myRefCoord = su2double(0.0);
+
+  for (auto iRef = 0ul; iRef < nRef; ++iRef) {
+    if (cache.refRank[iRef] != rank) continue;
+    const auto iPoint = donor_geometry->vertex[markDonor][cache.refVertex[iRef]]->GetNode();
+    for (auto iDim = 0u; iDim < nDim; ++iDim)
+      myRefCoord(iRef,iDim) = donor_geometry->nodes->GetCoord(iPoint, iDim);
+  }
+
+  SU2_MPI::Allreduce(myRefCoord.data(), refCoord.data(), nRef*nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+  /*--- Compare the distances of the local vertices. ---*/
+
+  vector<passivedouble> donorDist, targetDist;
+  GetReferenceDistances(markDonor, markTarget, nDim, refCoord, donorDist, targetDist);
+
+  int unchanged = 1;
+  for (auto i = 0ul; i < donorDist.size(); ++i)
+    unchanged &= (fabs(donorDist[i] - cache.donorDist[i]) <= cache.tolerance);
+  for (auto i = 0ul; i < targetDist.size(); ++i)
+    unchanged &= (fabs(targetDist[i] - cache.targetDist[i]) <= cache.tolerance);
+
+  int allUnchanged = 0;
+  SU2_MPI::Allreduce(&unchanged, &allUnchanged, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+  return allUnchanged;
+}
+
+void CIsoparametric::GetReferenceDistances(int markDonor, int markTarget, unsigned short nDim,
+                                           const su2activematrix& refCoord, vector<passivedouble>& donorDist,
+                                           vector<passivedouble>& targetDist) const {
+
+  const auto nRef = refCoord.rows();
+
+  auto compute = [&](CGeometry* geometry, int marker, vector<passivedouble>& dist) {
+    const auto nVertex = (marker != -1)? geometry->GetnVertex(marker) : 0ul;
+    dist.resize(nVertex*nRef);
+
+    for (auto iVertex = 0ul; iVertex < nVertex; ++iVertex) {
+      const auto coord = geometry->nodes->GetCoord(geometry->vertex[marker][iVertex]->GetNode());
+      for (auto iRef = 0ul; iRef < nRef; ++iRef)
+        dist[iVertex*nRef+iRef] = SU2_TYPE::GetValue(Distance(nDim, coord, refCoord[iRef]));
+    }
+  };
+  compute(donor_geometry, markDonor, donorDist);
+  compute(target_geometry, markTarget, targetDist);
+}
+
 int CIsoparametric::LineIsoparameters(const su2double X[][3], const su2double *xj, su2double *isoparams) {
 
   /*--- Project the target point onto the line. ---*/
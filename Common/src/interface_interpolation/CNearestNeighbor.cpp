@@ -28,17 +28,10 @@
 #include "../../include/interface_interpolation/CNearestNeighbor.hpp"
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
-#include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/adt_structure.hpp"
 
+#include <numeric>
 
-/*! \brief Helper struct to (partially) sort neighbours according to distance while
- *         keeping track of the origin of the point (i.e. index and processor). */
-struct DonorInfo {
-  su2double dist;
-  unsigned pidx;
-  int proc;
-  DonorInfo(su2double d = 0.0, unsigned i = 0, int p = 0) : dist(d), pidx(i), proc(p) { }
-};
 
 CNearestNeighbor::CNearestNeighbor(CGeometry ****geometry_container, const CConfig* const* config,  unsigned int iZone,
                                    unsigned int jZone) : CInterpolator(geometry_container, config, iZone, jZone) {
@@ -58,14 +51,9 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
   /*--- Epsilon used to avoid division by zero. ---*/
   const su2double eps = numeric_limits<passivedouble>::epsilon();
 
-  const int nProcessor = size;
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface()/2;
   const auto nDim = donor_geometry->GetnDim();
 
-  Buffer_Receive_nVertex_Donor = new unsigned long [nProcessor];
-
-  vector<vector<DonorInfo> > DonorInfoVec(omp_get_max_threads());
-
   /*--- Cycle over nMarkersInt interface to determine communication pattern. ---*/
 
   AvgDistance = MaxDistance = 0.0;
@@ -82,30 +70,31 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
     /*--- Checks if the zone contains the interface, if not continue to the next step. ---*/
     if (!CheckInterfaceBoundary(markDonor, markTarget)) continue;
 
-    unsigned long nVertexDonor = 0, nVertexTarget = 0;
-    if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
+    unsigned long nVertexTarget = 0;
     if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
 
-    /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
-    Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
-
-    const auto nPossibleDonor = accumulate(Buffer_Receive_nVertex_Donor,
-                                Buffer_Receive_nVertex_Donor+nProcessor, 0ul);
+    /*--- Donor vertices that may be among the k closest to the targets of this rank. ---*/
+    vector<su2double> donorCoord;
+    vector<long> donorGlobalPoint;
+    vector<int> donorRank;
+    Collect_OverlappingVertexInfo(markDonor, markTarget, nDim, nDonor,
+                                  donorCoord, donorGlobalPoint, donorRank);
 
-    Buffer_Send_Coord = new su2double [ MaxLocalVertex_Donor * nDim ];
-    Buffer_Send_GlobalPoint = new long [ MaxLocalVertex_Donor ];
-    Buffer_Receive_Coord = new su2double [ nProcessor * MaxLocalVertex_Donor * nDim ];
-    Buffer_Receive_GlobalPoint = new long [ nProcessor * MaxLocalVertex_Donor ];
+    /*--- ADT of those vertices, they are sorted by global index, hence their position is used as
+     *    point ID, which then also breaks ties in the distance independently of the partitioning. ---*/
+    vector<unsigned long> donorIndex(donorGlobalPoint.size());
+    iota(donorIndex.begin(), donorIndex.end(), 0ul);
+    CADTPointsOnlyClass donorADT(nDim, donorIndex.size(), donorCoord.data(), donorIndex.data(), false);
 
-    /*--- Collect coordinates and global point indices. ---*/
-    Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
+    if (donorADT.IsEmpty()) continue;
 
     /*--- Find the closest donor points to each target. ---*/
     SU2_OMP_PARALLEL
     {
-    /*--- Working array for this thread. ---*/
-    auto& donorInfo = DonorInfoVec[omp_get_thread_num()];
-    donorInfo.resize(nPossibleDonor);
+    /*--- Working arrays for this thread. ---*/
+    vector<su2double> donorDist;
+    vector<unsigned long> donorPoint;
+    vector<int> treeRank;
 
     su2double avgDist = 0.0, maxDist = 0.0;
     unsigned long numTarget = 0;
@@ -121,47 +110,30 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
       /*--- Coordinates of the target point. ---*/
       const su2double* Coord_i = target_geometry->nodes->GetCoord(Point_Target);
 
-      /*--- Compute all distances. ---*/
-      for (int iProcessor = 0, iDonor = 0; iProcessor < nProcessor; ++iProcessor) {
-        for (auto jVertex = 0ul; jVertex < Buffer_Receive_nVertex_Donor[iProcessor]; ++jVertex) {
-
-          const auto idx = iProcessor*MaxLocalVertex_Donor + jVertex;
-          const auto pGlobalPoint = Buffer_Receive_GlobalPoint[idx];
-          const su2double* Coord_j = &Buffer_Receive_Coord[idx*nDim];
-          const auto dist2 = GeometryToolbox::SquaredDistance(nDim, Coord_i, Coord_j);
-
-          donorInfo[iDonor++] = DonorInfo(dist2, pGlobalPoint, iProcessor);
-        }
-      }
-
-      /*--- Find k closest points (need to define the comparator inline or debug build give wrong results). ---*/
-      partial_sort(donorInfo.begin(), donorInfo.begin()+nDonor, donorInfo.end(),
-        [](const DonorInfo& a, const DonorInfo& b) {
-          /*--- Global index is used as tie-breaker to make sorted order independent of initial. ---*/
-          return (a.dist != b.dist)? (a.dist < b.dist) : (a.pidx < b.pidx);
-        }
-      );
+      /*--- Find the k closest points, sorted by (squared) distance. ---*/
+      donorADT.DetermineNearestNodes(Coord_i, nDonor, donorDist, donorPoint, treeRank);
+      const auto nFound = donorDist.size();
 
       /*--- Update stats. ---*/
       numTarget += 1;
-      su2double d = sqrt(donorInfo[0].dist);
-      avgDist += d;
-      maxDist = max(maxDist, d);
+      const su2double minDist = sqrt(donorDist[0]);
+      avgDist += minDist;
+      maxDist = max(maxDist, minDist);
 
       /*--- Compute interpolation numerators and denominator. ---*/
       su2double denom = 0.0;
-      for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
-        donorInfo[iDonor].dist = 1.0 / (donorInfo[iDonor].dist + eps);
-        denom += donorInfo[iDonor].dist;
+      for (auto iDonor = 0ul; iDonor < nFound; ++iDonor) {
+        donorDist[iDonor] = 1.0 / (donorDist[iDonor] + eps);
+        denom += donorDist[iDonor];
       }
 
       /*--- Set interpolation coefficients. ---*/
-      target_vertex->Allocate_DonorInfo(nDonor);
+      target_vertex->Allocate_DonorInfo(nFound);
 
-      for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
-        target_vertex->SetInterpDonorPoint(iDonor, donorInfo[iDonor].pidx);
-        target_vertex->SetInterpDonorProcessor(iDonor, donorInfo[iDonor].proc);
-        target_vertex->SetDonorCoeff(iDonor, donorInfo[iDonor].dist/denom);
+      for (auto iDonor = 0ul; iDonor < nFound; ++iDonor) {
+        target_vertex->SetInterpDonorPoint(iDonor, donorGlobalPoint[donorPoint[iDonor]]);
+        target_vertex->SetInterpDonorProcessor(iDonor, donorRank[donorPoint[iDonor]]);
+        target_vertex->SetDonorCoeff(iDonor, donorDist[iDonor]/denom);
       }
     }
     SU2_OMP_CRITICAL
@@ -172,16 +144,8 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
     }
     } // end SU2_OMP_PARALLEL
 
-    delete[] Buffer_Send_Coord;
-    delete[] Buffer_Send_GlobalPoint;
-
-    delete[] Buffer_Receive_Coord;
-    delete[] Buffer_Receive_GlobalPoint;
-
   }
 
-  delete[] Buffer_Receive_nVertex_Donor;
-
   unsigned long tmp = totalTargetPoints;
   SU2_MPI::Allreduce(&tmp, &totalTargetPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
   su2double tmp1 = AvgDistance, tmp2 = MaxDistance;
@@ -28,6 +28,7 @@
 #include "../../include/interface_interpolation/CRadialBasisFunction.hpp"
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
+#include "../../include/adt_structure.hpp"
 #include "../../include/toolboxes/CSymmetricMatrix.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 
@@ -95,6 +96,11 @@ su2double CRadialBasisFunction::Get_RadialBasisValue(ENUM_RADIALBASIS type, cons
 
 void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
+  if (config[donorZone]->GetRadialBasisFunctionNeighbors() > 0) {
+    SetLocalStencilTransferCoeff(config);
+    return;
+  }
+
   /*--- RBF options. ---*/
   const auto kindRBF = static_cast<ENUM_RADIALBASIS>(config[donorZone]->GetKindRadialBasisFunction());
   const bool usePolynomial = config[donorZone]->GetRadialBasisFunctionPolynomialOption();
@@ -404,6 +410,13 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
   } // end loop over interface markers
 
+  ReduceStatistics(totalTargetPoints, totalDonorPoints, denseSize);
+
+}
+
+void CRadialBasisFunction::ReduceStatistics(unsigned long totalTargetPoints, unsigned long totalDonorPoints,
+                                            unsigned long denseSize) {
+
   /*--- Final reduction of interpolation statistics and basic sanity checks. ---*/
   auto Reduce = [](SU2_MPI::Op op, unsigned long &val) {
     auto tmp = val;
@@ -435,6 +448,182 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
 }
 
+void CRadialBasisFunction::ComputeStencilCoefficients(ENUM_RADIALBASIS type, bool usePolynomial, su2double radius,
+                                                     const su2activematrix& coords, const su2double* target,
+                                                     vector<passivedouble>& coeffs) {
+  const auto nStencil = coords.rows();
+  const int nDim = coords.cols();
+
+  /*--- Generator matrix of the stencil. ---*/
+  int nPolynomial = -1;
+  vector<int> keepPolynomialRow(nDim, 1);
+  su2passivematrix C_inv_trunc;
+  ComputeGeneratorMatrix(type, usePolynomial, radius, coords, nPolynomial, keepPolynomialRow, C_inv_trunc);
+
+  /*--- Function row of the target, polynomial and RBF terms (see SetTransferCoeff). ---*/
+  vector<passivedouble> funcRow(1+nPolynomial+nStencil);
+  if (usePolynomial) {
+    funcRow[0] = 1.0;
+    for (int iDim = 0, idx = 1; iDim < nDim; ++iDim) {
+      if (!keepPolynomialRow[iDim]) continue;
+      funcRow[idx++] = SU2_TYPE::GetValue(target[iDim]);
+    }
+  }
+  for (auto iDonor = 0ul; iDonor < nStencil; ++iDonor) {
+    auto dist = GeometryToolbox::Distance(nDim, target, coords[iDonor]);
+    funcRow[1+nPolynomial+iDonor] = SU2_TYPE::GetValue(Get_RadialBasisValue(type, radius, dist));
+  }
+
+  /*--- Interpolation coefficients, coeffs = funcRow * C_inv_trunc. ---*/
+  coeffs.assign(nStencil, 0.0);
+  for (auto k = 0ul; k < funcRow.size(); ++k)
+    for (auto iDonor = 0ul; iDonor < nStencil; ++iDonor)
+      coeffs[iDonor] += funcRow[k] * C_inv_trunc(k,iDonor);
+}
+
+void CRadialBasisFunction::SetLocalStencilTransferCoeff(const CConfig* const* config) {
+
+  /*--- RBF options. ---*/
+  const auto kindRBF = static_cast<ENUM_RADIALBASIS>(config[donorZone]->GetKindRadialBasisFunction());
+  const bool usePolynomial = config[donorZone]->GetRadialBasisFunctionPolynomialOption();
+  const su2double paramRBF = config[donorZone]->GetRadialBasisFunctionParameter();
+  const su2double pruneTol = config[donorZone]->GetRadialBasisFunctionPruneTol();
+  const auto nNeighbor = config[donorZone]->GetRadialBasisFunctionNeighbors();
+
+  const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface()/2;
+  const int nDim = donor_geometry->GetnDim();
+
+  if (usePolynomial && nNeighbor < nDim+1ul)
+    SU2_MPI::Error("The local RBF stencils need at least NDIM+1 donors when the polynomial term is used.",
+                   CURRENT_FUNCTION);
+
+  /*--- Initialize variables for interpolation statistics. ---*/
+  unsigned long totalTargetPoints = 0, totalDonorPoints = 0, denseSize = 0;
+  MinDonors = 1<<30; MaxDonors = 0; MaxCorrection = 0.0; AvgCorrection = 0.0;
+
+  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; ++iMarkerInt) {
+
+    /*--- On the donor side: find the tag of the boundary sharing the interface. ---*/
+    const auto markDonor = config[donorZone]->FindInterfaceMarker(iMarkerInt);
+
+    /*--- On the target side: find the tag of the boundary sharing the interface. ---*/
+    const auto markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
+
+    /*--- If the zone does not contain the interface continue to the next pair of markers. ---*/
+    if (!CheckInterfaceBoundary(markDonor,markTarget)) continue;
+
+    unsigned long nVertexTarget = 0;
+    if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
+
+    /*--- Donor points that may be in the stencils of the targets of this rank, they are sorted by
+     *    global index, which gives an MPI-independent order to the points of each stencil. ---*/
+    vector<su2double> donorCoord;
+    vector<long> donorPoint;
+    vector<int> donorProc;
+    Collect_OverlappingVertexInfo(markDonor, markTarget, nDim, nNeighbor, donorCoord, donorPoint, donorProc);
+
+    /*--- Every stencil must have enough donors for the polynomial term, the overlap has
+     *    fewer than nNeighbor if the entire donor boundary is smaller. ---*/
+    if (usePolynomial && donorPoint.size() < nDim+1ul) {
+      for (auto iVertex = 0ul; iVertex < nVertexTarget; ++iVertex) {
+        if (target_geometry->nodes->GetDomain(target_geometry->vertex[markTarget][iVertex]->GetNode()))
+          SU2_MPI::Error("Fewer than NDIM+1 donor points were found for the local RBF stencils, this is not "
+                         "enough for the polynomial term (RADIAL_BASIS_FUNCTION_POLYNOMIAL_TERM).", CURRENT_FUNCTION);
+      }
+    }
+
+    vector<unsigned long> donorIndex(donorPoint.size());
+    iota(donorIndex.begin(), donorIndex.end(), 0ul);
+    CADTPointsOnlyClass donorADT(nDim, donorIndex.size(), donorCoord.data(), donorIndex.data(), false);
+
+    /*--- Size of the global system, for the density statistic. ---*/
+    unsigned long nLocalVertexDonor = 0, nGlobalVertexDonor = 0;
+    if (markDonor != -1) {
+      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); ++iVertex)
+        nLocalVertexDonor += donor_geometry->nodes->GetDomain(donor_geometry->vertex[markDonor][iVertex]->GetNode());
+    }
+    SU2_MPI::Allreduce(&nLocalVertexDonor, &nGlobalVertexDonor, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+    if (donorADT.IsEmpty()) continue;
+
+    SU2_OMP_PARALLEL
+    {
+    /*--- Thread-local working variables. ---*/
+    vector<su2double> stencilDist;
+    vector<unsigned long> stencil;
+    vector<int> treeRank;
+    su2activematrix stencilCoord;
+    vector<passivedouble> coeffs;
+
+    /*--- Thread-local variables for statistics. ---*/
+    unsigned long numTarget = 0, minDonors = 1<<30, maxDonors = 0, totalDonors = 0, denseDonors = 0;
+    passivedouble sumCorr = 0.0, maxCorr = 0.0;
+
+    SU2_OMP_FOR_DYN(roundUpDiv(nVertexTarget,2*omp_get_max_threads()))
+    for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; ++iVertexTarget) {
+
+      auto targetVertex = target_geometry->vertex[markTarget][iVertexTarget];
+      const auto pointTarget = targetVertex->GetNode();
+
+      if (!target_geometry->nodes->GetDomain(pointTarget)) continue;
+
+      const su2double* targetCoord = target_geometry->nodes->GetCoord(pointTarget);
+
+      /*--- Stencil of closest donors, in the global order. ---*/
+      donorADT.DetermineNearestNodes(targetCoord, nNeighbor, stencilDist, stencil, treeRank);
+      sort(stencil.begin(), stencil.end());
+      const auto nStencil = stencil.size();
+
+      stencilCoord.resize(nStencil, nDim);
+      for (auto iDonor = 0ul; iDonor < nStencil; ++iDonor)
+        for (int iDim = 0; iDim < nDim; ++iDim)
+          stencilCoord(iDonor,iDim) = donorCoord[stencil[iDonor]*nDim + iDim];
+
+      ComputeStencilCoefficients(kindRBF, usePolynomial, paramRBF, stencilCoord, targetCoord, coeffs);
+
+      /*--- Prune small coefficients. ---*/
+      auto info = PruneSmallCoefficients(SU2_TYPE::GetValue(pruneTol), nStencil, coeffs.begin());
+      auto nnz = info.first;
+      numTarget += 1;
+      totalDonors += nnz;
+      denseDonors += nGlobalVertexDonor;
+      minDonors = min(minDonors, nnz);
+      maxDonors = max(maxDonors, nnz);
+      auto corr = fabs(info.second-1.0);
+      sumCorr += corr;
+      maxCorr = max(maxCorr, corr);
+
+      /*--- Allocate and set donor information for this target point. ---*/
+      targetVertex->Allocate_DonorInfo(nnz);
+
+      for (unsigned long iDonor = 0, iSet = 0; iDonor < nStencil; ++iDonor) {
+        if (fabs(coeffs[iDonor]) > 0.0) {
+          targetVertex->SetInterpDonorProcessor(iSet, donorProc[stencil[iDonor]]);
+          targetVertex->SetInterpDonorPoint(iSet, donorPoint[stencil[iDonor]]);
+          targetVertex->SetDonorCoeff(iSet, coeffs[iDonor]);
+          ++iSet;
+        }
+      }
+    }
+
+    SU2_OMP_CRITICAL
+    {
+      totalTargetPoints += numTarget;
+      totalDonorPoints += totalDonors;
+      denseSize += denseDonors;
+      MinDonors = min(MinDonors, minDonors);
+      MaxDonors = max(MaxDonors, maxDonors);
+      AvgCorrection += sumCorr;
+      MaxCorrection = max(MaxCorrection, maxCorr);
+    }
+    } // end SU2_OMP_PARALLEL
+
+  } // end loop over interface markers
+
+  ReduceStatistics(totalTargetPoints, totalDonorPoints, denseSize);
+
+}
+
 void CRadialBasisFunction::ComputeGeneratorMatrix(ENUM_RADIALBASIS type, bool usePolynomial,
                            su2double radius, const su2activematrix& coords, int& nPolynomial,
                            vector<int>& keepPolynomialRow, su2passivematrix& C_inv_trunc) {
@@ -584,10 +773,12 @@ int CRadialBasisFunction::CheckPolynomialTerms(su2double max_diff_tol, vector<in
     n_polynomial = n_rows-1;
     keep_row[remove_row] = 0;
 
-    /*--- Truncated P by shifting rows "up". ---*/
-    for (auto i = remove_row+1; i < m-1; ++i)
+    /*--- Truncated P by shifting rows "up" and dropping the last. ---*/
+    su2passivematrix P_trunc(m-1, n);
+    for (int i = 0; i < m-1; ++i)
       for (int j = 0; j < n; ++j)
-        P(i,j) = P(i+1,j);
+        P_trunc(i,j) = P((i < remove_row+1)? i : i+1, j);
+    P = move(P_trunc);
   }
 
   return n_polynomial;
@@ -29,6 +29,10 @@
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/adt_structure.hpp"
+
+#include <numeric>
+#include <unordered_map>
 
 
 CSlidingMesh::CSlidingMesh(CGeometry ****geometry_container, const CConfig* const* config, unsigned int iZone,
@@ -59,7 +63,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
   /* --- Geometrical variables --- */
 
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
+  su2double *Coord_i, *Normal;
   su2double Area, Area_old, tmp_Area;
   su2double LineIntersectionLength, *Direction, length;
 
@@ -164,6 +168,29 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
     Donor_LinkedNodes      = Buffer_Receive_LinkedNodes;
     Donor_Proc             = Buffer_Receive_Proc;
 
+    /*--- The reconstructed boundaries are complete on every rank, a local ADT of the donor
+     *    boundary gives the closest donor node of each target node (the index in the donor
+     *    boundary is the point ID, ties go to the lowest index), and a map gives the position
+     *    of each target node in the target boundary. ---*/
+    vector<unsigned long> donorIndex(nGlobalVertex_Donor);
+    iota(donorIndex.begin(), donorIndex.end(), 0ul);
+    CADTPointsOnlyClass donorADT(nDim, nGlobalVertex_Donor, DonorPoint_Coord, donorIndex.data(), false);
+
+    vector<su2double> donorDist;
+    vector<unsigned long> donorPoint;
+    vector<int> donorProc;
+
+    auto ClosestDonor = [&](const su2double* coord) {
+      if (donorADT.IsEmpty()) return 0ul;
+      donorADT.DetermineNearestNodes(coord, 1, donorDist, donorPoint, donorProc);
+      return donorPoint[0];
+    };
+
+    unordered_map<long, unsigned long> targetIndex;
+    targetIndex.reserve(nGlobalVertex_Target);
+    for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
+      targetIndex.emplace(Target_GlobalPoint[jVertexTarget], jVertexTarget);
+
     /*--- Starts building the supermesh layer (2D or 3D) ---*/
     /* - For each target node, it first finds the closest donor point
      * - Then it creates the supermesh in the close proximity of the target point:
@@ -195,37 +222,16 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
           Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
 
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
-
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-
-            Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
+          /*--- Find the closest donor_node ---*/
 
-            dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-            if (dist < mindist) {
-              mindist = dist;
-              donor_StartIndex = donor_iPoint;
-            }
-
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }
-          }
+          donor_StartIndex = ClosestDonor(Coord_i);
 
           donor_iPoint    = donor_StartIndex;
           donor_OldiPoint = donor_iPoint;
 
           /*--- Contruct information regarding the target cell ---*/
 
-          long dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if( dPoint == Target_GlobalPoint[jVertexTarget] )
-              break;
+          jVertexTarget = targetIndex.at(target_geometry->nodes->GetGlobalIndex(target_iPoint));
 
           if ( Target_nLinkedNodes[jVertexTarget] == 1 ){
             target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
@@ -460,11 +466,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         for (iDim = 0; iDim < nDim; iDim++)
           Coord_i[iDim] = target_geometry->nodes->GetCoord(target_iPoint, iDim);
 
-        long dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-        for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++){
-          if( dPoint == Target_GlobalPoint[target_iPoint] )
-            break;
-        }
+        target_iPoint = targetIndex.at(target_geometry->nodes->GetGlobalIndex(target_iPoint));
 
         /*--- Build local surface dual mesh for target element ---*/
 
@@ -479,29 +481,9 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes,
                                                 TargetPoint_Coord, target_iPoint, target_element);
 
-        /*--- Brute force to find the closest donor_node ---*/
-
-        mindist = 1E6;
-        donor_StartIndex = 0;
-
-        for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-
-          Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
-
-          dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-          if (dist < mindist) {
-            mindist = dist;
-            donor_StartIndex = donor_iPoint;
-          }
-
-          if (dist == 0.0){
-            donor_StartIndex = donor_iPoint;
-            break;
-          }
-        }
+        /*--- Find the closest donor_node ---*/
 
-        donor_iPoint = donor_StartIndex;
+        donor_iPoint = ClosestDonor(Coord_i);
 
         nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
 
@@ -159,30 +159,13 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     nnz_ilu = csr_ilu.getNumNonZeros();
   }
 
-  /*--- Allocate data. ---*/
-#define ALLOC_AND_INIT(ptr,num) {\
-  ptr = MemoryAllocation::aligned_alloc<ScalarType>(64,num*sizeof(ScalarType));\
-  for(size_t k=0; k<num; ++k) ptr[k]=0.0; }
-
-  ALLOC_AND_INIT(matrix, nnz*nVar*nEqn)
-
-  /*--- Preconditioners. ---*/
-
-  if (ilu_needed) {
-    ALLOC_AND_INIT(ILU_matrix, nnz_ilu*nVar*nEqn)
-  }
-
-  if (diag_needed) {
-    ALLOC_AND_INIT(invM, nPointDomain*nVar*nEqn);
-  }
-#undef ALLOC_AND_INIT
-
   /*--- Thread parallel initialization. ---*/
 
   int num_threads = omp_get_max_threads();
 
-  /*--- Set suitable chunk sizes for light static for loops, and heavy
-   dynamic ones, such that threads are approximately evenly loaded. ---*/
+  /*--- Set suitable chunk sizes for light (e.g. over non zeros) and heavy (over rows) static
+   for loops, such that threads are approximately evenly loaded. The row loops are static so
+   that each thread always works on the rows it first touched (see below). ---*/
   omp_light_size = computeStaticChunkSize(nnz*nVar*nEqn, num_threads, OMP_MAX_SIZE_L);
   omp_heavy_size = computeStaticChunkSize(nPointDomain, num_threads, OMP_MAX_SIZE_H);
 
@@ -198,6 +181,37 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     omp_partitions[part] = part * pts_per_part;
   omp_partitions[omp_num_parts] = nPointDomain;
 
+  /*--- Allocate data. The blocks are first touched by rows, with the distribution of the
+   *    loops that use them, so that they are placed close (NUMA-wise) to those threads. ---*/
+  auto allocAndInit = [this](ScalarType*& ptr, const unsigned long* rowPtr, unsigned long nRow,
+                             unsigned long chunkSize) {
+    const auto blkSize = nVar*nEqn;
+    const auto num = (rowPtr? rowPtr[nRow] : nRow) * blkSize;
+    ptr = MemoryAllocation::aligned_alloc<ScalarType>(64, num*sizeof(ScalarType));
+
+    SU2_OMP_PARALLEL_(if(num >= OMP_FIRST_TOUCH_MIN && !omp_in_parallel()))
+    {
+      SU2_OMP_FOR_STAT(chunkSize)
+      for (auto iRow = 0ul; iRow < nRow; ++iRow) {
+        const auto begin = (rowPtr? rowPtr[iRow] : iRow) * blkSize;
+        const auto end = (rowPtr? rowPtr[iRow+1] : iRow+1) * blkSize;
+        for (auto k = begin; k < end; ++k) ptr[k] = 0.0;
+      }
+    }
+  };
+
+  allocAndInit(matrix, row_ptr, nPoint, omp_heavy_size);
+
+  /*--- Preconditioners, the ILU factorization and substitutions work on one partition per thread. ---*/
+
+  if (ilu_needed) {
+    allocAndInit(ILU_matrix, row_ptr_ilu, nPoint, pts_per_part);
+  }
+
+  if (diag_needed) {
+    allocAndInit(invM, nullptr, nPointDomain, omp_heavy_size);
+  }
+
   /*--- Generate MKL Kernels ---*/
 
 #ifdef USE_MKL
@@ -395,10 +409,7 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
   unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
   const auto COUNT_PER_POINT = (commType == SOLUTION_MATRIX)? nVar : nEqn;
 
-  int ind, source, iMessage, jRecv;
-
-  /*--- Global status so all threads can see the result of Waitany. ---*/
-  static SU2_MPI::Status status;
+  int source, iMessage, jRecv;
 
   /*--- Set some local pointers to make access simpler. ---*/
 
@@ -412,13 +423,7 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
     /*--- For efficiency, recv the messages dynamically based on
      the order they arrive. ---*/
 
-    SU2_OMP_MASTER
-    SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);
-    SU2_OMP_BARRIER
-
-    /*--- Once we have recv'd a message, get the source rank. ---*/
-
-    source = status.MPI_SOURCE;
+    source = geometry->WaitAnyP2PRecv(COMM_TYPE_DOUBLE, COUNT_PER_POINT, (commType == SOLUTION_MATRIXTRANS));
 
     switch (commType) {
       case SOLUTION_MATRIX:
@@ -500,15 +505,9 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
     }
   }
 
-  /*--- Verify that all non-blocking point-to-point sends have finished.
-   Note that this should be satisfied, as we have received all of the
-   data in the loop above at this point. ---*/
+  /*--- Verify that all non-blocking point-to-point sends have finished. ---*/
 
-#ifdef HAVE_MPI
-  SU2_OMP_MASTER
-  SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);
-#endif
-  SU2_OMP_BARRIER
+  geometry->WaitAllP2PSends(COMM_TYPE_DOUBLE);
 
 }
 
@@ -667,7 +666,7 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> &
 
   SU2_OMP_BARRIER
 
-  SU2_OMP_FOR_DYN(omp_heavy_size)
+  SU2_OMP_FOR_STAT(omp_heavy_size)
   for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
     auto prod_begin = row_i*nVar; // offset to beginning of block row_i
     for(auto iVar = 0ul; iVar < nVar; iVar++)
@@ -730,7 +729,7 @@ template<class ScalarType>
 void CSysMatrix<ScalarType>::BuildJacobiPreconditioner(bool transpose) {
 
   /*--- Build Jacobi preconditioner (M = D), compute and store the inverses of the diagonal blocks. ---*/
-  SU2_OMP(for schedule(dynamic,omp_heavy_size) nowait)
+  SU2_OMP(for schedule(static,omp_heavy_size) nowait)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
     InverseDiagonalBlock(iPoint, &(invM[iPoint*nVar*nVar]), transpose);
 
@@ -742,7 +741,7 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
 
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
   SU2_OMP_BARRIER
-  SU2_OMP_FOR_DYN(omp_heavy_size)
+  SU2_OMP_FOR_STAT(omp_heavy_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
     MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
 
@@ -774,7 +773,7 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
     /*--- Transposed or ILUn, traverse matrix to access its blocks
      *    sequentially and set them in the ILU matrix. ---*/
-    SU2_OMP_FOR_DYN(omp_heavy_size)
+    SU2_OMP_FOR_STAT(omp_heavy_size)
     for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
       for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
         auto jPoint = col_ind[index];
@@ -1164,7 +1163,7 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
 
   /*--- Jacobi preconditioning where there is no linelet ---*/
 
-  SU2_OMP(for schedule(dynamic,omp_heavy_size) nowait)
+  SU2_OMP(for schedule(static,omp_heavy_size) nowait)
   for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
     if (!LineletBool[iPoint])
       MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
@@ -1267,7 +1266,7 @@ template<class ScalarType>
 void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType> & sol, const CSysVector<ScalarType> & f,
                                              CSysVector<ScalarType> & res) const {
   SU2_OMP_BARRIER
-  SU2_OMP_FOR_DYN(omp_heavy_size)
+  SU2_OMP_FOR_STAT(omp_heavy_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
     ScalarType aux_vec[MAXNVAR];
     RowProduct(sol, iPoint, aux_vec);
@@ -1362,7 +1361,7 @@ void CSysMatrix<ScalarType>::EnforceSolutionAtDOF(unsigned long node_i, unsigned
 template<class ScalarType>
 void CSysMatrix<ScalarType>::SetDiagonalAsColumnSum() {
 
-  SU2_OMP_FOR_DYN(omp_heavy_size)
+  SU2_OMP_FOR_STAT(omp_heavy_size)
   for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
 
     auto block_ii = &matrix[dia_ptr[iPoint]*nVar*nEqn];
@@ -79,17 +79,24 @@ void CSysVector<ScalarType>::Initialize(unsigned long numBlk, unsigned long numB
 
   omp_chunk_size = computeStaticChunkSize(nElm, omp_get_max_threads(), OMP_MAX_SIZE);
 
-  if (vec_val == nullptr)
+  /*--- New allocations are first touched with the schedule of the vector
+   *    operations, to place the pages close to the threads that use them. ---*/
+  const bool newAlloc = (vec_val == nullptr);
+
+  if (newAlloc)
     vec_val = MemoryAllocation::aligned_alloc<ScalarType>(64, nElm*sizeof(ScalarType));
 
   if(val != nullptr) {
     if(!valIsArray) {
-      for(auto i=0ul; i<nElm; i++) vec_val[i] = *val;
+      parallelFirstTouchSet(nElm, 1, omp_chunk_size, *val, vec_val);
     }
     else {
-      for(auto i=0ul; i<nElm; i++) vec_val[i] = val[i];
+      parallelFirstTouchCopy(nElm, 1, omp_chunk_size, val, vec_val);
     }
   }
+  else if (newAlloc) {
+    parallelFirstTouchSet(nElm, 1, omp_chunk_size, ScalarType(0.0), vec_val);
+  }
 }
 
 template<class ScalarType>
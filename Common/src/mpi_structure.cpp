@@ -35,6 +35,7 @@ CBaseMPIWrapper::Comm CBaseMPIWrapper::currentComm = MPI_COMM_WORLD;
 int  CBaseMPIWrapper::MinRankError;
 bool CBaseMPIWrapper::winMinRankErrorInUse = false;
 CBaseMPIWrapper::Win CBaseMPIWrapper::winMinRankError;
+thread_local passivedouble CBaseMPIWrapper::collectiveWaitTime = 0.0;
 #endif
 
 #ifdef HAVE_MPI
@@ -0,0 +1,164 @@
+/*!
+ * \file CCheckpointStore.cpp
+ * \brief Implementation of the in-memory store of solution snapshots.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CCheckpointStore.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+CCheckpointStore::CCheckpointStore(unsigned long capacity_, int compression_) :
+  capacity(capacity_), compression(compression_) {
+#ifndef HAVE_ZLIB
+  if (compression > 0)
+    SU2_MPI::Error("SU2 was compiled without zlib support, snapshots cannot be compressed.", CURRENT_FUNCTION);
+#endif
+}
+
+unsigned long CCheckpointStore::GetMemory() const {
+  unsigned long bytes = 0;
+  for (const auto& snapshot : snapshots) bytes += snapshot.second.data.size();
+  return bytes;
+}
+
+void CCheckpointStore::Store(int iter, const std::vector<passivedouble>& values) {
+
+  if (!Has(iter) && snapshots.size() >= capacity)
+    SU2_MPI::Error("The checkpoint store is full.", CURRENT_FUNCTION);
+
+  auto& snapshot = snapshots[iter];
+  snapshot.nValues = values.size();
+
+  const auto size = values.size()*sizeof(passivedouble);
+
+#ifdef HAVE_ZLIB
+  if (compression > 0) {
+    uLongf compressedSize = compressBound(size);
+    snapshot.data.resize(compressedSize);
+
+    if (compress2(reinterpret_cast<Bytef*>(snapshot.data.data()), &compressedSize,
+                  reinterpret_cast<const Bytef*>(values.data()), size, compression) != Z_OK)
+      SU2_MPI::Error("Compression of the snapshot failed.", CURRENT_FUNCTION);
+
+    snapshot.data.resize(compressedSize);
+    snapshot.data.shrink_to_fit();
+    return;
+  }
+#endif
+
+  snapshot.data.resize(size);
+  memcpy(snapshot.data.data(), values.data(), size);
+}
+
+void CCheckpointStore::Load(int iter, std::vector<passivedouble>& values) const {
+
+  const auto it = snapshots.find(iter);
+  if (it == snapshots.end())
+    SU2_MPI::Error("The requested snapshot is not in the checkpoint store.", CURRENT_FUNCTION);
+
+  const auto& snapshot = it->second;
+  values.resize(snapshot.nValues);
+
+  const auto size = snapshot.nValues*sizeof(passivedouble);
+
+#ifdef HAVE_ZLIB
+  if (compression > 0) {
+    uLongf uncompressedSize = size;
+    if (uncompress(reinterpret_cast<Bytef*>(values.data()), &uncompressedSize,
+                   reinterpret_cast<const Bytef*>(snapshot.data.data()), snapshot.data.size()) != Z_OK ||
+        uncompressedSize != size)
+      SU2_MPI::Error("Decompression of the snapshot failed.", CURRENT_FUNCTION);
+    return;
+  }
+#endif
+
+  memcpy(values.data(), snapshot.data.data(), size);
+}
+
+void CCheckpointStore::ReleaseAfter(int iter) {
+  snapshots.erase(snapshots.upper_bound(iter), snapshots.end());
+}
+
+int CCheckpointStore::GetLatestBefore(int iter) const {
+  auto it = snapshots.lower_bound(iter);
+  if (it == snapshots.begin()) return iter;
+  return (--it)->first;
+}
+
+unsigned long CCheckpointStore::Beta(unsigned long nSnap, unsigned long nRep) {
+  /*--- (nSnap+nRep)! / (nSnap! nRep!), each partial product is itself a binomial coefficient. ---*/
+  unsigned long beta = 1;
+  for (unsigned long i = 1; i <= nRep; ++i) beta = beta*(nSnap+i)/i;
+  return beta;
+}
+
+unsigned long CCheckpointStore::GetCheckpointOffset(unsigned long nSteps, unsigned long nSnap) {
+
+  if (nSnap < 2 || nSteps < 2) return nSteps;
+
+  /*--- Smallest number of repetitions for which the steps can be reversed. ---*/
+
+  unsigned long nRep = 0;
+  while (Beta(nSnap, nRep) < nSteps) ++nRep;
+
+  /*--- The steps after the new snapshot are reversed with one snapshot less and nRep repetitions,
+   *    the steps before it with all snapshots and nRep-1 repetitions, take the new snapshot as
+   *    early as the first condition allows. ---*/
+
+  const auto nAfter = Beta(nSnap-1, nRep);
+
+  return (nSteps > nAfter)? nSteps - nAfter : 1;
+}
+
+std::vector<int> CCheckpointStore::GetRecomputeSchedule(int base, int iter, unsigned short nLevels) const {
+
+  std::vector<int> steps;
+  for (int iStep = std::max(base+1, iter-nLevels+1); iStep <= iter; ++iStep) steps.push_back(iStep);
+
+  /*--- Number of checkpoints, what is left after storing the states of iter, plus the base. ---*/
+
+  unsigned long nNew = 0;
+  for (auto iStep : steps) if (!Has(iStep)) ++nNew;
+
+  const auto nUsed = snapshots.size() + nNew;
+  const auto nFree = (capacity > nUsed)? capacity - nUsed : 0;
+  unsigned long nSnap = 1 + nFree/(nLevels-1);
+
+  int next = base + GetCheckpointOffset(iter-base, nSnap);
+
+  while (next < iter) {
+    for (int iStep = std::max(base+1, next-nLevels+2); iStep <= next; ++iStep) steps.push_back(iStep);
+    --nSnap;
+    next += GetCheckpointOffset(iter-next, nSnap);
+  }
+
+  std::sort(steps.begin(), steps.end());
+  steps.erase(std::unique(steps.begin(), steps.end()), steps.end());
+  return steps;
+}
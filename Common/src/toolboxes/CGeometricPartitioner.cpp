@@ -0,0 +1,203 @@
+/*!
+ * \file CGeometricPartitioner.cpp
+ * \brief Implementation of the Hilbert space-filling curve partitioner.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CGeometricPartitioner.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+CGeometricPartitioner::CGeometricPartitioner(unsigned short val_nDim, int val_nParts,
+                                             SU2_MPI::Comm val_comm) :
+  nDim(val_nDim), nParts(val_nParts), comm(val_comm) {
+
+  if (nDim != 2 && nDim != 3)
+    SU2_MPI::Error("The geometric partitioner only supports 2D and 3D points.", CURRENT_FUNCTION);
+  if (nParts < 1)
+    SU2_MPI::Error("The number of parts must be positive.", CURRENT_FUNCTION);
+}
+
+CGeometricPartitioner::KeyType CGeometricPartitioner::HilbertKey(unsigned short nDim, unsigned short nBits,
+                                                                 const uint32_t* intCoord) {
+  /*--- Convert the coordinates to the "transposed" Hilbert index,
+   *    J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004. ---*/
+
+  uint32_t X[3] = {0, 0, 0};
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) X[iDim] = intCoord[iDim];
+
+  const uint32_t M = uint32_t(1) << (nBits-1);
+
+  /*--- Inverse undo. ---*/
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    const uint32_t P = Q-1;
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      if (X[iDim] & Q) {
+        X[0] ^= P;
+      }
+      else {
+        const uint32_t t = (X[0] ^ X[iDim]) & P;
+        X[0] ^= t;
+        X[iDim] ^= t;
+      }
+    }
+  }
+
+  /*--- Gray encode. ---*/
+  for (unsigned short iDim = 1; iDim < nDim; ++iDim) X[iDim] ^= X[iDim-1];
+
+  uint32_t t = 0;
+  for (uint32_t Q = M; Q > 1; Q >>= 1)
+    if (X[nDim-1] & Q) t ^= Q-1;
+
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) X[iDim] ^= t;
+
+  /*--- Interleave the bits of the transposed index, most significant first. ---*/
+  KeyType key = 0;
+  for (int iBit = nBits-1; iBit >= 0; --iBit)
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      key = (key << 1) | ((X[iDim] >> iBit) & 1);
+
+  return key;
+}
+
+std::vector<CGeometricPartitioner::KeyType> CGeometricPartitioner::ComputeKeys(unsigned long nPoint,
+                                                                               const passivedouble* coord) const {
+  /*--- Global bounding box of the point set. ---*/
+
+  passivedouble minCoord[3], maxCoord[3], tmp[3];
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+    minCoord[iDim] = std::numeric_limits<passivedouble>::max();
+    maxCoord[iDim] = std::numeric_limits<passivedouble>::lowest();
+  }
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      minCoord[iDim] = std::min(minCoord[iDim], coord[iPoint*nDim+iDim]);
+      maxCoord[iDim] = std::max(maxCoord[iDim], coord[iPoint*nDim+iDim]);
+    }
+  }
+
+  SU2_MPI::Allreduce(minCoord, tmp, nDim, MPI_DOUBLE, MPI_MIN, comm);
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) minCoord[iDim] = tmp[iDim];
+  SU2_MPI::Allreduce(maxCoord, tmp, nDim, MPI_DOUBLE, MPI_MAX, comm);
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) maxCoord[iDim] = tmp[iDim];
+
+  /*--- Map the coordinates to integers and compute the keys. ---*/
+
+  const unsigned short nBits = BitsPerDim();
+  const passivedouble maxInt = passivedouble((uint32_t(1) << nBits) - 1);
+
+  passivedouble scale[3];
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+    const passivedouble range = maxCoord[iDim] - minCoord[iDim];
+    scale[iDim] = (range > 0.0)? maxInt / range : 0.0;
+  }
+
+  std::vector<KeyType> keys(nPoint);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    uint32_t intCoord[3] = {0, 0, 0};
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      const passivedouble x = (coord[iPoint*nDim+iDim] - minCoord[iDim]) * scale[iDim];
+      intCoord[iDim] = uint32_t(std::min(std::max(x, 0.0), maxInt));
+    }
+    keys[iPoint] = HilbertKey(nDim, nBits, intCoord);
+  }
+
+  return keys;
+}
+
+std::vector<int> CGeometricPartitioner::Partition(unsigned long nPoint, const passivedouble* coord,
+                                                  const passivedouble* weight) const {
+
+  std::vector<int> part(nPoint, 0);
+
+  const auto keys = ComputeKeys(nPoint, coord);
+
+  if (nParts == 1) return part;
+
+  /*--- Sort the local points along the curve and compute the cumulative weight. ---*/
+
+  std::vector<unsigned long> order(nPoint);
+  std::iota(order.begin(), order.end(), 0ul);
+  std::sort(order.begin(), order.end(), [&keys](unsigned long a, unsigned long b) { return keys[a] < keys[b]; });
+
+  std::vector<KeyType> sortedKeys(nPoint);
+  std::vector<passivedouble> cumWeight(nPoint+1, 0.0);
+
+  for (unsigned long i = 0; i < nPoint; ++i) {
+    sortedKeys[i] = keys[order[i]];
+    cumWeight[i+1] = cumWeight[i] + (weight? weight[order[i]] : 1.0);
+  }
+
+  passivedouble totalWeight = 0.0;
+  SU2_MPI::Allreduce(&cumWeight[nPoint], &totalWeight, 1, MPI_DOUBLE, MPI_SUM, comm);
+
+  /*--- Find the nParts-1 cuts by simultaneous bisection of the key space. For each cut we
+   *    look for the smallest key such that the weight of the points with keys up to and
+   *    including it reaches the target weight. Only the partial weights are reduced. ---*/
+
+  const int nCuts = nParts-1;
+  const int nKeyBits = nDim*BitsPerDim();
+  const KeyType maxKey = (KeyType(1) << nKeyBits) - 1;
+  const passivedouble tol = 1e-12 * totalWeight;
+
+  std::vector<KeyType> lower(nCuts, 0), upper(nCuts, maxKey);
+  std::vector<passivedouble> target(nCuts), localWeight(nCuts), globalWeight(nCuts);
+
+  for (int iCut = 0; iCut < nCuts; ++iCut)
+    target[iCut] = totalWeight * (iCut+1) / nParts;
+
+  /*--- The search converges in at most nKeyBits+1 steps, the decisions are based on
+   *    reduced values so all ranks take the same path and exit together. ---*/
+
+  for (int iter = 0; iter <= nKeyBits; ++iter) {
+
+    bool converged = true;
+    for (int iCut = 0; iCut < nCuts; ++iCut) {
+      const KeyType mid = lower[iCut] + (upper[iCut]-lower[iCut])/2;
+      const auto pos = std::upper_bound(sortedKeys.begin(), sortedKeys.end(), mid) - sortedKeys.begin();
+      localWeight[iCut] = cumWeight[pos];
+      converged &= (lower[iCut] == upper[iCut]);
+    }
+    if (converged) break;
+
+    SU2_MPI::Allreduce(localWeight.data(), globalWeight.data(), nCuts, MPI_DOUBLE, MPI_SUM, comm);
+
+    for (int iCut = 0; iCut < nCuts; ++iCut) {
+      if (lower[iCut] == upper[iCut]) continue;
+      const KeyType mid = lower[iCut] + (upper[iCut]-lower[iCut])/2;
+      if (globalWeight[iCut] >= target[iCut] - tol) upper[iCut] = mid;
+      else lower[iCut] = mid+1;
+    }
+  }
+
+  /*--- The cuts are monotonic, the part of a point is the number of cuts strictly below its key. ---*/
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint)
+    part[iPoint] = std::lower_bound(upper.begin(), upper.end(), keys[iPoint]) - upper.begin();
+
+  return part;
+}
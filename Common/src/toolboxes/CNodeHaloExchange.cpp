@@ -0,0 +1,327 @@
+/*!
+ * \file CNodeHaloExchange.cpp
+ * \brief Implementation of the node-aware halo exchange.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CNodeHaloExchange.hpp"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <array>
+#include <cstring>
+
+#ifdef HAVE_NODE_HALO_EXCHANGE
+
+CNodeHaloExchange::CNodeHaloExchange(int nSend, const int* neighborsSend, const int* nPointSend,
+                                     int nRecv, const int* neighborsRecv, const int* nPointRecv) :
+  sendPeer(neighborsSend, neighborsSend+nSend), sendOffset(nPointSend, nPointSend+nSend+1),
+  recvPeer(neighborsRecv, neighborsRecv+nRecv), recvOffset(nPointRecv, nPointRecv+nRecv+1) {
+
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+
+  /*--- The exchanges synchronize the ranks of a node, but the callers skip the comms when a rank
+   *  has no sends or no receives. Those ranks, and by extension their neighbors (a rank must
+   *  exchange all its messages in the same way), keep using point-to-point messages. ---*/
+
+  std::vector<int> flags(size);
+  int isActive = (nSend > 0) && (nRecv > 0);
+
+  for (int dropped = 1; dropped != 0; ) {
+    SU2_MPI::Allgather(&isActive, 1, MPI_INT, flags.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+    int drop = 0;
+    for (int iSend = 0; iSend < nSend; ++iSend) drop |= isActive && !flags[neighborsSend[iSend]];
+    for (int iRecv = 0; iRecv < nRecv; ++iRecv) drop |= isActive && !flags[neighborsRecv[iRecv]];
+    if (drop) isActive = 0;
+
+    SU2_MPI::Allreduce(&drop, &dropped, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+  }
+  active = (isActive != 0);
+
+  /*--- Communicator of the active ranks that can share memory, and of the node leaders. ---*/
+
+  MPI_Comm_split_type(MPI_COMM_WORLD, active? MPI_COMM_TYPE_SHARED : MPI_UNDEFINED, rank, MPI_INFO_NULL, &nodeComm);
+  if (active) {
+    SU2_MPI::Comm_rank(nodeComm, &nodeRank);
+    SU2_MPI::Comm_size(nodeComm, &nodeSize);
+  }
+
+  MPI_Comm_split(MPI_COMM_WORLD, (active && nodeRank == 0)? 0 : MPI_UNDEFINED, rank, &leaderComm);
+
+  int node = -1;
+  if (active) {
+    if (nodeRank == 0) SU2_MPI::Comm_rank(leaderComm, &node);
+    SU2_MPI::Bcast(&node, 1, MPI_INT, 0, nodeComm);
+  }
+
+  /*--- Node, and rank within the node, of every rank. ---*/
+
+  int myInfo[2] = {node, nodeRank};
+  std::vector<int> allInfo(2*size);
+  SU2_MPI::Allgather(myInfo, 2, MPI_INT, allInfo.data(), 2, MPI_INT, MPI_COMM_WORLD);
+
+  if (!active) return;
+
+  auto nodeRankOf = [&](int iRank) { return (allInfo[2*iRank] == node)? allInfo[2*iRank+1] : -1; };
+
+  peerNodeRankSend.resize(nSend);
+  peerNodeRankRecv.resize(nRecv);
+  for (int iSend = 0; iSend < nSend; ++iSend) peerNodeRankSend[iSend] = nodeRankOf(sendPeer[iSend]);
+  for (int iRecv = 0; iRecv < nRecv; ++iRecv) peerNodeRankRecv[iRecv] = nodeRankOf(recvPeer[iRecv]);
+
+  /*--- Tell the neighbors on the node where our messages start in our buffers,
+   the send offset is needed for forward comms, the recv offset for reverse ones. ---*/
+
+  peerSendOffset.assign(nRecv, -1);
+  peerRecvOffset.assign(nSend, -1);
+
+  std::vector<SU2_MPI::Request> req;
+  req.reserve(2*(nSend+nRecv));
+
+  for (int iSend = 0; iSend < nSend; ++iSend) {
+    const int peer = peerNodeRankSend[iSend];
+    if (peer < 0) continue;
+    req.emplace_back(); SU2_MPI::Isend(&sendOffset[iSend], 1, MPI_INT, peer, 0, nodeComm, &req.back());
+    req.emplace_back(); SU2_MPI::Irecv(&peerRecvOffset[iSend], 1, MPI_INT, peer, 1, nodeComm, &req.back());
+  }
+  for (int iRecv = 0; iRecv < nRecv; ++iRecv) {
+    const int peer = peerNodeRankRecv[iRecv];
+    if (peer < 0) continue;
+    req.emplace_back(); SU2_MPI::Irecv(&peerSendOffset[iRecv], 1, MPI_INT, peer, 0, nodeComm, &req.back());
+    req.emplace_back(); SU2_MPI::Isend(&recvOffset[iRecv], 1, MPI_INT, peer, 1, nodeComm, &req.back());
+  }
+  SU2_MPI::Waitall(req.size(), req.data(), MPI_STATUS_IGNORE);
+
+  /*--- Size of the send buffers of the node, to locate the recv buffers in the window. ---*/
+
+  nSendPointNode.resize(nodeSize);
+  SU2_MPI::Allgather(&sendOffset[nSend], 1, MPI_INT, nSendPointNode.data(), 1, MPI_INT, nodeComm);
+
+  /*--- The leader needs to know all messages that leave or enter the node. Each is
+   described by {source, destination, node rank of the local end, offset, size}. ---*/
+
+  using Record = std::array<int,5>;
+  std::vector<int> myRecords;
+
+  for (int iSend = 0; iSend < nSend; ++iSend) {
+    if (peerNodeRankSend[iSend] >= 0) continue;
+    const Record rec = {{rank, sendPeer[iSend], nodeRank, sendOffset[iSend], sendOffset[iSend+1]-sendOffset[iSend]}};
+    myRecords.insert(myRecords.end(), rec.begin(), rec.end());
+  }
+  for (int iRecv = 0; iRecv < nRecv; ++iRecv) {
+    if (peerNodeRankRecv[iRecv] >= 0) continue;
+    const Record rec = {{recvPeer[iRecv], rank, nodeRank, recvOffset[iRecv], recvOffset[iRecv+1]-recvOffset[iRecv]}};
+    myRecords.insert(myRecords.end(), rec.begin(), rec.end());
+  }
+
+  int nMyRecords = myRecords.size();
+  std::vector<int> nRecords(nodeSize), displ(nodeSize+1, 0);
+  SU2_MPI::Allgather(&nMyRecords, 1, MPI_INT, nRecords.data(), 1, MPI_INT, nodeComm);
+  for (int iRank = 0; iRank < nodeSize; ++iRank) displ[iRank+1] = displ[iRank] + nRecords[iRank];
+
+  std::vector<int> allRecords(displ[nodeSize]);
+  SU2_MPI::Allgatherv(myRecords.data(), nMyRecords, MPI_INT, allRecords.data(),
+                      nRecords.data(), displ.data(), MPI_INT, nodeComm);
+
+  if (nodeRank != 0) return;
+
+  /*--- Group the messages by remote node, within each group they are sorted by (source, destination)
+   which gives the same order on both sides since there is one message per pair of ranks. ---*/
+
+  std::map<int, std::vector<Record> > outgoing, incoming;
+  std::set<int> nodes;
+
+  for (size_t iPos = 0; iPos < allRecords.size(); iPos += 5) {
+    Record rec;
+    std::copy(&allRecords[iPos], &allRecords[iPos]+5, rec.begin());
+    const bool isSend = (allInfo[2*rec[0]] == node);
+    const int remote = allInfo[2*rec[isSend? 1 : 0]];
+    (isSend? outgoing : incoming)[remote].push_back(rec);
+    nodes.insert(remote);
+  }
+
+  remoteNodes.assign(nodes.begin(), nodes.end());
+  leaderOut.resize(remoteNodes.size());
+  leaderIn.resize(remoteNodes.size());
+  leaderReq.resize(2*remoteNodes.size());
+
+  auto toSegments = [](std::vector<Record>& records, std::vector<Segment>& segments) {
+    std::sort(records.begin(), records.end());
+    for (const auto& rec : records) segments.push_back({rec[2], rec[3], rec[4]});
+  };
+
+  for (size_t iNode = 0; iNode < remoteNodes.size(); ++iNode) {
+    toSegments(outgoing[remoteNodes[iNode]], leaderOut[iNode]);
+    toSegments(incoming[remoteNodes[iNode]], leaderIn[iNode]);
+  }
+
+}
+
+CNodeHaloExchange::~CNodeHaloExchange() {
+  if (window != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(window);
+    MPI_Win_free(&window);
+  }
+  if (leaderComm != MPI_COMM_NULL) MPI_Comm_free(&leaderComm);
+  if (nodeComm != MPI_COMM_NULL) MPI_Comm_free(&nodeComm);
+}
+
+void CNodeHaloExchange::Allocate(unsigned short countPerPoint, su2double*& bufSend, su2double*& bufRecv) {
+
+  if (window != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(window);
+    MPI_Win_free(&window);
+  }
+
+  allocCount = countPerPoint;
+
+  const size_t nValues = size_t(sendOffset.back() + recvOffset.back()) * allocCount;
+
+  su2double* base = nullptr;
+  MPI_Win_allocate_shared(nValues*sizeof(su2double), sizeof(su2double), MPI_INFO_NULL,
+                          nodeComm, &base, &window);
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, window);
+
+  nodeBase.resize(nodeSize);
+  for (int iRank = 0; iRank < nodeSize; ++iRank) {
+    MPI_Aint winSize;
+    int dispUnit;
+    MPI_Win_shared_query(window, iRank, &winSize, &dispUnit, &nodeBase[iRank]);
+  }
+
+  std::fill(base, base+nValues, su2double(0.0));
+
+  bufSend = Buffer(nodeRank, false);
+  bufRecv = Buffer(nodeRank, true);
+}
+
+void CNodeHaloExchange::Exchange(unsigned short countPerPoint, bool reverse) {
+
+  /*--- Make the buffers loaded by all ranks of the node visible. ---*/
+
+  MPI_Win_sync(window);
+  SU2_MPI::Barrier(nodeComm);
+  MPI_Win_sync(window);
+
+  /*--- The leader aggregates the messages to and from other nodes. In reverse mode the
+   recv buffers are sent (incoming segments) and the send buffers updated (outgoing segments). ---*/
+
+  const int nRemote = remoteNodes.size();
+
+  if (nRemote > 0) {
+    const auto& packList = reverse? leaderIn : leaderOut;
+    const auto& unpackList = reverse? leaderOut : leaderIn;
+
+    std::vector<size_t> packOffset(nRemote+1, 0), unpackOffset(nRemote+1, 0);
+    for (int iNode = 0; iNode < nRemote; ++iNode) {
+      packOffset[iNode+1] = packOffset[iNode];
+      for (const auto& seg : packList[iNode]) packOffset[iNode+1] += size_t(seg.nPoint)*countPerPoint;
+      unpackOffset[iNode+1] = unpackOffset[iNode];
+      for (const auto& seg : unpackList[iNode]) unpackOffset[iNode+1] += size_t(seg.nPoint)*countPerPoint;
+    }
+    leaderBufSend.resize(std::max(leaderBufSend.size(), packOffset[nRemote]));
+    leaderBufRecv.resize(std::max(leaderBufRecv.size(), unpackOffset[nRemote]));
+
+    for (int iNode = 0; iNode < nRemote; ++iNode) {
+      SU2_MPI::Irecv(&leaderBufRecv[unpackOffset[iNode]], unpackOffset[iNode+1]-unpackOffset[iNode],
+                     MPI_DOUBLE, remoteNodes[iNode], 0, leaderComm, &leaderReq[iNode]);
+    }
+
+    for (int iNode = 0; iNode < nRemote; ++iNode) {
+      su2double* buf = &leaderBufSend[packOffset[iNode]];
+      for (const auto& seg : packList[iNode]) {
+        const su2double* src = Buffer(seg.nodeRank, reverse) + size_t(seg.offset)*countPerPoint;
+        buf = std::copy(src, src+size_t(seg.nPoint)*countPerPoint, buf);
+      }
+      SU2_MPI::Isend(&leaderBufSend[packOffset[iNode]], packOffset[iNode+1]-packOffset[iNode],
+                     MPI_DOUBLE, remoteNodes[iNode], 0, leaderComm, &leaderReq[nRemote+iNode]);
+    }
+
+    SU2_MPI::Waitall(2*nRemote, leaderReq.data(), MPI_STATUS_IGNORE);
+
+    for (int iNode = 0; iNode < nRemote; ++iNode) {
+      const su2double* buf = &leaderBufRecv[unpackOffset[iNode]];
+      for (const auto& seg : unpackList[iNode]) {
+        const size_t count = size_t(seg.nPoint)*countPerPoint;
+        std::copy(buf, buf+count, Buffer(seg.nodeRank, !reverse) + size_t(seg.offset)*countPerPoint);
+        buf += count;
+      }
+    }
+  }
+
+  /*--- Each rank copies the messages from its neighbors on the node. ---*/
+
+  if (!reverse) {
+    for (size_t iRecv = 0; iRecv < recvPeer.size(); ++iRecv) {
+      const int peer = peerNodeRankRecv[iRecv];
+      if (peer < 0) continue;
+      const su2double* src = Buffer(peer, false) + size_t(peerSendOffset[iRecv])*countPerPoint;
+      const size_t count = size_t(recvOffset[iRecv+1]-recvOffset[iRecv])*countPerPoint;
+      std::copy(src, src+count, Buffer(nodeRank, true) + size_t(recvOffset[iRecv])*countPerPoint);
+    }
+  }
+  else {
+    for (size_t iSend = 0; iSend < sendPeer.size(); ++iSend) {
+      const int peer = peerNodeRankSend[iSend];
+      if (peer < 0) continue;
+      const su2double* src = Buffer(peer, true) + size_t(peerRecvOffset[iSend])*countPerPoint;
+      const size_t count = size_t(sendOffset[iSend+1]-sendOffset[iSend])*countPerPoint;
+      std::copy(src, src+count, Buffer(nodeRank, false) + size_t(sendOffset[iSend])*countPerPoint);
+    }
+  }
+
+  /*--- Nobody reads or writes the buffers of other ranks after this point. ---*/
+
+  MPI_Win_sync(window);
+  SU2_MPI::Barrier(nodeComm);
+  MPI_Win_sync(window);
+}
+
+#else
+
+CNodeHaloExchange::CNodeHaloExchange(int, const int*, const int*, int, const int*, const int*) {
+  SU2_MPI::Error("Node-aware halo exchange requires MPI and is not available in AD builds.", CURRENT_FUNCTION);
+}
+
+CNodeHaloExchange::~CNodeHaloExchange() {}
+
+void CNodeHaloExchange::Allocate(unsigned short, su2double*&, su2double*&) {}
+
+void CNodeHaloExchange::Exchange(unsigned short, bool) {}
+
+#endif
+
+int CNodeHaloExchange::WaitAny(unsigned short countPerPoint, bool reverse) {
+
+  /*--- All the data arrives at once, the messages are then returned in order. ---*/
+
+  if (nextMessage == 0) Exchange(countPerPoint, reverse);
+
+  const auto& peers = reverse? sendPeer : recvPeer;
+  if (peers.empty()) return -1;
+
+  return peers[(nextMessage++) % peers.size()];
+}
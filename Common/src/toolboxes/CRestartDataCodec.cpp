@@ -0,0 +1,346 @@
+/*!
+ * \file CRestartDataCodec.cpp
+ * \brief Implementation of the encoding of SU2 binary restart files.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CRestartDataCodec.hpp"
+#include "../../include/option_structure.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace {
+
+/*!
+ * \brief Maximum number of bytes per MPI read call, the counts of MPI are ints.
+ */
+constexpr unsigned long MAX_READ_SIZE = 1ul<<30;
+
+/*!
+ * \brief Read bytes at an offset of the file (called by one rank).
+ */
+void ReadAt(CRestartDataCodec::FileHandle file, unsigned long offset, void* buf, unsigned long size) {
+#ifdef HAVE_MPI
+  auto bytes = static_cast<char*>(buf);
+  for (auto pos = 0ul; pos < size; pos += MAX_READ_SIZE) {
+    const auto chunk = std::min(MAX_READ_SIZE, size-pos);
+    MPI_File_read_at(file, MPI_Offset(offset+pos), bytes+pos, int(chunk), MPI_BYTE, MPI_STATUS_IGNORE);
+  }
+#else
+  if (fseek(file, offset, SEEK_SET) || fread(buf, 1, size, file) != size)
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+#endif
+}
+
+/*!
+ * \brief Read a set of increasing byte ranges of the file into a contiguous buffer (collective).
+ * \note With MPI the ranges are read in chunks of at most MAX_READ_SIZE bytes (large ranges are split),
+ *       every rank makes the same number of (collective) read calls.
+ */
+void ReadRanges(CRestartDataCodec::FileHandle file, unsigned long disp, const std::vector<unsigned long>& offsets,
+                const std::vector<unsigned long>& sizes, char* buf) {
+#ifdef HAVE_MPI
+  /*--- Blocks of the file types, and the first block of each chunk. ---*/
+
+  std::vector<MPI_Aint> displace;
+  std::vector<int> lengths;
+  std::vector<unsigned long> chunkBegin(1, 0);
+  unsigned long chunkSize = 0;
+
+  for (auto i = 0ul; i < sizes.size(); ++i) {
+    auto offset = offsets[i];
+    auto remaining = sizes[i];
+
+    while (remaining > 0) {
+      if (chunkSize == MAX_READ_SIZE) {
+        chunkBegin.push_back(displace.size());
+        chunkSize = 0;
+      }
+      const auto length = std::min(remaining, MAX_READ_SIZE-chunkSize);
+      displace.push_back(MPI_Aint(offset));
+      lengths.push_back(int(length));
+      chunkSize += length;
+      offset += length;
+      remaining -= length;
+    }
+  }
+  chunkBegin.push_back(displace.size());
+
+  unsigned long nChunk = chunkBegin.size()-1, nChunkMax = 0;
+  SU2_MPI::Allreduce(&nChunk, &nChunkMax, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+
+  for (auto iChunk = 0ul; iChunk < nChunkMax; ++iChunk) {
+
+    /*--- Ranks with fewer chunks take part in the collective reads with empty ones. ---*/
+
+    const auto begin = (iChunk < nChunk)? chunkBegin[iChunk] : displace.size();
+    const auto end = (iChunk < nChunk)? chunkBegin[iChunk+1] : displace.size();
+
+    int total = 0;
+    for (auto k = begin; k < end; ++k) total += lengths[k];
+
+    MPI_Datatype filetype;
+    MPI_Type_create_hindexed(int(end-begin), lengths.data()+begin, displace.data()+begin, MPI_BYTE, &filetype);
+    MPI_Type_commit(&filetype);
+
+    MPI_File_set_view(file, MPI_Offset(disp), MPI_BYTE, filetype, (char*)"native", MPI_INFO_NULL);
+    MPI_File_read_all(file, buf, total, MPI_BYTE, MPI_STATUS_IGNORE);
+    buf += total;
+
+    MPI_Type_free(&filetype);
+  }
+
+  /*--- Reset the view for the reads that may follow. ---*/
+
+  MPI_File_set_view(file, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
+#else
+  for (auto i = 0ul; i < sizes.size(); ++i) {
+    ReadAt(file, disp+offsets[i], buf, sizes[i]);
+    buf += sizes[i];
+  }
+#endif
+}
+
+}
+
+CRestartDataCodec::CRestartDataCodec(std::vector<char> singlePrecision) : singlePrec(std::move(singlePrecision)) {
+
+  fieldOffset.reserve(singlePrec.size());
+  for (auto single : singlePrec) {
+    fieldOffset.push_back(recordSize);
+    recordSize += single? sizeof(float) : sizeof(passivedouble);
+  }
+}
+
+void CRestartDataCodec::Encode(const passivedouble* values, unsigned long nPoints, char* records) const {
+
+  const auto nFields = singlePrec.size();
+
+  for (auto iPoint = 0ul; iPoint < nPoints; ++iPoint) {
+    const auto pointValues = &values[iPoint*nFields];
+    const auto record = &records[iPoint*recordSize];
+
+    for (auto iField = 0ul; iField < nFields; ++iField) {
+      if (singlePrec[iField]) {
+        const auto value = static_cast<float>(pointValues[iField]);
+        memcpy(&record[fieldOffset[iField]], &value, sizeof(float));
+      }
+      else {
+        memcpy(&record[fieldOffset[iField]], &pointValues[iField], sizeof(passivedouble));
+      }
+    }
+  }
+}
+
+void CRestartDataCodec::Decode(const char* record, passivedouble* values) const {
+
+  for (auto iField = 0ul; iField < singlePrec.size(); ++iField) {
+    if (singlePrec[iField]) {
+      float value;
+      memcpy(&value, &record[fieldOffset[iField]], sizeof(float));
+      values[iField] = value;
+    }
+    else {
+      memcpy(&values[iField], &record[fieldOffset[iField]], sizeof(passivedouble));
+    }
+  }
+}
+
+void CRestartDataCodec::Compress(const char* records, unsigned long nPoints, int level,
+                                 std::vector<unsigned long>& blockTable, std::vector<char>& data) const {
+#ifdef HAVE_ZLIB
+  for (auto iPoint = 0ul; iPoint < nPoints; iPoint += BLOCK_SIZE) {
+
+    const auto nPointBlock = std::min<unsigned long>(BLOCK_SIZE, nPoints-iPoint);
+    const uLong size = nPointBlock*recordSize;
+
+    const auto start = data.size();
+    uLongf compressedSize = compressBound(size);
+    data.resize(start + compressedSize);
+
+    if (compress2(reinterpret_cast<Bytef*>(&data[start]), &compressedSize,
+                  reinterpret_cast<const Bytef*>(&records[iPoint*recordSize]), size, level) != Z_OK)
+      SU2_MPI::Error("Compression of the restart data failed.", CURRENT_FUNCTION);
+
+    data.resize(start + compressedSize);
+    blockTable.push_back(nPointBlock);
+    blockTable.push_back(compressedSize);
+  }
+#else
+  SU2_MPI::Error("SU2 was compiled without zlib support, restart files cannot be compressed.", CURRENT_FUNCTION);
+#endif
+}
+
+void CRestartDataCodec::Read(FileHandle file, unsigned long disp, int flags, int nFields, unsigned long nPointGlobal,
+                             const std::vector<unsigned long>& points, passivedouble* data) {
+
+  const bool compressed = (flags & COMPRESSED);
+
+  if (compressed && !CompressionSupported())
+    SU2_MPI::Error("The restart file is compressed and SU2 was compiled without zlib support.", CURRENT_FUNCTION);
+
+  const int rank = SU2_MPI::GetRank();
+
+  /*--- The master reads the tables that precede the data and broadcasts them. ---*/
+
+  std::vector<char> singlePrecision(nFields, 0);
+
+  if (flags & MIXED_PRECISION) {
+    if (rank == MASTER_NODE) ReadAt(file, disp, singlePrecision.data(), nFields);
+    SU2_MPI::Bcast(singlePrecision.data(), nFields, MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+    disp += nFields;
+  }
+
+  const CRestartDataCodec codec(std::move(singlePrecision));
+  const auto recordSize = codec.GetRecordSize();
+
+  unsigned long nBlock = 0;
+  std::vector<unsigned long> blockTable;
+
+  if (compressed) {
+    if (rank == MASTER_NODE) ReadAt(file, disp, &nBlock, sizeof(unsigned long));
+    SU2_MPI::Bcast(&nBlock, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+    disp += sizeof(unsigned long);
+
+    blockTable.resize(2*nBlock);
+    if (rank == MASTER_NODE) ReadAt(file, disp, blockTable.data(), blockTable.size()*sizeof(unsigned long));
+    SU2_MPI::Bcast(blockTable.data(), blockTable.size(), MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+    disp += blockTable.size()*sizeof(unsigned long);
+  }
+
+  /*--- Position of the record of each point in the file, and the position of the point in
+   the output (the records are read in increasing order of their position). ---*/
+
+  std::vector<unsigned long> records(points), slots(points.size());
+  for (auto iPoint = 0ul; iPoint < points.size(); ++iPoint) slots[iPoint] = iPoint;
+
+  std::vector<unsigned long> offsets, sizes;
+
+  const auto addRange = [&](unsigned long offset, unsigned long size) {
+    if (!offsets.empty() && offsets.back()+sizes.back() == offset) sizes.back() += size;
+    else {
+      offsets.push_back(offset);
+      sizes.push_back(size);
+    }
+  };
+
+  if (flags & PARTITIONED) {
+
+    /*--- The records are in the order of the writer partitions, read the entries of the
+     index map (one per global point, after the data) of the points of this rank. ---*/
+
+    unsigned long dataSize = nPointGlobal*recordSize;
+    if (compressed) {
+      dataSize = 0;
+      for (auto iBlock = 0ul; iBlock < nBlock; ++iBlock) dataSize += blockTable[2*iBlock+1];
+    }
+
+    for (auto point : points) addRange(point*sizeof(unsigned long), sizeof(unsigned long));
+    ReadRanges(file, disp+dataSize, offsets, sizes, reinterpret_cast<char*>(records.data()));
+    offsets.clear();
+    sizes.clear();
+
+    std::vector<std::pair<unsigned long, unsigned long> > order(points.size());
+    for (auto iPoint = 0ul; iPoint < points.size(); ++iPoint) order[iPoint] = {records[iPoint], iPoint};
+    sort(order.begin(), order.end());
+
+    for (auto iPoint = 0ul; iPoint < points.size(); ++iPoint) {
+      records[iPoint] = order[iPoint].first;
+      slots[iPoint] = order[iPoint].second;
+    }
+  }
+
+  if (!compressed) {
+
+    /*--- Read the records of the points directly, merging consecutive records. ---*/
+
+    for (auto record : records) addRange(record*recordSize, recordSize);
+
+    std::vector<char> buffer(records.size()*recordSize);
+    ReadRanges(file, disp, offsets, sizes, buffer.data());
+
+    for (auto iPoint = 0ul; iPoint < records.size(); ++iPoint)
+      codec.Decode(&buffer[iPoint*recordSize], &data[slots[iPoint]*nFields]);
+
+    return;
+  }
+
+#ifdef HAVE_ZLIB
+  /*--- Find the blocks that contain the records of this rank, both are sorted. ---*/
+
+  std::vector<unsigned long> blocks, blockFirstRecord;
+  unsigned long firstRecord = 0, offset = 0;
+  auto iPoint = 0ul;
+
+  for (auto iBlock = 0ul; iBlock < nBlock; ++iBlock) {
+    const auto nRecordBlock = blockTable[2*iBlock];
+    const auto size = blockTable[2*iBlock+1];
+
+    if (iPoint < records.size() && records[iPoint] < firstRecord+nRecordBlock) {
+      blocks.push_back(iBlock);
+      blockFirstRecord.push_back(firstRecord);
+      offsets.push_back(offset);
+      sizes.push_back(size);
+      while (iPoint < records.size() && records[iPoint] < firstRecord+nRecordBlock) ++iPoint;
+    }
+    firstRecord += nRecordBlock;
+    offset += size;
+  }
+
+  if (firstRecord != nPointGlobal)
+    SU2_MPI::Error("The block table of the restart file is inconsistent with its number of points.", CURRENT_FUNCTION);
+
+  unsigned long totalSize = 0;
+  for (auto size : sizes) totalSize += size;
+
+  std::vector<char> compressedData(totalSize);
+  ReadRanges(file, disp, offsets, sizes, compressedData.data());
+
+  /*--- Inflate the blocks and extract the records of this rank. ---*/
+
+  std::vector<char> buffer;
+  const char* blockData = compressedData.data();
+  iPoint = 0;
+
+  for (auto i = 0ul; i < blocks.size(); ++i) {
+    const auto nRecordBlock = blockTable[2*blocks[i]];
+    uLongf size = nRecordBlock*recordSize;
+    if (buffer.size() < size) buffer.resize(size);
+
+    if (uncompress(reinterpret_cast<Bytef*>(buffer.data()), &size,
+                   reinterpret_cast<const Bytef*>(blockData), sizes[i]) != Z_OK || size != nRecordBlock*recordSize)
+      SU2_MPI::Error("Decompression of the restart data failed.", CURRENT_FUNCTION);
+
+    blockData += sizes[i];
+
+    for (; iPoint < records.size() && records[iPoint] < blockFirstRecord[i]+nRecordBlock; ++iPoint)
+      codec.Decode(&buffer[(records[iPoint]-blockFirstRecord[i])*recordSize], &data[slots[iPoint]*nFields]);
+  }
+#endif
+
+}
@@ -0,0 +1,169 @@
+/*!
+ * \file affinity_toolbox.cpp
+ * \brief Functions to query and report the binding of threads to cores.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/affinity_toolbox.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/mpi_structure.hpp"
+#include "../../include/omp_structure.hpp"
+#include "../../include/option_structure.hpp"
+
+#include <vector>
+#include <map>
+#include <sstream>
+#include <cstdlib>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+namespace {
+
+std::string GetHostName() {
+#if !defined(_WIN32)
+  char name[256] = {};
+  if (gethostname(name, sizeof(name)-1) == 0) return name;
+#endif
+  return "unknown";
+}
+
+}
+
+int AffinityToolbox::GetCurrentCpu() {
+#if defined(__linux__)
+  return sched_getcpu();
+#else
+  return -1;
+#endif
+}
+
+std::string AffinityToolbox::GetCpuList() {
+#if defined(__linux__)
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  if (sched_getaffinity(0, sizeof(mask), &mask) != 0) return "n/a";
+
+  /*--- Compress consecutive CPUs into ranges. ---*/
+
+  std::ostringstream list;
+  int first = -1;
+
+  for (int iCpu = 0; iCpu <= CPU_SETSIZE; ++iCpu) {
+    const bool isSet = (iCpu < CPU_SETSIZE) && CPU_ISSET(iCpu, &mask);
+    if (isSet && first < 0) first = iCpu;
+    if (!isSet && first >= 0) {
+      if (list.tellp() > 0) list << ",";
+      list << first;
+      if (iCpu-1 > first) list << "-" << iCpu-1;
+      first = -1;
+    }
+  }
+  return list.str();
+#else
+  return "n/a";
+#endif
+}
+
+void AffinityToolbox::PrintThreadBinding(std::ostream& out) {
+
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+  const int nThread = omp_get_max_threads();
+
+  /*--- Each thread queries its own placement. ---*/
+
+  std::vector<int> cpu(nThread, -1);
+  std::vector<std::string> cpuList(nThread, "n/a");
+
+  SU2_OMP_PARALLEL
+  {
+    const int thread = omp_get_thread_num();
+    cpu[thread] = GetCurrentCpu();
+    cpuList[thread] = GetCpuList();
+  }
+
+  /*--- One record per thread, the records of each rank are gathered as
+   *    a fixed size (the largest over all ranks) string on the master. ---*/
+
+  const auto host = GetHostName();
+  std::ostringstream records;
+  for (int thread = 0; thread < nThread; ++thread)
+    records << host << " " << thread << " " << cpu[thread] << " " << cpuList[thread] << "\n";
+
+  std::string local = records.str();
+  int length = local.size()+1, maxLength = 0;
+  SU2_MPI::Allreduce(&length, &maxLength, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+  local.resize(maxLength, '\0');
+
+  std::vector<char> all((rank == MASTER_NODE)? size_t(maxLength)*size : 1);
+  SU2_MPI::Gather(&local[0], maxLength, MPI_CHAR, all.data(), maxLength, MPI_CHAR,
+                  MASTER_NODE, SU2_MPI::GetComm());
+
+  if (rank != MASTER_NODE) return;
+
+  const char* procBind = std::getenv("OMP_PROC_BIND");
+  const char* places = std::getenv("OMP_PLACES");
+
+  out << "\n-------------------------- Thread Binding --------------------------" << std::endl;
+  out << "OMP_PROC_BIND=" << (procBind? procBind : "(unset)")
+      << ", OMP_PLACES=" << (places? places : "(unset)") << std::endl;
+
+  PrintingToolbox::CTablePrinter table(&out);
+  table.AddColumn("Host", 20);
+  table.AddColumn("Rank", 8);
+  table.AddColumn("Thread", 8);
+  table.AddColumn("CPU", 8);
+  table.AddColumn("Allowed CPUs", 20);
+  table.PrintHeader();
+
+  /*--- Count the threads that currently run on each CPU of each host. ---*/
+
+  std::map<std::pair<std::string,int>, int> threadsPerCpu;
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    std::istringstream rankRecords(std::string(&all[size_t(iRank)*maxLength]));
+    std::string recHost, recList;
+    int recThread, recCpu;
+    while (rankRecords >> recHost >> recThread >> recCpu >> recList) {
+      table << recHost << iRank << recThread << recCpu << recList;
+      if (recCpu >= 0) ++threadsPerCpu[std::make_pair(recHost, recCpu)];
+    }
+  }
+  table.PrintFooter();
+
+  int nShared = 0;
+  for (const auto& entry : threadsPerCpu)
+    if (entry.second > 1) nShared += entry.second;
+
+  if (nShared > 0) {
+    out << "WARNING: " << nShared << " threads are running on a CPU shared with other threads.\n"
+        << "         Consider pinning threads (e.g. OMP_PROC_BIND=close OMP_PLACES=cores) and\n"
+        << "         checking the binding options of the MPI launcher." << std::endl;
+  }
+  out << std::endl;
+}
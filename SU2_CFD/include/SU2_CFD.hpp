@@ -29,6 +29,7 @@
 
 #include "../../Common/include/mpi_structure.hpp"
 #include "../../Common/include/omp_structure.hpp"
+#include "../../Common/include/toolboxes/affinity_toolbox.hpp"
 #include "CLI11.hpp"
 
 #include "drivers/CDriver.hpp"
@@ -29,6 +29,8 @@
 #pragma once
 #include "CSinglezoneDriver.hpp"
 
+class CCheckpointStore;
+
 /*!
  * \class CDiscAdjSinglezoneDriver
  * \brief Class for driving single-zone adjoint solvers.
@@ -55,6 +57,58 @@ protected:
 
   COutputLegacy* output_legacy;
 
+  CCheckpointStore* checkpoints = nullptr;      /*!< \brief Direct solutions kept in memory by the unsteady adjoint.*/
+  unsigned short nTimeLevels = 0;               /*!< \brief Number of direct solutions used by a time step (current and previous).*/
+  vector<unsigned short> primalSolvers;         /*!< \brief Solvers whose solution makes up a direct solution.*/
+  map<int, bool> restartOnDisk;                 /*!< \brief Whether the restart file of a direct time step exists.*/
+
+  /*!
+   * \brief Whether the direct solution of a time step can be loaded without recomputing it.
+   * \param[in] iter - Direct time iteration (negative iterations are the freestream).
+   */
+  bool PrimalSolutionAvailable(int iter);
+
+  /*!
+   * \brief Whether all the time levels used by the adjoint of a time step are available.
+   * \param[in] iter - Direct time iteration.
+   */
+  bool PrimalTimeLevelsAvailable(int iter);
+
+  /*!
+   * \brief Load the direct solution of a time step from memory, from its restart file, or set the freestream.
+   * \param[in] iter - Direct time iteration.
+   * \param[in] keep - Keep a solution read from file in memory if there is space.
+   */
+  void LoadPrimalSolution(int iter, bool keep);
+
+  /*!
+   * \brief Keep the current direct solution in memory.
+   * \param[in] iter - Direct time iteration of the solution.
+   */
+  void StorePrimalSolution(int iter);
+
+  /*!
+   * \brief Load the solution of a time step and of the previous time levels into the direct solvers.
+   * \param[in] iter - Direct time iteration.
+   * \param[in] nLevels - Number of solutions to load (nTimeLevels for the adjoint, one less to advance from iter).
+   * \param[in] keep - Keep the solutions read from file in memory if there is space.
+   */
+  void SetPrimalTimeLevels(int iter, unsigned short nLevels, bool keep);
+
+  /*!
+   * \brief Recompute the direct problem up to a time step, from the latest time step that can be loaded.
+   * \note The solutions are kept in memory at the positions of the binomial checkpointing schedule,
+   *       such that the time steps before iter can be reversed with few recomputations.
+   * \param[in] iter - Direct time iteration.
+   */
+  void RecomputePrimal(int iter);
+
+  /*!
+   * \brief Make the time levels of a direct time step available (recomputing them if needed) and load them.
+   * \param[in] iter - Direct time iteration.
+   */
+  void PreparePrimalSolution(int iter);
+
 public:
 
   /*!
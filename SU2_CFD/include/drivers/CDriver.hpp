@@ -102,6 +102,8 @@ protected:
             PyWrapNodalForceDensity[3],         /*!< \brief This is used to store the force density at each vertex. */
             PyWrapNodalHeatFlux[3];             /*!< \brief This is used to store the heat flux at each vertex. */
   bool dry_run;                                 /*!< \brief Flag if SU2_CFD was started as dry-run via "SU2_CFD -d <config>.cfg" */
+  vector<unsigned long> Repart_GlobalIndex,     /*!< \brief Global index of the points colored by the load balancer. */
+                        Repart_Color;           /*!< \brief Color (new rank) of those points, empty when using the regular partitioner. */
 
 public:
 
@@ -252,6 +254,21 @@ protected:
    */
   void StaticMesh_Preprocessing(CConfig *config, CGeometry **geometry, CSurfaceMovement *surface_movement);
 
+  /*!
+   * \brief Measure the load imbalance between ranks and repartition the zone if it exceeds the tolerance.
+   * \param[in] val_iZone - Zone to balance.
+   * \param[in] computeTime - Compute time of this rank since the last check (excluding MPI wait time).
+   */
+  void LoadBalance(unsigned short val_iZone, passivedouble computeTime);
+
+  /*!
+   * \brief Repartition a zone in-process, the grid is re-distributed along a space-filling curve weighted
+   *        by the measured cost of each rank, and the solution of all solvers is migrated to the new partition.
+   * \param[in] val_iZone - Zone to repartition.
+   * \param[in] computeTime - Compute time of this rank, used to weight its points.
+   */
+  void Repartition(unsigned short val_iZone, passivedouble computeTime);
+
   /*!
    * \brief Initiate value for static mesh movement such as the gridVel for the ROTATING frame.
    */
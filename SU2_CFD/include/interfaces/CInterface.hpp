@@ -68,9 +68,42 @@ protected:
   su2double *SpanValueCoeffTarget = nullptr;
   unsigned short *SpanLevelDonor = nullptr;
   unsigned short nSpanMaxAllZones = 0;
+  vector<int> mixingPlaneOwner;   /*!< \brief Rank that sends the averages of each mixing-plane marker (-1 if unknown). */
 
   unsigned short nVar = 0;
 
+  /*!
+   * \brief Point-to-point communication of the donor values of an interface marker.
+   * \note Built from the donor points (global index and owner rank) that the interpolator stores
+   *       in the target vertices, each rank only exchanges values with the ranks that need them.
+   *       Donors on the rank of their target are not part of the exchange, their values are copied
+   *       directly after the received ones.
+   */
+  struct CTransferPattern {
+    bool built = false;                 /*!< \brief Whether the pattern is up to date. */
+    vector<unsigned long> donorVertex;  /*!< \brief Donor vertices of this rank whose values are sent. */
+    vector<int> sendRank;               /*!< \brief Ranks that receive values from this rank. */
+    vector<unsigned long> sendStart;    /*!< \brief Start of the values of each of those ranks in sendIndex. */
+    vector<unsigned long> sendIndex;    /*!< \brief Position in donorVertex of each value sent. */
+    vector<int> recvRank;               /*!< \brief Ranks that send values to this rank. */
+    vector<unsigned long> recvStart;    /*!< \brief Start of the values of each of those ranks in the receive buffer. */
+    vector<unsigned long> localVertex;  /*!< \brief Donor vertices of this rank used by its own target vertices. */
+    vector<unsigned long> targetStart;  /*!< \brief Start of the donors of each target vertex in donorIndex. */
+    vector<unsigned long> donorIndex;   /*!< \brief Position of each donor point in the receive buffer. */
+  };
+  vector<CTransferPattern> transferPattern; /*!< \brief Pattern of each interface marker. */
+
+  /*!
+   * \brief Build the communication pattern of an interface marker.
+   * \param[out] pattern - The pattern.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] Marker_Donor - Index of the donor marker (-1 if not on this rank).
+   * \param[in] Marker_Target - Index of the target marker (-1 if not on this rank).
+   */
+  void SetTransferPattern(CTransferPattern& pattern, CGeometry *donor_geometry, CGeometry *target_geometry,
+                          int Marker_Donor, int Marker_Target) const;
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -91,7 +124,13 @@ public:
   virtual ~CInterface(void);
 
   /*!
-   * \brief Interpolate data and broadcast it into all processors, for nonmatching meshes.
+   * \brief Discard the communication patterns, they are built again by the next transfer.
+   * \note Must be called when the interpolator changes the donor information (CInterpolator::GetCoeffChanged).
+   */
+  inline void ResetTransferPattern() { transferPattern.clear(); }
+
+  /*!
+   * \brief Send the donor data to the ranks of the target points that use it and interpolate, for nonmatching meshes.
    * \param[in] donor_solution - Solution from the donor mesh.
    * \param[in] target_solution - Solution from the target mesh.
    * \param[in] donor_geometry - Geometry of the donor mesh.
@@ -134,9 +173,9 @@ public:
   }
 
   /*!
-   * \brief Recovers the target variable from the buffer of su2doubles that was broadcasted.
+   * \brief Recovers the target variable from the buffer of received donor values.
    * \param[in] indexPoint_iVertex - index of the vertex in the buffer array.
-   * \param[in] Buffer_Bcast_Variables - full broadcasted buffer array of doubles.
+   * \param[in] Buffer_Bcast_Variables - buffer of the donor values received by this rank.
    * \param[in] donorCoeff - value of the donor coefficient.
    */
   inline virtual void RecoverTarget_Variable(long indexPoint_iVertex, su2double *Buffer_Bcast_Variables,
@@ -196,13 +235,15 @@ public:
                          CConfig *donor_config, CConfig *target_config, unsigned short iMarkerInt);
 
   /*!
-   * \brief Interpolate data and scatter it into different processors, for matching meshes.
+   * \brief Send the span-wise averages of a mixing-plane marker to the target zone and interpolate them.
+   * \note The averages are broadcast, packed, from the lowest rank that has the donor marker.
    * \param[in] donor_solution - Solution from the donor mesh.
    * \param[in] target_solution - Solution from the target mesh.
    * \param[in] donor_geometry - Geometry of the donor mesh.
    * \param[in] target_geometry - Geometry of the target mesh.
    * \param[in] donor_config - Definition of the problem at the donor mesh.
    * \param[in] target_config - Definition of the problem at the target mesh.
+   * \param[in] iMarkerInt - Index of the mixing-plane interface marker.
    */
   void AllgatherAverage(CSolver *donor_solution, CSolver *target_solution,
                         CGeometry *donor_geometry, CGeometry *target_geometry,
@@ -34,7 +34,10 @@
 #include <iomanip>
 #include <limits>
 #include <vector>
+#include <thread>
+#include <atomic>
 
+#include "../../../Common/include/mpi_structure.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "tools/CWindowingTools.hpp"
 #include "../../../Common/include/option_structure.hpp"
@@ -167,6 +170,21 @@ protected:
    surfaceFilename,                     //!< Surface output filename
    restartFilename;                     //!< Restart output filename
 
+   /*----------------------------- Asynchronous output ----------------------------*/
+
+   bool asyncOutput;                    //!< Write the volume output files on a background thread
+   std::thread asyncWriter;             //!< Thread writing the files of the last volume output
+   std::atomic<bool> asyncDone;         //!< Whether the background thread finished writing
+   SU2_MPI::Comm asyncComm;             //!< Duplicate of MPI_COMM_WORLD used by the background thread
+   stringstream asyncWritingText;       //!< File writing table of the background thread (printed by the master)
+   su2double restartBandwidth;          //!< Bandwidth of the restart files written since it was last added to the config
+
+   /*----------------------------- Time series output ----------------------------*/
+
+   bool timeSeriesOutput;               //!< Append the CGNS solution of each time step to one file
+   long volumeSeriesStart,              //!< First time iteration of the volume time series (-1 before it starts)
+   surfaceSeriesStart;                  //!< First time iteration of the surface time series (-1 before it starts)
+
   /** \brief Structure to store information for a volume output field.
    *
    *  The stored information is used to create the volume solution file.
@@ -195,14 +213,21 @@ protected:
 
   /*! \brief Vector to cache the positions of the field in the data array */
   std::vector<short>                            fieldIndexCache;
-  /*! \brief Current value of the cache index */
-  unsigned short                                cachePosition;
   /*! \brief Boolean to store whether the field index cache should be build. */
   bool                                          buildFieldIndexCache;
   /*! \brief Vector to cache the positions of the field in the data array */
   std::vector<short>                            fieldGetIndexCache;
-  /*! \brief Current value of the cache index */
-  unsigned short                                curGetFieldIndex;
+
+  enum : size_t {OMP_MAX_SIZE = 512}; /*!< \brief Max chunk size for the parallel loading of points. */
+
+  /*! \brief Current values of the cache indices of a thread (padded to a cache line). */
+  struct CacheCursor {
+    unsigned short cachePosition = 0;
+    unsigned short curGetFieldIndex = 0;
+    char padding[60];
+  };
+  /*! \brief Cache indices of each thread, the points are loaded in parallel once the caches are built. */
+  std::vector<CacheCursor>                      cacheCursor;
 
   /*! \brief Requested volume field names in the config file. */
   std::vector<string> requestedVolumeFields;
@@ -477,10 +502,56 @@ public:
    */
   void WriteToFile(CConfig *config, CGeometry *geomery, unsigned short format, string fileName = "");
 
+  /*!
+   * \brief Wait for the volume output files being written on the background thread (OUTPUT_ASYNC= YES),
+   *        and print its file writing table.
+   * \param[in] block - If <FALSE>, return immediately when the files are still being written.
+   */
+  void WaitForOutput(bool block = true);
+
+  /*!
+   * \brief Add the bandwidth of the restart files written since the last call to the config,
+   *        unless they are still being written on the background thread.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetRestartBandwidth(CConfig *config);
+
+  /*!
+   * \brief Delete the data sorters, they are allocated again for the current
+   *        partition of the grid the next time output is loaded.
+   */
+  void DeallocateDataSorters();
+
 protected:
 
   /*----------------------------- Protected member functions ----------------------------*/
 
+  /*!
+   * \brief Allocates the appropriate file writer based on the chosen format and writes sorted data to file.
+   * \note The state of the solution is passed explicitly, since the files may be written on a background thread.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] format - The output format.
+   * \param[in] fileName - The file name. If empty, the filenames are automatically determined.
+   * \param[in] timeIter - Time iteration of the data.
+   * \param[in] timeStep - Physical time step of the data.
+   * \param[in] curTime - Physical time of the data.
+   */
+  void WriteToFile(CConfig *config, CGeometry *geometry, unsigned short format, string fileName,
+                   unsigned long timeIter, su2double timeStep, su2double curTime);
+
+  /*!
+   * \brief Write all the requested volume output files from the sorted data, with the file writing table.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] formats - The output formats.
+   * \param[in] timeIter - Time iteration of the data.
+   * \param[in] timeStep - Physical time step of the data.
+   * \param[in] curTime - Physical time of the data.
+   */
+  void WriteVolumeFiles(CConfig *config, CGeometry *geometry, const vector<unsigned short>& formats,
+                        unsigned long timeIter, su2double timeStep, su2double curTime);
+
   /*!
    * \brief Set the history file header
    * \param[in] config - Definition of the particular problem.
@@ -587,21 +658,31 @@ protected:
    * \param[in] name - Name of the field.
    * \param[in] value - The new value of this field.
    */
-  su2double GetVolumeOutputValue(string name, unsigned long iPoint);
+  su2double GetVolumeOutputValue(const string& name, unsigned long iPoint);
 
   /*!
    * \brief Set the value of a volume output field
    * \param[in] name - Name of the field.
    * \param[in] value - The new value of this field.
    */
-  void SetVolumeOutputValue(string name, unsigned long iPoint, su2double value);
+  void SetVolumeOutputValue(const string& name, unsigned long iPoint, su2double value);
+
+  /*!
+   * \brief Set the values of several volume output fields, e.g. the solution or the coordinates of a point.
+   * \note When the fields are stored consecutively the values are copied in bulk.
+   * \param[in] names - Names of the fields.
+   * \param[in] iPoint - Index of the point.
+   * \param[in] values - The new values of the fields.
+   * \param[in] nValues - Number of fields.
+   */
+  void SetVolumeOutputValue(const string* names, unsigned long iPoint, const su2double* values, unsigned short nValues);
 
   /*!
    * \brief Set the value of a volume output field
    * \param[in] name - Name of the field.
    * \param[in] value - The new value of this field.
    */
-  void SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2double value);
+  void SetAvgVolumeOutputValue(const string& name, unsigned long iPoint, su2double value);
 
   /*!
    * \brief CheckHistoryOutput
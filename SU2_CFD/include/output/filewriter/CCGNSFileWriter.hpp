@@ -0,0 +1,116 @@
+/*!
+ * \file CCGNSFileWriter.hpp
+ * \brief Headers for the CGNS file writer class.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CCGNSFileWriter
+ * \brief Writes the sorted volume or surface data to a single unstructured zone of a CGNS file.
+ * \note Every rank writes the points of its linear partition and its elements directly into the
+ *       global arrays of the file (one section per element type). When the CGNS library is built
+ *       with parallel HDF5 the arrays are written collectively, otherwise the ranks take turns
+ *       writing their ranges with the partial write functions, so the data is never gathered.
+ *       As a time series, the solution is appended to the file as a new FlowSolution node and the
+ *       mesh is only written by the first step.
+ */
+class CCGNSFileWriter final: public CFileWriter{
+
+private:
+
+  unsigned short compression; /*!< \brief Deflate level of the data (HDF5 only). */
+
+  bool timeSeries = false;        /*!< \brief Whether the solution is a step of a time series. */
+  bool newSeries = true;          /*!< \brief Whether the step starts the series (creates the file and mesh). */
+  unsigned long timeIter = 0;     /*!< \brief Time iteration of the step. */
+  passivedouble physicalTime = 0; /*!< \brief Physical time of the step. */
+
+  /*!
+   * \brief Data that is the same for all ranks, and the ranges of the data of this rank.
+   */
+  struct CLayout {
+    int cellDim = 0;                       /*!< \brief Dimension of the cells. */
+    unsigned long nCellGlobal = 0;         /*!< \brief Number of cells (elements of dimension cellDim). */
+    vector<unsigned short> types;          /*!< \brief Element types present in the file, one section each. */
+    vector<unsigned long> sectionStart;    /*!< \brief First element of each section. */
+    vector<unsigned long> sectionEnd;      /*!< \brief Last element of each section. */
+    vector<unsigned long> localStart;      /*!< \brief First element of this rank in each section. */
+  };
+
+  /*!
+   * \brief Compute the layout of the file from the element counts of all ranks.
+   */
+  CLayout ComputeLayout() const;
+
+  /*!
+   * \brief Write the data of this rank, collectively if parallel CGNS is available.
+   * \param[in] layout - Layout of the file (only used when the mesh is written).
+   * \param[in] master - Whether this call writes the structure of the file (always true with parallel CGNS).
+   */
+  void WritePartition(const CLayout& layout, bool master);
+
+  /*!
+   * \brief Add the step to the iterative data of the base and zone, replacing the steps it rewinds.
+   * \note The solutions of the replaced steps (including a previous one of this step) are deleted.
+   * \param[in] fn - Index of the open file.
+   */
+  void WriteIterativeData(int fn) const;
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Construct a file writer using field names and the data sorter.
+   * \param[in] valFileName - The name of the file
+   * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valCompression - Deflate level of the data (0 for none)
+   */
+  CCGNSFileWriter(string valFileName, CParallelDataSorter* valDataSorter, unsigned short valCompression = 0);
+
+  /*!
+   * \brief Destructor
+   */
+  ~CCGNSFileWriter() override;
+
+  /*!
+   * \brief Write the solution as a step of a time series instead of a stand-alone file.
+   * \param[in] valTimeIter - Time iteration of the step.
+   * \param[in] valPhysicalTime - Physical time of the step.
+   * \param[in] valNewSeries - Whether the step starts the series, otherwise it is appended to the file.
+   */
+  void SetTimeSeries(unsigned long valTimeIter, passivedouble valPhysicalTime, bool valNewSeries);
+
+  /*!
+   * \brief Write sorted data to file in CGNS file format
+   */
+  void Write_Data() override;
+
+};
@@ -145,6 +145,11 @@ public:
 
 protected:
 
+  /*!
+   * \brief Communicator used by the file writers on the calling thread (see CParallelDataSorter::GetOutputComm).
+   */
+  static SU2_MPI::Comm GetOutputComm() { return CParallelDataSorter::GetOutputComm(); }
+
   /*!
    * \brief Collectively write a binary data array distributed over all processors to file using MPI I/O.
    * \param[in] data - Pointer to the data to write.
@@ -155,6 +160,17 @@ protected:
    */
   bool WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBytes, unsigned long totalSizeInBytes, unsigned long offset);
 
+  /*!
+   * \brief Collectively write a binary data array whose chunks are scattered within a global array using MPI I/O.
+   * \param[in] data - Pointer to the data to write (the chunks one after the other).
+   * \param[in] chunkSizes - The size in bytes of each chunk.
+   * \param[in] chunkOffsets - The offset in bytes of each chunk within the global array (increasing).
+   * \param[in] totalSizeInBytes - The total size of the array accumulated over all processors.
+   * \return Boolean indicating whether the writing was successful.
+   */
+  bool WriteMPIBinaryDataAll(const void *data, const vector<int>& chunkSizes,
+                             const vector<unsigned long>& chunkOffsets, unsigned long totalSizeInBytes);
+
   /*!
    * \brief Write a binary data array to a currently opened file using MPI I/O. Note: routine must be called collectively,
    * although only one processor writes its data.
@@ -94,6 +94,7 @@ protected:
   /// Pointer used to allocate the memory used for ::passiveDoubleBuffer and ::doubleBuffer.
   char *dataBuffer;
   unsigned long *idSend;               //!< Send buffer holding global indices that will be send to other processors
+  vector<unsigned long> globalIDBeforeSort; //!< Global indices of the local points before sorting
   int nSends,                          //!< Number of sends
   nRecvs;                              //!< Number of receives
 
@@ -109,8 +110,23 @@ protected:
    */
   void PrepareSendBuffers(std::vector<unsigned long>& globalID);
 
+  static thread_local SU2_MPI::Comm outputComm;  //!< Communicator of the sorters and file writers on the calling thread
+
 public:
 
+  /*!
+   * \brief Get the communicator used for sorting and writing output on the calling thread.
+   * \note MPI_COMM_WORLD, except on the thread of the asynchronous output which uses a duplicate,
+   *       so that its collectives do not interfere with those of the solver.
+   */
+  static SU2_MPI::Comm GetOutputComm() { return outputComm; }
+
+  /*!
+   * \brief Set the communicator used for sorting and writing output on the calling thread.
+   * \param[in] comm - Communicator with the same ranks as MPI_COMM_WORLD.
+   */
+  static void SetOutputComm(SU2_MPI::Comm comm) { outputComm = comm; }
+
   /*!
    * \brief Constructor
    * \param[in] config - Pointer to the current config structure
@@ -156,6 +172,12 @@ public:
    */
   unsigned long GetnLocalPointsBeforeSort() const {return nLocalPointsBeforeSort;}
 
+  /*!
+   * \brief Get the global number of points to sort.
+   * \return Global number of points.
+   */
+  unsigned long GetnGlobalPointsBeforeSort() const {return nGlobalPointBeforeSort;}
+
   /*!
    * \brief Get the global number of points (accumulated from all ranks)
    * \return Global number of points.
@@ -308,10 +330,31 @@ public:
     connSend[Index[iPoint] + iField] = data;
   }
 
+  /*!
+   * \brief Set the values of consecutive fields at a point.
+   * \param[in] iPoint - ID of the point
+   * \param[in] iField - Index of the first field
+   * \param[in] nData - Number of fields
+   * \param[in] data - Values of the fields
+   */
+  void SetUnsorted_Data(unsigned long iPoint, unsigned short iField, unsigned short nData, const su2double* data){
+    su2double* dest = &connSend[Index[iPoint] + iField];
+    for (unsigned short iData = 0; iData < nData; iData++) dest[iData] = data[iData];
+  }
+
   su2double GetUnsorted_Data(unsigned long iPoint, unsigned short iField) const {
     return connSend[Index[iPoint] + iField];
   }
 
+  /*!
+   * \brief Get the global index of a point before sorting.
+   * \param[in] iPoint - ID of the point
+   * \return Global index of the point.
+   */
+  unsigned long GetUnsorted_GlobalIndex(unsigned long iPoint) const {
+    return globalIDBeforeSort[iPoint];
+  }
+
   /*!
    * \brief Get the Processor ID a Point belongs to.
    * \param[in] iPoint - global renumbered ID of the point
@@ -30,6 +30,17 @@
 
 class CSU2BinaryFileWriter final: public CFileWriter{
 
+private:
+
+  vector<char> singlePrecision; /*!< \brief Whether each field is stored as a float (empty for all doubles). */
+  unsigned short compression;   /*!< \brief Deflate level of the data (0 for none). */
+  bool partitioned;             /*!< \brief Write the unsorted data of each rank followed by an index map. */
+
+  /*!
+   * \brief Write the precision table and the encoded (possibly compressed) point data, see CRestartDataCodec.
+   * \param[in] flags - Flags of the encoding.
+   */
+  void WriteEncodedData(int flags);
 
 public:
 
@@ -42,8 +53,13 @@ public:
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valFileName - The name of the file
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valSinglePrecision - Whether each field is stored as a float (empty for all doubles)
+   * \param[in] valCompression - Deflate level of the data (0 for none)
+   * \param[in] valPartitioned - Write the data of each rank before sorting, followed by an index map
    */
-  CSU2BinaryFileWriter(string valFileName, CParallelDataSorter* valDataSorter);
+  CSU2BinaryFileWriter(string valFileName, CParallelDataSorter* valDataSorter,
+                       vector<char> valSinglePrecision = {}, unsigned short valCompression = 0,
+                       bool valPartitioned = false);
 
   /*!
    * \brief Destructor
@@ -29,6 +29,7 @@
 
 #include "CSolver.hpp"
 #include "../../../Common/include/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
 
 /*!
  * \class CFEASolver
@@ -61,6 +62,8 @@ protected:
   su2double WAitken_Dyn;            /*!< \brief Aitken's dynamic coefficient. */
   su2double WAitken_Dyn_tn1;        /*!< \brief Aitken's dynamic coefficient in the previous iteration. */
 
+  CQuasiNewtonInvLeastSquares<passivedouble> fsiCorrector; /*!< \brief IQN-ILS accelerator of the FSI coupling. */
+
   su2double PenaltyValue;           /*!< \brief Penalty value to maintain total stiffness constant. */
 
   su2double Total_OFRefGeom;        /*!< \brief Total Objective Function: Reference Geometry. */
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "CSolver.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 /*!
  * \class CFEM_DG_EulerSolver
@@ -43,7 +44,7 @@ protected:
   su2double Gamma;           /*!< \brief Fluid's Gamma constant (ratio of specific heats). */
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
-  CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
+  vector<CFluidModel*> FluidModel; /*!< \brief Fluid model used in the solver, one per thread. */
 
   su2double
   Mach_Inf,         /*!< \brief Mach number at infinity. */
@@ -324,7 +325,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CFluidModel* GetFluidModel(void) const final { return FluidModel;}
+  inline CFluidModel* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
   /*!
    * \brief Compute the density at the infinity.
@@ -1566,6 +1567,34 @@ private:
    */
   void SetUpTaskList(CConfig *config);
 
+  /*!
+   * \brief Function, which determines whether or not a task calls MPI. These
+            tasks are only carried out by the master thread.
+   * \param[in] task - Task to be checked.
+   * \return True if the task initiates or completes a communication.
+   */
+  static inline bool IsCommunicationTask(const CTaskDefinition::SOLVER_TASK task) {
+    return (task == CTaskDefinition::INITIATE_MPI_COMMUNICATION) ||
+           (task == CTaskDefinition::COMPLETE_MPI_COMMUNICATION) ||
+           (task == CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION) ||
+           (task == CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION);
+  }
+
+  /*!
+   * \brief Function, which carries out a single task of the list.
+   * \param[in]  iTask     - Index of the task in tasksList.
+   * \param[in]  waitComm  - Whether or not to block on the completion of a communication.
+   * \param[in]  numerics  - Description of the numerical method.
+   * \param[in]  config    - Definition of the particular problem.
+   * \param[out] workArray - Work array of the calling thread.
+   * \return False if a communication could not be completed (only when waitComm is false).
+   */
+  bool ProcessTask_DG(const unsigned long iTask,
+                      const bool          waitComm,
+                      CNumerics           **numerics,
+                      CConfig             *config,
+                      su2double           *workArray);
+
   /*!
    * \brief Function, which sets up the persistent communication of the flow
             variables in the DOFs.
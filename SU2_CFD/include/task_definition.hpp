@@ -30,6 +30,7 @@
 #include "../../Common/include/mpi_structure.hpp"
 
 #include <iostream>
+#include <algorithm>
 
 using namespace std;
 
@@ -71,13 +72,15 @@ public:
     ADER_UPDATE_SOLUTION                              = 21    /*!< \brief Update the solution for the ADER scheme. */
   };
 
+  enum : unsigned short {MAX_IND_MUST_BE_COMPLETED = 8}; /*!< \brief Maximum number of tasks a task can depend on. */
+
   SOLVER_TASK    task;                  /*!< \brief Task to be carried out. */
   unsigned short timeLevel;             /*!< \brief Time level of the task to be carried out. */
   unsigned short intPointADER;          /*!< \brief Time integration point for ADER, if relevant for the task. */
   bool           secondPartTimeIntADER; /*!< \brief Whether or not this is the second part of the time interval for elements
                                                     adjacent to a lower time level. */
   unsigned short nIndMustBeCompleted;   /*!< \brief Number of relevant indices in indMustBeCompleted. */
-  int            indMustBeCompleted[5]; /*!< \brief Indices in the list of tasks that must be completed before this task can be carried out. */
+  int            indMustBeCompleted[MAX_IND_MUST_BE_COMPLETED]; /*!< \brief Indices in the list of tasks that must be completed before this task can be carried out. */
 
   /*!
    * \brief Constructor of the class.
@@ -108,6 +111,13 @@ public:
    */
   ~CTaskDefinition(void);
 
+  /*!
+   * \brief Function, which adds a task that must be completed before this task
+            can be carried out, on top of the ones given to the constructor.
+   * \param[in] val_indMustBeCompleted - Index of the task, nothing is added if it is negative.
+   */
+  void AddIndMustBeCompleted(const int val_indMustBeCompleted);
+
   /*!
    * \brief Copy constructor of the class.
    */
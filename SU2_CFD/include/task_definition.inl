@@ -31,7 +31,7 @@ inline CTaskDefinition::CTaskDefinition(void) {
   task                = NO_TASK;
   timeLevel           = 0;
   nIndMustBeCompleted = 0;
-  for(int i=0; i<5; ++i) indMustBeCompleted[i] = -1;
+  for(int i=0; i<MAX_IND_MUST_BE_COMPLETED; ++i) indMustBeCompleted[i] = -1;
 
   intPointADER = 0;
   secondPartTimeIntADER = false;
@@ -53,6 +53,7 @@ inline CTaskDefinition::CTaskDefinition(SOLVER_TASK    val_task,
   indMustBeCompleted[2] = val_ind2MustBeCompleted;
   indMustBeCompleted[3] = val_ind3MustBeCompleted;
   indMustBeCompleted[4] = val_ind4MustBeCompleted;
+  for(int i=5; i<MAX_IND_MUST_BE_COMPLETED; ++i) indMustBeCompleted[i] = -1;
 
   /* Make sure that the -1 values are numbered last. */
   sort(indMustBeCompleted, indMustBeCompleted+5, greater<int>());
@@ -69,6 +70,23 @@ inline CTaskDefinition::CTaskDefinition(SOLVER_TASK    val_task,
 
 inline CTaskDefinition::~CTaskDefinition(void) {}
 
+inline void CTaskDefinition::AddIndMustBeCompleted(const int val_indMustBeCompleted) {
+
+  /* Negative indices correspond to tasks that are not present. */
+  if(val_indMustBeCompleted < 0) return;
+
+  /* Check if the index is already in the list. */
+  for(unsigned short i=0; i<nIndMustBeCompleted; ++i)
+    if(indMustBeCompleted[i] == val_indMustBeCompleted) return;
+
+  /* Add the index, keeping the list in descending order. */
+  if(nIndMustBeCompleted == MAX_IND_MUST_BE_COMPLETED)
+    SU2_MPI::Error(string("Too many dependencies for a task, increase MAX_IND_MUST_BE_COMPLETED"),
+                   CURRENT_FUNCTION);
+  indMustBeCompleted[nIndMustBeCompleted++] = val_indMustBeCompleted;
+  sort(indMustBeCompleted, indMustBeCompleted+nIndMustBeCompleted, greater<int>());
+}
+
 inline CTaskDefinition::CTaskDefinition(const CTaskDefinition &other){Copy(other);}
 
 inline CTaskDefinition& CTaskDefinition::operator=(const CTaskDefinition &other){Copy(other); return (*this);}
@@ -80,6 +98,6 @@ inline void CTaskDefinition::Copy(const CTaskDefinition &other) {
   secondPartTimeIntADER = other.secondPartTimeIntADER;
   nIndMustBeCompleted   = other.nIndMustBeCompleted;
 
-  for(int i=0; i<5; ++i)
+  for(int i=0; i<MAX_IND_MUST_BE_COMPLETED; ++i)
     indMustBeCompleted[i] = other.indMustBeCompleted[i];
 }
@@ -43,6 +43,7 @@ int main(int argc, char *argv[]) {
   bool dry_run = false;
   int num_threads = omp_get_max_threads();
   bool use_thread_mult = false;
+  bool print_binding = false;
   std::string filename = "default.cfg";
 
   /*--- Command line parsing ---*/
@@ -52,6 +53,7 @@ int main(int argc, char *argv[]) {
                                        "Only execute preprocessing steps using a dummy geometry.");
   app.add_option("-t,--threads", num_threads, "Number of OpenMP threads per MPI rank.");
   app.add_flag("--thread_multiple", use_thread_mult, "Request MPI_THREAD_MULTIPLE thread support.");
+  app.add_flag("--print_binding", print_binding, "Report the binding of the threads of each rank to CPUs.");
   app.add_option("configfile", filename, "A config file.")->check(CLI::ExistingFile);
 
   CLI11_PARSE(app, argc, argv)
@@ -76,6 +78,11 @@ int main(int argc, char *argv[]) {
   SU2_Comm MPICommunicator(0);
 #endif
 
+  /*--- Report where the threads run, data is first touched by the threads that
+   *    use it, which is only effective if they do not migrate. ---*/
+
+  if (print_binding) AffinityToolbox::PrintThreadBinding(cout);
+
   /*--- Uncomment the following line if runtime NaN catching is desired. ---*/
   // feenableexcept(FE_INVALID | FE_OVERFLOW);
 
@@ -33,6 +33,10 @@
 #include "../../include/iteration/CIterationFactory.hpp"
 #include "../../include/iteration/CTurboIteration.hpp"
 #include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
+#include "../../../Common/include/toolboxes/CCheckpointStore.hpp"
+
+#include <fstream>
+#include <algorithm>
 
 CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
                                                    unsigned short val_nZone,
@@ -115,12 +119,24 @@ CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
 
  direct_output->PreprocessHistoryOutput(config, false);
 
+  /*--- Keep the direct solutions of the unsteady adjoint in memory. ---*/
+
+  if (config->GetTime_Domain() && (config->GetUnst_AdjCheckpoints() > 0)) {
+    checkpoints = new CCheckpointStore(config->GetUnst_AdjCheckpoints(), config->GetUnst_AdjCheckpoint_Compression());
+    nTimeLevels = (config->GetTime_Marching() == DT_STEPPING_2ND)? 3 : 2;
+
+    primalSolvers.push_back(FLOW_SOL);
+    if (config->GetKind_Turb_Model() != NONE) primalSolvers.push_back(TURB_SOL);
+    if (config->GetWeakly_Coupled_Heat()) primalSolvers.push_back(HEAT_SOL);
+  }
+
 }
 
 CDiscAdjSinglezoneDriver::~CDiscAdjSinglezoneDriver(void) {
 
   delete direct_iteration;
   delete direct_output;
+  delete checkpoints;
 
 }
 
@@ -128,6 +144,14 @@ void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
   config_container[ZONE_0]->SetTimeIter(TimeIter);
 
+  /*--- With in-memory checkpoints the driver loads the direct solutions of the time step,
+   *--- recomputing them if needed, instead of the iteration reading them from file. ---*/
+
+  if (checkpoints) {
+    PreparePrimalSolution(SU2_TYPE::Int(config->GetUnst_AdjointIter()) - static_cast<int>(TimeIter) - 1);
+    config_container[ZONE_0]->SetTimeIter(TimeIter);
+  }
+
   /*--- NOTE: Inv Design Routines moved to CDiscAdjFluidIteration::Preprocess ---*/
 
   /*--- Preprocess the adjoint iteration ---*/
@@ -570,3 +594,163 @@ void CDiscAdjSinglezoneDriver::SecondaryRecording(){
   AD::ClearAdjoints();
 
 }
+
+bool CDiscAdjSinglezoneDriver::PrimalSolutionAvailable(int iter) {
+
+  if (iter < 0 || checkpoints->Has(iter)) return true;
+
+  /*--- The master checks once whether the restart file of the time step exists. ---*/
+
+  auto it = restartOnDisk.find(iter);
+  if (it == restartOnDisk.end()) {
+    int exists = 0;
+    if (rank == MASTER_NODE) {
+      string fileName = config->GetFilename(config->GetSolution_FileName(), "", iter);
+      fileName += config->GetRead_Binary_Restart()? ".dat" : ".csv";
+      exists = ifstream(fileName).good();
+    }
+    SU2_MPI::Bcast(&exists, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+    it = restartOnDisk.emplace(iter, exists != 0).first;
+  }
+  return it->second;
+}
+
+bool CDiscAdjSinglezoneDriver::PrimalTimeLevelsAvailable(int iter) {
+
+  for (int iLevel = 0; iLevel < nTimeLevels; iLevel++)
+    if (!PrimalSolutionAvailable(iter-iLevel)) return false;
+  return true;
+}
+
+void CDiscAdjSinglezoneDriver::LoadPrimalSolution(int iter, bool keep) {
+
+  if (!checkpoints->Has(iter)) {
+    iteration->LoadUnsteady_Solution(geometry_container, solver_container, config_container, ZONE_0, INST_0, iter);
+
+    if (keep && iter >= 0 && checkpoints->GetnSnapshots() < checkpoints->GetCapacity()) StorePrimalSolution(iter);
+    return;
+  }
+
+  vector<passivedouble> values;
+  checkpoints->Load(iter, values);
+
+  auto value = values.begin();
+
+  for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+    for (auto iSol : primalSolvers) {
+      CSolver* sol = solver_container[ZONE_0][INST_0][iMesh][iSol];
+      if (sol == nullptr) continue;
+      for (auto iPoint = 0ul; iPoint < geometry_container[ZONE_0][INST_0][iMesh]->GetnPoint(); iPoint++)
+        for (auto iVar = 0u; iVar < sol->GetnVar(); iVar++)
+          sol->GetNodes()->SetSolution(iPoint, iVar, *(value++));
+    }
+  }
+
+  /*--- Update the auxiliary variables as after reading a restart file (halos are part of the snapshot). ---*/
+
+  for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+    CGeometry* geo = geometry_container[ZONE_0][INST_0][iMesh];
+    CSolver** sol = solver_container[ZONE_0][INST_0][iMesh];
+
+    sol[FLOW_SOL]->Preprocessing(geo, sol, config, iMesh, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+    if (config->GetKind_Turb_Model() != NONE && sol[TURB_SOL])
+      sol[TURB_SOL]->Postprocessing(geo, sol, config, iMesh);
+    if (config->GetWeakly_Coupled_Heat() && sol[HEAT_SOL])
+      sol[HEAT_SOL]->Preprocessing(geo, sol, config, iMesh, NO_RK_ITER, RUNTIME_HEAT_SYS, false);
+  }
+}
+
+void CDiscAdjSinglezoneDriver::StorePrimalSolution(int iter) {
+
+  vector<passivedouble> values;
+
+  for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+    for (auto iSol : primalSolvers) {
+      CSolver* sol = solver_container[ZONE_0][INST_0][iMesh][iSol];
+      if (sol == nullptr) continue;
+      for (auto iPoint = 0ul; iPoint < geometry_container[ZONE_0][INST_0][iMesh]->GetnPoint(); iPoint++)
+        for (auto iVar = 0u; iVar < sol->GetnVar(); iVar++)
+          values.push_back(SU2_TYPE::GetValue(sol->GetNodes()->GetSolution(iPoint, iVar)));
+    }
+  }
+
+  checkpoints->Store(iter, values);
+}
+
+void CDiscAdjSinglezoneDriver::SetPrimalTimeLevels(int iter, unsigned short nLevels, bool keep) {
+
+  auto pushTimeLevels = [&](bool time_n1) {
+    for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+      for (auto iSol : primalSolvers) {
+        CSolver* sol = solver_container[ZONE_0][INST_0][iMesh][iSol];
+        if (sol == nullptr) continue;
+        sol->GetNodes()->Set_Solution_time_n();
+        if (time_n1) sol->GetNodes()->Set_Solution_time_n1();
+      }
+    }
+  };
+
+  if (nLevels == 3) {
+    LoadPrimalSolution(iter-2, keep);
+    pushTimeLevels(true);
+  }
+  if (nLevels >= 2) {
+    LoadPrimalSolution(iter-1, keep);
+    pushTimeLevels(false);
+  }
+  LoadPrimalSolution(iter, keep);
+}
+
+void CDiscAdjSinglezoneDriver::RecomputePrimal(int iter) {
+
+  /*--- Latest time step from which the direct problem can be advanced, Update shifts its solution
+   *--- and the previous one (2nd order) to the time levels, i.e. nTimeLevels-1 solutions are needed. ---*/
+
+  const int base = CCheckpointStore::GetBase(iter, nTimeLevels-1, [this](int i) { return PrimalSolutionAvailable(i); });
+
+  if (rank == MASTER_NODE)
+    cout << " Recomputing the direct solution from time iteration " << base+1 << " to " << iter << "." << endl;
+
+  /*--- Time steps kept in memory, the time levels of iter and the checkpoints of the binomial schedule. ---*/
+
+  const auto stored = checkpoints->GetRecomputeSchedule(base, iter, nTimeLevels);
+
+  /*--- Load the base and advance. ---*/
+
+  const su2double physicalTime = config->GetPhysicalTime();
+
+  SetPrimalTimeLevels(base, nTimeLevels-1, false);
+  direct_iteration->Update(direct_output, integration_container, geometry_container, solver_container, numerics_container,
+                           config_container, surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+
+  for (int iStep = base+1; iStep <= iter; iStep++) {
+
+    config->SetTimeIter(iStep);
+    config->SetPhysicalTime(static_cast<su2double>(iStep)*config->GetDelta_UnstTimeND());
+
+    direct_iteration->Solve(direct_output, integration_container, geometry_container, solver_container, numerics_container,
+                            config_container, surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+
+    if (binary_search(stored.begin(), stored.end(), iStep)) StorePrimalSolution(iStep);
+
+    if (iStep < iter)
+      direct_iteration->Update(direct_output, integration_container, geometry_container, solver_container,
+                               numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                               ZONE_0, INST_0);
+  }
+
+  config->SetPhysicalTime(physicalTime);
+}
+
+void CDiscAdjSinglezoneDriver::PreparePrimalSolution(int iter) {
+
+  /*--- The time steps after iter are no longer needed by the reverse time integration. ---*/
+
+  checkpoints->ReleaseAfter(iter);
+
+  if (!PrimalTimeLevelsAvailable(iter)) RecomputePrimal(iter);
+
+  /*--- Solutions read from file are also used by the next time steps, keep them if there is space. ---*/
+
+  SetPrimalTimeLevels(iter, nTimeLevels, true);
+}
@@ -31,6 +31,7 @@
 #include "../../../Common/include/geometry/CDummyGeometry.hpp"
 #include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
 #include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
+#include "../../../Common/include/toolboxes/CGeometricPartitioner.hpp"
 
 #include "../../include/solvers/CSolverFactory.hpp"
 #include "../../include/solvers/CFEM_DG_EulerSolver.hpp"
@@ -386,6 +387,13 @@ void CDriver::Postprocessing() {
   if (rank == MASTER_NODE)
     cout << endl <<"------------------------- Solver Postprocessing -------------------------" << endl;
 
+  /*--- Finish the asynchronous output before the data it uses is deleted. ---*/
+
+  if (output_container != nullptr) {
+    for (iZone = 0; iZone < nZone; iZone++)
+      if (output_container[iZone] != nullptr) output_container[iZone]->WaitForOutput();
+  }
+
   for (iZone = 0; iZone < nZone; iZone++) {
     for (iInst = 0; iInst < nInst[iZone]; iInst++){
       Numerics_Postprocessing(numerics_container[iZone], solver_container[iZone][iInst],
@@ -754,9 +762,13 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   nDim = geometry_aux->GetnDim();
 
-  /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
+  /*--- Color the initial grid and set the send-receive domains (ParMETIS), unless
+   the colors were computed by the load balancer. ---*/
 
-  geometry_aux->SetColorGrid_Parallel(config);
+  if (Repart_Color.empty())
+    geometry_aux->SetColorGrid_Parallel(config);
+  else
+    geometry_aux->SetColorGrid_Prescribed(config, Repart_GlobalIndex, Repart_Color);
 
   /*--- Allocate the memory of the current domain, and divide the grid
      between the ranks. ---*/
@@ -1066,7 +1078,10 @@ void CDriver::Solver_Preprocessing(CConfig* config, CGeometry** geometry, CSolve
   bool update_geo = true;
   if (config->GetFSI_Simulation()) update_geo = false;
 
-  Solver_Restart(solver, geometry, config, update_geo);
+  /*--- When repartitioning, the solution is migrated from the old partition instead. ---*/
+
+  if (Repart_Color.empty())
+    Solver_Restart(solver, geometry, config, update_geo);
 
   /*--- Set up any necessary inlet profiles ---*/
 
@@ -2604,6 +2619,232 @@ void CDriver::StaticMesh_Preprocessing(CConfig *config, CGeometry** geometry, CS
 
 }
 
+void CDriver::LoadBalance(unsigned short val_iZone, passivedouble computeTime) {
+
+  passivedouble maxTime = 0.0, sumTime = 0.0;
+
+  SU2_MPI::Allreduce(&computeTime, &maxTime, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&computeTime, &sumTime, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+  const passivedouble avgTime = sumTime / size;
+  const passivedouble imbalance = (avgTime > 0.0)? maxTime/avgTime - 1.0 : 0.0;
+
+  if ((size == SINGLE_NODE) || (imbalance <= config_container[val_iZone]->GetLoadImbalance_Tol())) return;
+
+  if (rank == MASTER_NODE) {
+    cout << endl << "Load imbalance of " << 100*imbalance << "% (max/avg rank compute time), ";
+    cout << "repartitioning zone " << val_iZone << "." << endl;
+  }
+
+  Repartition(val_iZone, computeTime);
+
+}
+
+void CDriver::Repartition(unsigned short val_iZone, passivedouble computeTime) {
+
+  /*--- The preprocessing routines use these members. ---*/
+
+  iZone = val_iZone;
+  iInst = INST_0;
+
+  CConfig* config = config_container[iZone];
+  CGeometry** geometry = geometry_container[iZone][iInst];
+  CSolver*** solver = solver_container[iZone][iInst];
+
+  const bool dual_time = ((config->GetTime_Marching() == DT_STEPPING_1ST) ||
+                          (config->GetTime_Marching() == DT_STEPPING_2ND));
+  const unsigned short nStates = dual_time? 3 : 1;
+
+  const unsigned long nPointDomain = geometry[MESH_0]->GetnPointDomain();
+
+  /*--- Compute the new colors, every point of this rank is weighted by the average
+   cost per point of the rank, the partitioner then equalizes the total cost. ---*/
+
+  vector<passivedouble> coord(nPointDomain*nDim);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      coord[iPoint*nDim+iDim] = SU2_TYPE::GetValue(geometry[MESH_0]->nodes->GetCoord(iPoint, iDim));
+
+  const passivedouble pointCost = max(computeTime, 1e-12) / max(nPointDomain, 1ul);
+  vector<passivedouble> weight(nPointDomain, pointCost);
+
+  CGeometricPartitioner partitioner(nDim, size, MPI_COMM_WORLD);
+  const auto part = partitioner.Partition(nPointDomain, coord.data(), weight.data());
+
+  Repart_GlobalIndex.resize(nPointDomain);
+  Repart_Color.resize(nPointDomain);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    Repart_GlobalIndex[iPoint] = geometry[MESH_0]->nodes->GetGlobalIndex(iPoint);
+    Repart_Color[iPoint] = part[iPoint];
+  }
+
+  /*--- Pack the state of all solvers (fine grid only) and send it to the new owners. ---*/
+
+  unsigned short nVarPoint = 0;
+  for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++)
+    if (solver[MESH_0][iSol] != nullptr) nVarPoint += nStates*solver[MESH_0][iSol]->GetnVar();
+
+  vector<int> nPoint_Send(size,0), nPoint_Recv(size,0);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) nPoint_Send[part[iPoint]]++;
+
+  SU2_MPI::Alltoall(nPoint_Send.data(), 1, MPI_INT, nPoint_Recv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  vector<int> sendDispl(size+1,0), recvDispl(size+1,0);
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDispl[iRank+1] = sendDispl[iRank] + nPoint_Send[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nPoint_Recv[iRank];
+  }
+
+  vector<unsigned long> idxSend(sendDispl[size]), idxRecv(recvDispl[size]);
+  vector<passivedouble> varSend(size_t(sendDispl[size])*nVarPoint), varRecv(size_t(recvDispl[size])*nVarPoint);
+  vector<int> counter(sendDispl.begin(), sendDispl.end()-1);
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    const int iPos = counter[part[iPoint]]++;
+    idxSend[iPos] = Repart_GlobalIndex[iPoint];
+
+    passivedouble* buf = &varSend[size_t(iPos)*nVarPoint];
+    for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++) {
+      if (solver[MESH_0][iSol] == nullptr) continue;
+      auto nodes = solver[MESH_0][iSol]->GetNodes();
+      for (unsigned short iVar = 0; iVar < solver[MESH_0][iSol]->GetnVar(); iVar++) {
+        *(buf++) = SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar));
+        if (dual_time) {
+          *(buf++) = SU2_TYPE::GetValue(nodes->GetSolution_time_n(iPoint)[iVar]);
+          *(buf++) = SU2_TYPE::GetValue(nodes->GetSolution_time_n1(iPoint)[iVar]);
+        }
+      }
+    }
+  }
+
+  SU2_MPI::Alltoallv(idxSend.data(), nPoint_Send.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                     idxRecv.data(), nPoint_Recv.data(), recvDispl.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    nPoint_Send[iRank] *= nVarPoint;  sendDispl[iRank] *= nVarPoint;
+    nPoint_Recv[iRank] *= nVarPoint;  recvDispl[iRank] *= nVarPoint;
+  }
+
+  SU2_MPI::Alltoallv(varSend.data(), nPoint_Send.data(), sendDispl.data(), MPI_DOUBLE,
+                     varRecv.data(), nPoint_Recv.data(), recvDispl.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+
+  vector<passivedouble>().swap(varSend);
+
+  /*--- Tear down everything that depends on the partition (the output first, it may still be
+   writing files from the old partition). ---*/
+
+  output_container[iZone]->DeallocateDataSorters();
+
+  Numerics_Postprocessing(numerics_container[iZone], solver, geometry, config, iInst);
+  Integration_Postprocessing(integration_container[iZone], geometry, config, iInst);
+  Solver_Postprocessing(solver_container[iZone], geometry, config, iInst);
+
+  for (unsigned short iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
+    delete geometry[iMGlevel];
+  delete [] geometry;
+
+  /*--- Rebuild the zone on the new partition, this re-reads the grid and distributes
+   it with the prescribed colors (see Geometrical_Preprocessing_FVM). ---*/
+
+  Geometrical_Preprocessing(config, geometry_container[iZone][iInst], false);
+
+  CGeometry::ComputeWallDistance(config_container, geometry_container);
+
+  Solver_Preprocessing(config, geometry_container[iZone][iInst], solver_container[iZone][iInst]);
+
+  Numerics_Preprocessing(config, geometry_container[iZone][iInst], solver_container[iZone][iInst],
+                         numerics_container[iZone][iInst]);
+
+  Integration_Preprocessing(config, solver_container[iZone][iInst][MESH_0], integration_container[iZone][iInst]);
+
+  StaticMesh_Preprocessing(config, geometry_container[iZone][iInst], surface_movement[iZone]);
+
+  geometry = geometry_container[iZone][iInst];
+  solver = solver_container[iZone][iInst];
+
+  Repart_GlobalIndex.clear();
+  Repart_Color.clear();
+
+  /*--- Unpack the migrated state on the fine grid. ---*/
+
+  for (int iPos = 0; iPos < recvDispl[size]/nVarPoint; iPos++) {
+    const long iPoint = geometry[MESH_0]->GetGlobal_to_Local_Point(idxRecv[iPos]);
+    if (iPoint < 0)
+      SU2_MPI::Error("A migrated point does not belong to the new partition.", CURRENT_FUNCTION);
+
+    const passivedouble* buf = &varRecv[size_t(iPos)*nVarPoint];
+    for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++) {
+      if (solver[MESH_0][iSol] == nullptr) continue;
+      auto nodes = solver[MESH_0][iSol]->GetNodes();
+      for (unsigned short iVar = 0; iVar < solver[MESH_0][iSol]->GetnVar(); iVar++) {
+        nodes->SetSolution(iPoint, iVar, *(buf++));
+        if (dual_time) {
+          nodes->Set_Solution_time_n(iPoint, iVar, *(buf++));
+          nodes->Set_Solution_time_n1(iPoint, iVar, *(buf++));
+        }
+      }
+    }
+  }
+
+  /*--- Update the halos, restrict the state to the coarse grids, and recompute the
+   auxiliary variables (primitives, eddy viscosity) as done when loading a restart. ---*/
+
+  const unsigned short commQuantities[] = {SOLUTION, SOLUTION_TIME_N, SOLUTION_TIME_N1};
+
+  for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+    for (unsigned int iSol = 0; iSol < MAX_SOLS; iSol++) {
+      CSolver* sol = solver[iMesh][iSol];
+      if ((sol == nullptr) || (solver[MESH_0][iSol] == nullptr)) continue;
+
+      if (iMesh != MESH_0) {
+        CGeometry* geoCoarse = geometry[iMesh];
+        CGeometry* geoFine = geometry[iMesh-1];
+        auto fineNodes = solver[iMesh-1][iSol]->GetNodes();
+        const unsigned short nVar = sol->GetnVar();
+        vector<su2double> Solution(3*nVar);
+
+        for (unsigned long iPoint = 0; iPoint < geoCoarse->GetnPoint(); iPoint++) {
+          Solution.assign(3*nVar, 0.0);
+          const su2double Area_Parent = geoCoarse->nodes->GetVolume(iPoint);
+          for (unsigned short iChildren = 0; iChildren < geoCoarse->nodes->GetnChildren_CV(iPoint); iChildren++) {
+            const unsigned long Point_Fine = geoCoarse->nodes->GetChildren_CV(iPoint, iChildren);
+            const su2double Ratio = geoFine->nodes->GetVolume(Point_Fine) / Area_Parent;
+            for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+              Solution[iVar] += fineNodes->GetSolution(Point_Fine, iVar) * Ratio;
+              if (dual_time) {
+                Solution[nVar+iVar] += fineNodes->GetSolution_time_n(Point_Fine)[iVar] * Ratio;
+                Solution[2*nVar+iVar] += fineNodes->GetSolution_time_n1(Point_Fine)[iVar] * Ratio;
+              }
+            }
+          }
+          sol->GetNodes()->SetSolution(iPoint, Solution.data());
+          if (dual_time) {
+            sol->GetNodes()->Set_Solution_time_n(iPoint, &Solution[nVar]);
+            sol->GetNodes()->Set_Solution_time_n1(iPoint, &Solution[2*nVar]);
+          }
+        }
+      }
+
+      for (unsigned short iState = 0; iState < nStates; iState++) {
+        sol->InitiateComms(geometry[iMesh], config, commQuantities[iState]);
+        sol->CompleteComms(geometry[iMesh], config, commQuantities[iState]);
+      }
+    }
+
+    if (solver[iMesh][FLOW_SOL] != nullptr) {
+      SU2_OMP_PARALLEL_(if(solver[iMesh][FLOW_SOL]->GetHasHybridParallel()))
+      solver[iMesh][FLOW_SOL]->Preprocessing(geometry[iMesh], solver[iMesh], config, iMesh, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+    }
+    if (solver[iMesh][TURB_SOL] != nullptr) {
+      SU2_OMP_PARALLEL_(if(solver[iMesh][TURB_SOL]->GetHasHybridParallel()))
+      solver[iMesh][TURB_SOL]->Postprocessing(geometry[iMesh], solver[iMesh], config, iMesh);
+    }
+  }
+
+  if (rank == MASTER_NODE) cout << endl << "Repartitioning complete, resuming the simulation." << endl;
+
+}
+
 void CDriver::Output_Preprocessing(CConfig **config, CConfig *driver_config, COutput **&output, COutput *&driver_output){
 
   /*--- Definition of the output class (one for each zone). The output class
@@ -2916,8 +3157,11 @@ void CFluidDriver::Run() {
   if ( unsteady ) {
     for (iZone = 0; iZone < nZone; iZone++) {
       for (jZone = 0; jZone < nZone; jZone++)
-        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr)
-        interpolator_container[iZone][jZone]->SetTransferCoeff(config_container);
+        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr) {
+          interpolator_container[iZone][jZone]->SetTransferCoeff(config_container);
+          if (interface_container[iZone][jZone] != nullptr && interpolator_container[iZone][jZone]->GetCoeffChanged())
+            interface_container[iZone][jZone]->ResetTransferPattern();
+        }
     }
   }
 
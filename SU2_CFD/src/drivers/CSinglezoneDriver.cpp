@@ -68,9 +68,21 @@ void CSinglezoneDriver::StartSolver() {
   if (config_container[ZONE_0]->GetRestart() && driver_config->GetTime_Domain())
     TimeIter = config_container[ZONE_0]->GetRestart_Iter();
 
+  /*--- Dynamic load balancing, the compute time of each rank excludes the time spent
+   waiting for other ranks (which is a symptom of the imbalance), in the halo exchanges
+   and in the reductions (residuals, CFL, dot products of the linear solvers). ---*/
+  const unsigned long loadBalanceFreq = config_container[ZONE_0]->GetLoadBalance_Freq();
+  passivedouble computeTime = 0.0;
+
+  auto busyTime = []() {
+    return SU2_MPI::Wtime() - CGeometry::GetHaloWaitTime() - SU2_MPI::GetCollectiveWaitTime();
+  };
+
   /*--- Run the problem until the number of time iterations required is reached. ---*/
   while ( TimeIter < config_container[ZONE_0]->GetnTime_Iter() ) {
 
+    const passivedouble computeStart = busyTime();
+
     /*--- Perform some preprocessing before starting the time-step simulation. ---*/
 
     Preprocess(TimeIter);
@@ -87,6 +99,8 @@ void CSinglezoneDriver::StartSolver() {
 
     Update();
 
+    computeTime += busyTime() - computeStart;
+
     /*--- Monitor the computations after each iteration. ---*/
 
     Monitor(TimeIter);
@@ -99,6 +113,13 @@ void CSinglezoneDriver::StartSolver() {
 
     if (StopCalc) break;
 
+    /*--- Check the load balance and repartition the grid if needed. ---*/
+
+    if ((loadBalanceFreq > 0) && ((TimeIter+1) % loadBalanceFreq == 0)) {
+      LoadBalance(ZONE_0, computeTime);
+      computeTime = 0.0;
+    }
+
     TimeIter++;
 
   }
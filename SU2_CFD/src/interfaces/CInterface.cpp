@@ -28,6 +28,8 @@
 #include "../../include/interfaces/CInterface.hpp"
 #include "../../../Common/include/interface_interpolation/CInterpolator.hpp"
 
+#include <unordered_map>
+
 CInterface::CInterface(void) :
   rank(SU2_MPI::GetRank()),
   size(SU2_MPI::GetSize()) {
@@ -56,209 +58,263 @@ CInterface::~CInterface(void) {
   delete[] SpanLevelDonor;
 }
 
-void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution,
-                               CGeometry *donor_geometry, CGeometry *target_geometry,
-                               CConfig *donor_config, CConfig *target_config) {
+void CInterface::SetTransferPattern(CTransferPattern& pattern, CGeometry *donor_geometry,
+                                    CGeometry *target_geometry, int Marker_Donor, int Marker_Target) const {
 
-  int Marker_Donor, Marker_Target;
-  unsigned long iVertex;
-  unsigned short iVar;
+  /*--- Donor vertices of the points of this rank. ---*/
 
-  GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
-                        donor_config, target_config);
+  unordered_map<long, unsigned long> vertexOfPoint;
 
-  unsigned long Point_Donor_Global, Donor_Global_Index;
-  unsigned long Point_Donor, Point_Target;
+  const auto nVertexDonor = (Marker_Donor >= 0)? donor_geometry->GetnVertex(Marker_Donor) : 0ul;
 
-  unsigned long Buffer_Send_nVertexDonor[1];
-  unsigned long *Buffer_Recv_nVertexDonor = new unsigned long[size];
-  unsigned long iLocalVertex = 0;
-  unsigned long nLocalVertexDonor = 0, nLocalVertexDonorOwned = 0;
+  for (auto iVertex = 0ul; iVertex < nVertexDonor; iVertex++) {
+    const auto iPoint = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
+    if (donor_geometry->nodes->GetDomain(iPoint))
+      vertexOfPoint[donor_geometry->nodes->GetGlobalIndex(iPoint)] = iVertex;
+  }
 
-  unsigned long MaxLocalVertexDonor = 0, TotalVertexDonor = 0;
+  auto donorVertexOfPoint = [&vertexOfPoint](long iPoint_Global) {
+    const auto it = vertexOfPoint.find(iPoint_Global);
+    if (it == vertexOfPoint.end())
+      SU2_MPI::Error("A donor point of the interface is not owned by the rank it was assigned to.", CURRENT_FUNCTION);
+    return it->second;
+  };
 
-  unsigned long nBuffer_DonorVariables = 0;
-  unsigned long nBuffer_DonorIndices = 0;
+  /*--- Global indices of the points this rank needs from each other donor rank, the interpolators
+   *  store the rank that owns each donor point in the target vertices. Donors of this rank (e.g. on
+   *  conformal interfaces partitioned alike) are found directly and are not communicated. ---*/
 
-  unsigned long nBuffer_BcastVariables = 0, nBuffer_BcastIndices = 0;
+  vector<vector<long> > request(size);
 
-  const int nProcessor = size;
+  const auto nVertexTarget = (Marker_Target >= 0)? target_geometry->GetnVertex(Marker_Target) : 0ul;
 
-  /*--- Number of markers on the FSI interface ---*/
+  for (auto iVertex = 0ul; iVertex < nVertexTarget; iVertex++) {
+    const auto vertex = target_geometry->vertex[Marker_Target][iVertex];
+    if (!target_geometry->nodes->GetDomain(vertex->GetNode())) continue;
 
-  const auto nMarkerInt = donor_config->GetMarker_n_ZoneInterface()/2;
+    for (auto iDonor = 0u; iDonor < vertex->GetnDonorPoints(); iDonor++) {
+      const auto iRank = vertex->GetInterpDonorProcessor(iDonor);
+      if (iRank != rank) request[iRank].push_back(vertex->GetInterpDonorPoint(iDonor));
+    }
+  }
 
-  /*--- Outer loop over the markers on the FSI interface: compute one by one ---*/
-  /*--- The tags are always an integer greater than 1: loop from 1 to nMarkerFSI ---*/
+  /*--- The receive buffer holds the values of each donor rank in the order of its requests,
+   *  followed by the values of the local donors. ---*/
 
-  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
+  vector<int> nRequest(size, 0), nRequested(size, 0);
+  vector<unsigned long> rankOffset(size, 0);
 
-    /*--- Check if this interface connects the two zones, if not continue. ---*/
+  pattern.recvRank.clear();
+  pattern.recvStart.assign(1, 0);
 
-    Marker_Donor = donor_config->FindInterfaceMarker(iMarkerInt);
-    Marker_Target = target_config->FindInterfaceMarker(iMarkerInt);
+  for (int iRank = 0; iRank < size; iRank++) {
+    auto& points = request[iRank];
+    sort(points.begin(), points.end());
+    points.erase(unique(points.begin(), points.end()), points.end());
+    if (points.empty()) continue;
 
-    if(!CInterpolator::CheckInterfaceBoundary(Marker_Donor, Marker_Target)) continue;
+    nRequest[iRank] = points.size();
+    rankOffset[iRank] = pattern.recvStart.back();
+    pattern.recvRank.push_back(iRank);
+    pattern.recvStart.push_back(pattern.recvStart.back() + points.size());
+  }
+
+  unordered_map<unsigned long, unsigned long> positionOfLocal;
 
-    nLocalVertexDonorOwned = 0;
-    nLocalVertexDonor      = 0;
+  pattern.localVertex.clear();
+  pattern.targetStart.assign(nVertexTarget+1, 0);
+  pattern.donorIndex.clear();
 
-    if( Marker_Donor != -1 ) {
-      nLocalVertexDonor = donor_geometry->GetnVertex(Marker_Donor);
+  for (auto iVertex = 0ul; iVertex < nVertexTarget; iVertex++) {
+    const auto vertex = target_geometry->vertex[Marker_Target][iVertex];
 
-      for (iVertex = 0; iVertex < nLocalVertexDonor; iVertex++) {
-        Point_Donor = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
-        if (donor_geometry->nodes->GetDomain(Point_Donor))
-          nLocalVertexDonorOwned++;
+    if (target_geometry->nodes->GetDomain(vertex->GetNode())) {
+      for (auto iDonor = 0u; iDonor < vertex->GetnDonorPoints(); iDonor++) {
+        const auto iRank = vertex->GetInterpDonorProcessor(iDonor);
+
+        if (iRank == rank) {
+          const auto pos = positionOfLocal.emplace(donorVertexOfPoint(vertex->GetInterpDonorPoint(iDonor)),
+                                                   pattern.localVertex.size());
+          if (pos.second) pattern.localVertex.push_back(pos.first->first);
+          pattern.donorIndex.push_back(pattern.recvStart.back() + pos.first->second);
+        }
+        else {
+          const auto& points = request[iRank];
+          const auto pos = lower_bound(points.begin(), points.end(), vertex->GetInterpDonorPoint(iDonor)) - points.begin();
+          pattern.donorIndex.push_back(rankOffset[iRank] + pos);
+        }
       }
     }
+    pattern.targetStart[iVertex+1] = pattern.donorIndex.size();
+  }
 
-    Buffer_Send_nVertexDonor[0] = nLocalVertexDonor;    // Retrieve total number of vertices on Donor marker
+  /*--- Tell the donor ranks which of their points are needed. ---*/
 
-    /*--- We receive MaxLocalVertexDonor as the maximum number of vertices
-     * in one single processor on the donor side---*/
-    SU2_MPI::Allreduce(&nLocalVertexDonor, &MaxLocalVertexDonor, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-    /*--- We receive TotalVertexDonorOwned as the total (real) number of vertices
-     * in one single interface marker on the donor side ---*/
-    SU2_MPI::Allreduce(&nLocalVertexDonorOwned, &TotalVertexDonor, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-    /*--- We gather a vector in MASTER_NODE that determines how many elements are there
-     * on each processor on the structural side ---*/
-    SU2_MPI::Gather(&Buffer_Send_nVertexDonor, 1, MPI_UNSIGNED_LONG,
-                    Buffer_Recv_nVertexDonor, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Alltoall(nRequest.data(), 1, MPI_INT, nRequested.data(), 1, MPI_INT, MPI_COMM_WORLD);
 
-    /*--- We will be gathering the donor information into the master node ---*/
-    nBuffer_DonorVariables = MaxLocalVertexDonor * nVar;
-    nBuffer_DonorIndices   = MaxLocalVertexDonor;
+  pattern.sendRank.clear();
+  pattern.sendStart.assign(1, 0);
 
-    /*--- Then we will broadcasting it to all the processors so they can retrieve the info they need ---*/
-    /*--- We only broadcast those nodes that we need ---*/
-    nBuffer_BcastVariables = TotalVertexDonor * nVar;
-    nBuffer_BcastIndices   = TotalVertexDonor;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (nRequested[iRank] == 0) continue;
+    pattern.sendRank.push_back(iRank);
+    pattern.sendStart.push_back(pattern.sendStart.back() + nRequested[iRank]);
+  }
 
-    /*--- Send and Recv buffers ---*/
+  vector<long> requested(pattern.sendStart.back());
 
-    /*--- Buffers to send and receive the variables in the donor mesh ---*/
-    su2double *Buffer_Send_DonorVariables = new su2double[nBuffer_DonorVariables];
-    su2double *Buffer_Recv_DonorVariables = nullptr;
+#ifdef HAVE_MPI
+  vector<SU2_MPI::Request> requests;
+  requests.reserve(pattern.sendRank.size() + pattern.recvRank.size());
+
+  for (auto iSend = 0ul; iSend < pattern.sendRank.size(); iSend++) {
+    const int iRank = pattern.sendRank[iSend];
+    requests.emplace_back();
+    SU2_MPI::Irecv(&requested[pattern.sendStart[iSend]], nRequested[iRank], MPI_LONG,
+                   iRank, 0, MPI_COMM_WORLD, &requests.back());
+  }
+  for (const int iRank : pattern.recvRank) {
+    requests.emplace_back();
+    SU2_MPI::Isend(request[iRank].data(), nRequest[iRank], MPI_LONG, iRank, 0, MPI_COMM_WORLD, &requests.back());
+  }
+  SU2_MPI::Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+#endif
 
-    /*--- Buffers to send and receive the indices in the donor mesh ---*/
-    long *Buffer_Send_DonorIndices = new long[nBuffer_DonorIndices];
-    long *Buffer_Recv_DonorIndices = nullptr;
+  /*--- Donor vertices of the requested points, each one is evaluated once per transfer. ---*/
 
-    /*--- Buffers to broadcast the variables and the indices ---*/
-    su2double *Buffer_Bcast_Variables = new su2double[nBuffer_BcastVariables];
-    long *Buffer_Bcast_Indices        = new long[nBuffer_BcastIndices];
+  unordered_map<unsigned long, unsigned long> positionOfVertex;
 
-    /*--- Prepare the receive buffers (1st step) and send buffers (2nd step) on the master node only. ---*/
+  pattern.donorVertex.clear();
+  pattern.sendIndex.resize(requested.size());
 
-    if (rank == MASTER_NODE) {
-      Buffer_Recv_DonorVariables  = new su2double[size*nBuffer_DonorVariables];
-      Buffer_Recv_DonorIndices    = new long[size*nBuffer_DonorIndices];
-    }
+  for (auto iValue = 0ul; iValue < requested.size(); iValue++) {
+    const auto pos = positionOfVertex.emplace(donorVertexOfPoint(requested[iValue]), pattern.donorVertex.size());
+    if (pos.second) pattern.donorVertex.push_back(pos.first->first);
+    pattern.sendIndex[iValue] = pos.first->second;
+  }
+
+  pattern.built = true;
+}
 
-    /*--- On the donor side ---*/
-    /*--- First we initialize all of the indices and processors to -1 ---*/
-    /*--- This helps on identifying halo nodes and avoids setting wrong values ---*/
-    for (iVertex = 0; iVertex < nBuffer_DonorIndices; iVertex++)
-      Buffer_Send_DonorIndices[iVertex] = -1;
+void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution,
+                               CGeometry *donor_geometry, CGeometry *target_geometry,
+                               CConfig *donor_config, CConfig *target_config) {
 
+  GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
+                        donor_config, target_config);
 
-    for (iVertex = 0; iVertex < nLocalVertexDonor; iVertex++) {
-      Point_Donor = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
+  /*--- Number of markers on the FSI interface ---*/
 
-      /*--- If this processor owns the node ---*/
+  const auto nMarkerInt = donor_config->GetMarker_n_ZoneInterface()/2;
 
-      if (donor_geometry->nodes->GetDomain(Point_Donor)) {
+  if (transferPattern.size() != size_t(nMarkerInt)) transferPattern.resize(nMarkerInt);
 
-        GetDonor_Variable(donor_solution, donor_geometry, donor_config, Marker_Donor, iVertex, Point_Donor);
+  /*--- Outer loop over the markers on the FSI interface: compute one by one ---*/
+  /*--- The tags are always an integer greater than 1: loop from 1 to nMarkerFSI ---*/
 
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_DonorVariables[iVertex*nVar+iVar] = Donor_Variable[iVar];
+  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
 
-        Point_Donor_Global = donor_geometry->nodes->GetGlobalIndex(Point_Donor);
-        Buffer_Send_DonorIndices[iVertex]     = Point_Donor_Global;
-      }
+    /*--- Check if this interface connects the two zones, if not continue. ---*/
 
-    }
+    const int Marker_Donor = donor_config->FindInterfaceMarker(iMarkerInt);
+    const int Marker_Target = target_config->FindInterfaceMarker(iMarkerInt);
 
-    /*--- Once all the messages have been prepared, we gather them all into the MASTER_NODE ---*/
-    SU2_MPI::Gather(Buffer_Send_DonorVariables, nBuffer_DonorVariables, MPI_DOUBLE, Buffer_Recv_DonorVariables,
-                    nBuffer_DonorVariables, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_DonorIndices, nBuffer_DonorIndices, MPI_LONG, Buffer_Recv_DonorIndices,
-                    nBuffer_DonorIndices, MPI_LONG, MASTER_NODE, MPI_COMM_WORLD);
+    if(!CInterpolator::CheckInterfaceBoundary(Marker_Donor, Marker_Target)) continue;
 
-    /*--- Now we pack the information to send it over to the different processors ---*/
+    /*--- Each rank sends the values of its donor points to the ranks of the target points that
+     *  use them, the pattern of this communication is built on the first transfer after the
+     *  interpolation is computed. ---*/
 
-    if (rank == MASTER_NODE) {
+    auto& pattern = transferPattern[iMarkerInt];
 
-      /*--- For all the data we have received ---*/
-      /*--- We initialize a counter to determine the position in the broadcast vector ---*/
-      iLocalVertex = 0;
+    if (!pattern.built)
+      SetTransferPattern(pattern, donor_geometry, target_geometry, Marker_Donor, Marker_Target);
 
-      for (iVertex = 0; iVertex < nProcessor*nBuffer_DonorIndices; iVertex++) {
+    /*--- Evaluate the donor variables of the requested vertices once. ---*/
 
-        /*--- If the donor index is not -1 (this is, if the node is not originally a halo node) ---*/
-        if (Buffer_Recv_DonorIndices[iVertex] != -1) {
+    vector<su2double> donorValues(pattern.donorVertex.size()*nVar);
 
-          /*--- We set the donor index ---*/
-          Buffer_Bcast_Indices[iLocalVertex] = Buffer_Recv_DonorIndices[iVertex];
+    for (auto iDonor = 0ul; iDonor < pattern.donorVertex.size(); iDonor++) {
+      const auto iVertex = pattern.donorVertex[iDonor];
+      const auto Point_Donor = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
 
-          for (iVar = 0; iVar < nVar; iVar++)
-            Buffer_Bcast_Variables[iLocalVertex*nVar+iVar] = Buffer_Recv_DonorVariables[iVertex*nVar + iVar];
+      GetDonor_Variable(donor_solution, donor_geometry, donor_config, Marker_Donor, iVertex, Point_Donor);
 
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        donorValues[iDonor*nVar+iVar] = Donor_Variable[iVar];
+    }
 
-          iLocalVertex++;
+    /*--- Pack them for each rank that needs them and exchange. ---*/
 
-        }
+    const auto nRecv = pattern.recvStart.back();
 
-        if (iLocalVertex == TotalVertexDonor) break;
+    vector<su2double> sendBuffer(pattern.sendIndex.size()*nVar);
+    vector<su2double> recvBuffer((nRecv + pattern.localVertex.size())*nVar);
 
-      }
+    for (auto iValue = 0ul; iValue < pattern.sendIndex.size(); iValue++)
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        sendBuffer[iValue*nVar+iVar] = donorValues[pattern.sendIndex[iValue]*nVar+iVar];
 
+#ifdef HAVE_MPI
+    vector<SU2_MPI::Request> requests;
+    requests.reserve(pattern.sendRank.size() + pattern.recvRank.size());
+
+    for (auto iRecv = 0ul; iRecv < pattern.recvRank.size(); iRecv++) {
+      const int count = (pattern.recvStart[iRecv+1] - pattern.recvStart[iRecv])*nVar;
+      requests.emplace_back();
+      SU2_MPI::Irecv(&recvBuffer[pattern.recvStart[iRecv]*nVar], count, MPI_DOUBLE,
+                     pattern.recvRank[iRecv], 0, MPI_COMM_WORLD, &requests.back());
     }
+    for (auto iSend = 0ul; iSend < pattern.sendRank.size(); iSend++) {
+      const int count = (pattern.sendStart[iSend+1] - pattern.sendStart[iSend])*nVar;
+      requests.emplace_back();
+      SU2_MPI::Isend(&sendBuffer[pattern.sendStart[iSend]*nVar], count, MPI_DOUBLE,
+                     pattern.sendRank[iSend], 0, MPI_COMM_WORLD, &requests.back());
+    }
+#endif
 
-    SU2_MPI::Bcast(Buffer_Bcast_Variables, nBuffer_BcastVariables, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(Buffer_Bcast_Indices, nBuffer_BcastIndices, MPI_LONG, MASTER_NODE, MPI_COMM_WORLD);
+    /*--- While the messages are in flight, copy the values of the donors of this rank directly
+     *  after the received ones, these pairs bypass the communication. ---*/
 
-    long indexPoint_iVertex;
-    unsigned short iDonorPoint, nDonorPoints;
-    su2double donorCoeff;
+    for (auto iLocal = 0ul; iLocal < pattern.localVertex.size(); iLocal++) {
+      const auto iVertex = pattern.localVertex[iLocal];
+      const auto Point_Donor = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
+
+      GetDonor_Variable(donor_solution, donor_geometry, donor_config, Marker_Donor, iVertex, Point_Donor);
+
+      copy(Donor_Variable, Donor_Variable + nVar, &recvBuffer[(nRecv + iLocal)*nVar]);
+    }
+
+#ifdef HAVE_MPI
+    SU2_MPI::Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+#endif
 
     /*--- For the target marker we are studying ---*/
     if (Marker_Target >= 0) {
 
-      /*--- We have identified the local index of the Structural marker ---*/
       /*--- We loop over all the vertices in that marker and in that particular processor ---*/
 
-      for (iVertex = 0; iVertex < target_geometry->GetnVertex(Marker_Target); iVertex++) {
+      for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(Marker_Target); iVertex++) {
 
-        Point_Target = target_geometry->vertex[Marker_Target][iVertex]->GetNode();
+        const auto Point_Target = target_geometry->vertex[Marker_Target][iVertex]->GetNode();
 
         /*--- If this processor owns the node ---*/
         if (target_geometry->nodes->GetDomain(Point_Target)) {
-          TotalVertexDonor++;
-          nDonorPoints = target_geometry->vertex[Marker_Target][iVertex]->GetnDonorPoints();
+
+          const auto nDonorPoints = target_geometry->vertex[Marker_Target][iVertex]->GetnDonorPoints();
 
           InitializeTarget_Variable(target_solution, Marker_Target, iVertex, nDonorPoints);
 
           /*--- For the number of donor points ---*/
-          for (iDonorPoint = 0; iDonorPoint < nDonorPoints; iDonorPoint++) {
-
-            /*--- Find the global index of the donor points for Point_Target ---*/
-            Donor_Global_Index = target_geometry->vertex[Marker_Target][iVertex]->GetInterpDonorPoint(iDonorPoint);
+          for (auto iDonorPoint = 0u; iDonorPoint < nDonorPoints; iDonorPoint++) {
 
-            /*--- We need to get the donor coefficient in a way like this: ---*/
-            donorCoeff = target_geometry->vertex[Marker_Target][iVertex]->GetDonorCoeff(iDonorPoint);
+            const su2double donorCoeff = target_geometry->vertex[Marker_Target][iVertex]->GetDonorCoeff(iDonorPoint);
 
-            /*--- Find the index of the global donor point in the buffer Buffer_Bcast_Indices ---*/
-
-            indexPoint_iVertex = std::distance(Buffer_Bcast_Indices,
-                                               std::find(Buffer_Bcast_Indices,
-                                                         Buffer_Bcast_Indices + nBuffer_BcastIndices,
-                                                         Donor_Global_Index));
+            /*--- Position of the donor point in the received values ---*/
+            const long indexPoint_iVertex = pattern.donorIndex[pattern.targetStart[iVertex] + iDonorPoint];
 
             /*--- Recover the Target_Variable from the buffer of variables ---*/
-            RecoverTarget_Variable(indexPoint_iVertex, Buffer_Bcast_Variables, donorCoeff);
+            RecoverTarget_Variable(indexPoint_iVertex, recvBuffer.data(), donorCoeff);
 
             /*--- If the value is not directly aggregated in the previous function ---*/
             if (!valAggregated) SetTarget_Variable(target_solution, target_geometry, target_config,
@@ -275,17 +331,8 @@ void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution
       }
 
     }
-
-    delete [] Buffer_Send_DonorVariables;
-    delete [] Buffer_Send_DonorIndices;
-    delete [] Buffer_Bcast_Variables;
-    delete [] Buffer_Bcast_Indices;
-
-    delete [] Buffer_Recv_DonorVariables;
-    delete [] Buffer_Recv_DonorIndices;
   }
 
-  delete [] Buffer_Recv_nVertexDonor;
 }
 
 void CInterface::PreprocessAverage(CGeometry *donor_geometry, CGeometry *target_geometry,
@@ -423,314 +470,89 @@ void CInterface::AllgatherAverage(CSolver *donor_solution, CSolver *target_solut
                                   CGeometry *donor_geometry, CGeometry *target_geometry,
                                   CConfig *donor_config, CConfig *target_config, unsigned short iMarkerInt){
 
-  unsigned short  nMarkerDonor, nMarkerTarget;    // Number of markers on the interface, donor and target side
-  unsigned short  iMarkerDonor, iMarkerTarget;    // Variables for iteration over markers
-  unsigned short iSpan, nSpanDonor, nSpanTarget;
-  int Marker_Donor = -1, Marker_Target = -1;
-  su2double *avgPressureDonor = nullptr, *avgDensityDonor = nullptr, *avgNormalVelDonor = nullptr,
-      *avgTangVelDonor = nullptr, *avg3DVelDonor = nullptr, *avgNuDonor = nullptr,
-      *avgOmegaDonor = nullptr, *avgKineDonor = nullptr;
-  su2double *avgPressureTarget = nullptr, *avgDensityTarget = nullptr, *avgNormalVelTarget = nullptr,
-      *avg3DVelTarget = nullptr, *avgTangVelTarget = nullptr, *avgNuTarget = nullptr,
-      *avgOmegaTarget = nullptr, *avgKineTarget = nullptr;
-
-#ifdef HAVE_MPI
-  int iSize;
-  su2double *BuffAvgPressureDonor = NULL, *BuffAvgDensityDonor = NULL, *BuffAvgNormalVelDonor = NULL,
-      *BuffAvg3DVelDonor = NULL, *BuffAvgTangVelDonor = NULL, *BuffAvgNuDonor = NULL,
-      *BuffAvgKineDonor = NULL, *BuffAvgOmegaDonor = NULL;
-  int nSpanSize, *BuffMarkerDonor;
-#endif
-
-
-  nMarkerTarget  = target_geometry->GetnMarker();
-  nMarkerDonor   = donor_geometry->GetnMarker();
-  nSpanDonor     = donor_config->GetnSpanWiseSections() +1;
-  nSpanTarget    = target_config->GetnSpanWiseSections() +1;
-
-
-  avgDensityDonor                  = new su2double[nSpanDonor];
-  avgPressureDonor                 = new su2double[nSpanDonor];
-  avgNormalVelDonor                = new su2double[nSpanDonor];
-  avgTangVelDonor                  = new su2double[nSpanDonor];
-  avg3DVelDonor                    = new su2double[nSpanDonor];
-  avgNuDonor                       = new su2double[nSpanDonor];
-  avgKineDonor                     = new su2double[nSpanDonor];
-  avgOmegaDonor                    = new su2double[nSpanDonor];
-
-  for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
-    avgDensityDonor[iSpan]         = -1.0;
-    avgPressureDonor[iSpan]        = -1.0;
-    avgNormalVelDonor[iSpan]       = -1.0;
-    avgTangVelDonor[iSpan]         = -1.0;
-    avg3DVelDonor[iSpan]           = -1.0;
-    avgNuDonor[iSpan]              = -1.0;
-    avgKineDonor[iSpan]            = -1.0;
-    avgOmegaDonor[iSpan]           = -1.0;
-  }
-
-  avgDensityTarget                 = new su2double[nSpanTarget];
-  avgPressureTarget                = new su2double[nSpanTarget];
-  avgNormalVelTarget               = new su2double[nSpanTarget];
-  avgTangVelTarget                 = new su2double[nSpanTarget];
-  avg3DVelTarget                   = new su2double[nSpanTarget];
-  avgNuTarget                      = new su2double[nSpanTarget];
-  avgKineTarget                    = new su2double[nSpanTarget];
-  avgOmegaTarget                   = new su2double[nSpanTarget];
-
-
-  for (iSpan = 0; iSpan < nSpanTarget; iSpan++){
-    avgDensityTarget[iSpan]        = -1.0;
-    avgPressureTarget[iSpan]       = -1.0;
-    avgNormalVelTarget[iSpan]      = -1.0;
-    avgTangVelTarget[iSpan]        = -1.0;
-    avg3DVelTarget[iSpan]          = -1.0;
-    avgNuTarget[iSpan]             = -1.0;
-    avgKineTarget[iSpan]           = -1.0;
-    avgOmegaTarget[iSpan]          = -1.0;
-  }
+  /*--- Density, pressure, normal, tangential and 3D velocity, nu, k and omega. ---*/
+  constexpr unsigned short nMixingVar = 8;
 
-  /*--- Outer loop over the markers on the Mixing-Plane interface: compute one by one ---*/
-  /*--- The tags are always an integer greater than 1: loop from 1 to nMarkerMixingPlane ---*/
-  Marker_Donor = -1;
-  Marker_Target = -1;
+  const unsigned short nMarkerTarget = target_geometry->GetnMarker();
+  const unsigned short nMarkerDonor  = donor_geometry->GetnMarker();
+  const unsigned short nSpanDonor    = donor_config->GetnSpanWiseSections() +1;
+  const unsigned short nSpanTarget   = target_config->GetnSpanWiseSections() +1;
 
   /*--- The donor and target markers are tagged with the same index.
    *--- This is independent of the MPI domain decomposition.
    *--- We need to loop over all markers on both sides  ---*/
 
-  /*--- On the donor side ---*/
+  int Marker_Donor = -1, Marker_Target = -1;
 
-  for (iMarkerDonor = 0; iMarkerDonor < nMarkerDonor; iMarkerDonor++){
-    /*--- If the tag GetMarker_All_MixingPlaneInterface equals the index we are looping at ---*/
-    if ( donor_config->GetMarker_All_MixingPlaneInterface(iMarkerDonor) == iMarkerInt ){
-      /*--- We have identified the local index of the Donor marker ---*/
-      /*--- Now we are going to store the average values that belong to Marker_Donor on each processor ---*/
-      /*--- Store the identifier for the structural marker ---*/
+  for (unsigned short iMarkerDonor = 0; iMarkerDonor < nMarkerDonor; iMarkerDonor++){
+    if (donor_config->GetMarker_All_MixingPlaneInterface(iMarkerDonor) == iMarkerInt){
       Marker_Donor = iMarkerDonor;
-      /*--- Exit the for loop: we have found the local index for Mixing-Plane interface ---*/
       break;
     }
-    else {
-      /*--- If the tag hasn't matched any tag within the donor markers ---*/
-      Marker_Donor = -1;
-    }
-  }
-  /*--- Here we want to make available the quantities for all the processors and collect them in a buffer
-   * for each span of the donor the span-wise height vector also so
-   * that then we can interpolate on the target side  ---*/
-  if (Marker_Donor != -1){
-    for(iSpan = 0; iSpan < nSpanDonor; iSpan++){
-      GetDonor_Variable(donor_solution, donor_geometry, donor_config, Marker_Donor, iSpan, rank);
-      avgDensityDonor[iSpan]          = Donor_Variable[0];
-      avgPressureDonor[iSpan]         = Donor_Variable[1];
-      avgNormalVelDonor[iSpan]        = Donor_Variable[2];
-      avgTangVelDonor[iSpan]          = Donor_Variable[3];
-      avg3DVelDonor[iSpan]            = Donor_Variable[4];
-      avgNuDonor[iSpan]               = Donor_Variable[5];
-      avgKineDonor[iSpan]             = Donor_Variable[6];
-      avgOmegaDonor[iSpan]            = Donor_Variable[7];
-    }
   }
 
-#ifdef HAVE_MPI
-  nSpanSize = size*nSpanDonor;
-  BuffAvgDensityDonor                 = new su2double[nSpanSize];
-  BuffAvgPressureDonor                = new su2double[nSpanSize];
-  BuffAvgNormalVelDonor               = new su2double[nSpanSize];
-  BuffAvgTangVelDonor                 = new su2double[nSpanSize];
-  BuffAvg3DVelDonor                   = new su2double[nSpanSize];
-  BuffAvgNuDonor                      = new su2double[nSpanSize];
-  BuffAvgKineDonor                    = new su2double[nSpanSize];
-  BuffAvgOmegaDonor                   = new su2double[nSpanSize];
-  BuffMarkerDonor                     = new int[size];
-
-  for (iSpan=0;iSpan<nSpanSize;iSpan++){
-    BuffAvgDensityDonor[iSpan]        = -1.0;
-    BuffAvgPressureDonor[iSpan]       = -1.0;
-    BuffAvgNormalVelDonor[iSpan]      = -1.0;
-    BuffAvgTangVelDonor[iSpan]        = -1.0;
-    BuffAvg3DVelDonor[iSpan]          = -1.0;
-    BuffAvgNuDonor[iSpan]             = -1.0;
-    BuffAvgKineDonor[iSpan]           = -1.0;
-    BuffAvgOmegaDonor[iSpan]          = -1.0;
+  for (unsigned short iMarkerTarget = 0; iMarkerTarget < nMarkerTarget; iMarkerTarget++){
+    if (target_config->GetMarker_All_MixingPlaneInterface(iMarkerTarget) == iMarkerInt){
+      Marker_Target = iMarkerTarget;
+      break;
+    }
   }
 
-  for (iSize=0; iSize<size;iSize++){
-    BuffMarkerDonor[iSize]            = -1;
-  }
+  /*--- The span-wise averages are global quantities, every rank that has the donor marker holds the
+   *    same values. The lowest of those ranks is determined once per interface marker and is the only
+   *    one that sends them, all the averages travel packed in a single broadcast. ---*/
 
-  SU2_MPI::Allgather(avgDensityDonor, nSpanDonor , MPI_DOUBLE, BuffAvgDensityDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgPressureDonor, nSpanDonor , MPI_DOUBLE, BuffAvgPressureDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgNormalVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNormalVelDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgTangVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgTangVelDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avg3DVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvg3DVelDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgNuDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNuDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgKineDonor, nSpanDonor , MPI_DOUBLE, BuffAvgKineDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgOmegaDonor, nSpanDonor , MPI_DOUBLE, BuffAvgOmegaDonor,
-                     nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor, 1, MPI_INT, MPI_COMM_WORLD);
+  if (mixingPlaneOwner.size() <= iMarkerInt) mixingPlaneOwner.resize(iMarkerInt+1, -1);
 
-  for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
-    avgDensityDonor[iSpan]            = -1.0;
-    avgPressureDonor[iSpan]           = -1.0;
-    avgNormalVelDonor[iSpan]          = -1.0;
-    avgTangVelDonor[iSpan]            = -1.0;
-    avg3DVelDonor[iSpan]              = -1.0;
-    avgNuDonor[iSpan]                 = -1.0;
-    avgKineDonor[iSpan]               = -1.0;
-    avgOmegaDonor[iSpan]              = -1.0;
+  if (mixingPlaneOwner[iMarkerInt] < 0) {
+    int candidate = (Marker_Donor != -1)? rank : size;
+    SU2_MPI::Allreduce(&candidate, &mixingPlaneOwner[iMarkerInt], 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
   }
+  const int owner = mixingPlaneOwner[iMarkerInt];
 
-  Marker_Donor= -1;
+  /*--- No rank has the donor marker, there is nothing to transfer. ---*/
+  if (owner == size) return;
 
-  for (iSize=0; iSize<size;iSize++){
-    if(BuffAvgDensityDonor[nSpanDonor*iSize] > 0.0){
-      for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
-        avgDensityDonor[iSpan]        = BuffAvgDensityDonor[nSpanDonor*iSize + iSpan];
-        avgPressureDonor[iSpan]       = BuffAvgPressureDonor[nSpanDonor*iSize + iSpan];
-        avgNormalVelDonor[iSpan]      = BuffAvgNormalVelDonor[nSpanDonor*iSize + iSpan];
-        avgTangVelDonor[iSpan]        = BuffAvgTangVelDonor[nSpanDonor*iSize + iSpan];
-        avg3DVelDonor[iSpan]          = BuffAvg3DVelDonor[nSpanDonor*iSize + iSpan];
-        avgNuDonor[iSpan]             = BuffAvgNuDonor[nSpanDonor*iSize + iSpan];
-        avgKineDonor[iSpan]           = BuffAvgKineDonor[nSpanDonor*iSize + iSpan];
-        avgOmegaDonor[iSpan]          = BuffAvgOmegaDonor[nSpanDonor*iSize + iSpan];
-      }
-      Marker_Donor                    = BuffMarkerDonor[iSize];
-      break;
-    }
-  }
-  delete [] BuffAvgDensityDonor;
-  delete [] BuffAvgPressureDonor;
-  delete [] BuffAvgNormalVelDonor;
-  delete [] BuffAvgTangVelDonor;
-  delete [] BuffAvg3DVelDonor;
-  delete [] BuffAvgNuDonor;
-  delete [] BuffAvgKineDonor;
-  delete [] BuffAvgOmegaDonor;
-  delete [] BuffMarkerDonor;
-#endif
+  /*--- Packed as [iVar*nSpanDonor + iSpan]. ---*/
+  vector<su2double> avgDonor(nMixingVar*nSpanDonor);
 
-  /*--- On the target side we have to identify the marker as well ---*/
-  for (iMarkerTarget = 0; iMarkerTarget < nMarkerTarget; iMarkerTarget++){
-    /*--- If the tag GetMarker_All_MixingPlaneInterface(iMarkerTarget) equals the index we are looping at ---*/
-    if ( target_config->GetMarker_All_MixingPlaneInterface(iMarkerTarget) == iMarkerInt ){
-      /*--- Store the identifier for the fluid marker ---*/
-      Marker_Target = iMarkerTarget;
-      /*--- Exit the for loop: we have found the local index for iMarkerFSI on the FEA side ---*/
-      break;
-    }
-    else {
-      /*--- If the tag hasn't matched any tag within the Flow markers ---*/
-      Marker_Target = -1;
+  if (rank == owner) {
+    for (unsigned short iSpan = 0; iSpan < nSpanDonor; iSpan++) {
+      GetDonor_Variable(donor_solution, donor_geometry, donor_config, Marker_Donor, iSpan, rank);
+      for (unsigned short iVar = 0; iVar < nMixingVar; iVar++)
+        avgDonor[iVar*nSpanDonor + iSpan] = Donor_Variable[iVar];
     }
   }
 
+  SU2_MPI::Bcast(avgDonor.data(), avgDonor.size(), MPI_DOUBLE, owner, MPI_COMM_WORLD);
 
-  if (Marker_Target != -1 && Marker_Donor != -1){
+  if (Marker_Target == -1) return;
 
-    /*--- linear interpolation of the average value of for the internal span-wise levels ---*/
-    for(iSpan = 1; iSpan < nSpanTarget -2 ; iSpan++){
-      avgDensityTarget[iSpan]             = SpanValueCoeffTarget[iSpan]*(avgDensityDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgDensityDonor[SpanLevelDonor[iSpan]]);
-      avgDensityTarget[iSpan]            += avgDensityDonor[SpanLevelDonor[iSpan]];
-      avgPressureTarget[iSpan]            = SpanValueCoeffTarget[iSpan]*(avgPressureDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgPressureDonor[SpanLevelDonor[iSpan]]);
-      avgPressureTarget[iSpan]           += avgPressureDonor[SpanLevelDonor[iSpan]];
-      avgNormalVelTarget[iSpan]           = SpanValueCoeffTarget[iSpan]*(avgNormalVelDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgNormalVelDonor[SpanLevelDonor[iSpan]]);
-      avgNormalVelTarget[iSpan]          += avgNormalVelDonor[SpanLevelDonor[iSpan]];
-      avgTangVelTarget[iSpan]             = SpanValueCoeffTarget[iSpan]*(avgTangVelDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgTangVelDonor[SpanLevelDonor[iSpan]]);
-      avgTangVelTarget[iSpan]            += avgTangVelDonor[SpanLevelDonor[iSpan]];
-      avg3DVelTarget[iSpan]               = SpanValueCoeffTarget[iSpan]*(avg3DVelDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avg3DVelDonor[SpanLevelDonor[iSpan]]);
-      avg3DVelTarget[iSpan]              += avg3DVelDonor[SpanLevelDonor[iSpan]];
-      avgNuTarget[iSpan]                  = SpanValueCoeffTarget[iSpan]*(avgNuDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgNuDonor[SpanLevelDonor[iSpan]]);
-      avgNuTarget[iSpan]                 += avgNuDonor[SpanLevelDonor[iSpan]];
-      avgKineTarget[iSpan]                = SpanValueCoeffTarget[iSpan]*(avgKineDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgKineDonor[SpanLevelDonor[iSpan]]);
-      avgKineTarget[iSpan]               += avgKineDonor[SpanLevelDonor[iSpan]];
-      avgOmegaTarget[iSpan]               = SpanValueCoeffTarget[iSpan]*(avgOmegaDonor[SpanLevelDonor[iSpan] + 1]
-                                            - avgOmegaDonor[SpanLevelDonor[iSpan] ]);
-      avgOmegaTarget[iSpan]              += avgOmegaDonor[SpanLevelDonor[iSpan]];
-    }
+  vector<su2double> avgTarget(nMixingVar*nSpanTarget);
 
+  for (unsigned short iVar = 0; iVar < nMixingVar; iVar++) {
+    const su2double* donorVal = &avgDonor[iVar*nSpanDonor];
+    su2double* targetVal = &avgTarget[iVar*nSpanTarget];
 
-    /*--- transfer values at the hub ---*/
-    avgDensityTarget[0]                      = avgDensityDonor[0];
-    avgPressureTarget[0]                     = avgPressureDonor[0];
-    avgNormalVelTarget[0]                    = avgNormalVelDonor[0];
-    avgTangVelTarget[0]                      = avgTangVelDonor[0];
-    avg3DVelTarget[0]                        = avg3DVelDonor[0];
-    avgNuTarget[0]                           = avgNuDonor[0];
-    avgKineTarget[0]                         = avgKineDonor[0];
-    avgOmegaTarget[0]                        = avgOmegaDonor[0];
-
-    /*--- transfer values at the shroud ---*/
-    avgDensityTarget[nSpanTarget - 2]        = avgDensityDonor[nSpanDonor - 2];
-    avgPressureTarget[nSpanTarget - 2]       = avgPressureDonor[nSpanDonor - 2];
-    avgNormalVelTarget[nSpanTarget - 2]      = avgNormalVelDonor[nSpanDonor - 2];
-    avgTangVelTarget[nSpanTarget - 2]        = avgTangVelDonor[nSpanDonor - 2];
-    avg3DVelTarget[nSpanTarget - 2]          = avg3DVelDonor[nSpanDonor - 2];
-    avgNuTarget[nSpanTarget - 2]             = avgNuDonor[nSpanDonor - 2];
-    avgKineTarget[nSpanTarget - 2]           = avgKineDonor[nSpanDonor - 2];
-    avgOmegaTarget[nSpanTarget - 2]          = avgOmegaDonor[nSpanDonor - 2];
-
-    /*--- transfer 1D values ---*/
-    avgDensityTarget[nSpanTarget - 1]        = avgDensityDonor[nSpanDonor - 1];
-    avgPressureTarget[nSpanTarget - 1]       = avgPressureDonor[nSpanDonor - 1];
-    avgNormalVelTarget[nSpanTarget - 1]      = avgNormalVelDonor[nSpanDonor - 1];
-    avgTangVelTarget[nSpanTarget - 1]        = avgTangVelDonor[nSpanDonor - 1];
-    avg3DVelTarget[nSpanTarget - 1]          = avg3DVelDonor[nSpanDonor - 1];
-    avgNuTarget[nSpanTarget - 1]             = avgNuDonor[nSpanDonor - 1];
-    avgKineTarget[nSpanTarget - 1]           = avgKineDonor[nSpanDonor - 1];
-    avgOmegaTarget[nSpanTarget - 1]          = avgOmegaDonor[nSpanDonor - 1];
-
-
-    /*---finally, the interpolated value is sent  to the target zone ---*/
-    for(iSpan = 0; iSpan < nSpanTarget ; iSpan++){
-      Target_Variable[0]                     = avgDensityTarget[iSpan];
-      Target_Variable[1]                     = avgPressureTarget[iSpan];
-      Target_Variable[2]                     = avgNormalVelTarget[iSpan];
-      Target_Variable[3]                     = avgTangVelTarget[iSpan];
-      Target_Variable[4]                     = avg3DVelTarget[iSpan];
-      Target_Variable[5]                     = avgNuTarget[iSpan];
-      Target_Variable[6]                     = avgKineTarget[iSpan];
-      Target_Variable[7]                     = avgOmegaTarget[iSpan];
-
-
-      SetTarget_Variable(target_solution, target_geometry, target_config, Marker_Target, iSpan, rank);
+    /*--- linear interpolation of the average value of for the internal span-wise levels ---*/
+    for (unsigned short iSpan = 1; iSpan < nSpanTarget-2; iSpan++) {
+      const auto kSpan = SpanLevelDonor[iSpan];
+      targetVal[iSpan] = donorVal[kSpan] + SpanValueCoeffTarget[iSpan]*(donorVal[kSpan+1] - donorVal[kSpan]);
     }
+
+    /*--- transfer values at the hub, at the shroud, and the 1D values ---*/
+    targetVal[0]             = donorVal[0];
+    targetVal[nSpanTarget-2] = donorVal[nSpanDonor-2];
+    targetVal[nSpanTarget-1] = donorVal[nSpanDonor-1];
   }
 
-  delete [] avgDensityDonor;
-  delete [] avgPressureDonor;
-  delete [] avgNormalVelDonor;
-  delete [] avgTangVelDonor;
-  delete [] avg3DVelDonor;
-  delete [] avgNuDonor;
-  delete [] avgKineDonor;
-  delete [] avgOmegaDonor;
-
-
-  delete [] avgDensityTarget;
-  delete [] avgPressureTarget;
-  delete [] avgNormalVelTarget;
-  delete [] avgTangVelTarget;
-  delete [] avg3DVelTarget;
-  delete [] avgNuTarget;
-  delete [] avgKineTarget;
-  delete [] avgOmegaTarget;
+  /*---finally, the interpolated value is sent  to the target zone ---*/
+  for (unsigned short iSpan = 0; iSpan < nSpanTarget; iSpan++) {
+    for (unsigned short iVar = 0; iVar < nMixingVar; iVar++)
+      Target_Variable[iVar] = avgTarget[iVar*nSpanTarget + iSpan];
 
+    SetTarget_Variable(target_solution, target_geometry, target_config, Marker_Target, iSpan, rank);
+  }
 
 }
 
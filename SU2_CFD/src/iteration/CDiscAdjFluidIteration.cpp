@@ -54,9 +54,10 @@ void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integr
   //    output->SetHeatFlux_InverseDesign(solver[val_iZone][val_iInst][MESH_0][FLOW_SOL],
   //    geometry[val_iZone][val_iInst][MESH_0], config[val_iZone], ExtIter);
 
-  /*--- For the unsteady adjoint, load direct solutions from restart files. ---*/
+  /*--- For the unsteady adjoint, load direct solutions from restart files (the driver
+   *    loads them if they are kept in memory, see UNST_ADJ_CHECKPOINTS). ---*/
 
-  if (config[val_iZone]->GetTime_Marching()) {
+  if (config[val_iZone]->GetTime_Marching() && (config[val_iZone]->GetUnst_AdjCheckpoints() == 0)) {
     Direct_Iter = SU2_TYPE::Int(config[val_iZone]->GetUnst_AdjointIter()) - SU2_TYPE::Int(TimeIter) - 2;
 
     /*--- For dual-time stepping we want to load the already converged solution at timestep n ---*/
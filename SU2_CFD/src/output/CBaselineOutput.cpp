@@ -100,8 +100,6 @@ void CBaselineOutput::SetVolumeOutputFields(CConfig *config){
 
 void CBaselineOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint){
 
-  unsigned short iField = 0;
-
   if ( fields.size() != solver[0]->GetnVar()){
     SU2_MPI::Error("Number of requested fields and number of variables do not match.", CURRENT_FUNCTION);
   }
@@ -110,8 +108,6 @@ void CBaselineOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolv
 
   CVariable* Node_Sol  = solver[0]->GetNodes();
 
-  for (iField = 0; iField < fields.size(); iField++){
-    SetVolumeOutputValue(fields[iField], iPoint, Node_Sol->GetSolution(iPoint, iField));
-  }
+  SetVolumeOutputValue(fields.data(), iPoint, Node_Sol->GetSolution(iPoint), fields.size());
 
 }
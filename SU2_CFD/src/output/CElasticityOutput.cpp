@@ -169,14 +169,11 @@ void CElasticityOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSo
   CVariable* Node_Struc = solver[FEA_SOL]->GetNodes();
   CPoint*    Node_Geo  = geometry->nodes;
 
-  SetVolumeOutputValue("COORD-X", iPoint,  Node_Geo->GetCoord(iPoint, 0));
-  SetVolumeOutputValue("COORD-Y", iPoint,  Node_Geo->GetCoord(iPoint, 1));
-  if (nDim == 3)
-    SetVolumeOutputValue("COORD-Z", iPoint, Node_Geo->GetCoord(iPoint, 2));
+  static const string coordFields[] = {"COORD-X", "COORD-Y", "COORD-Z"};
+  SetVolumeOutputValue(coordFields, iPoint, Node_Geo->GetCoord(iPoint), nDim);
 
-  SetVolumeOutputValue("DISPLACEMENT-X", iPoint, Node_Struc->GetSolution(iPoint, 0));
-  SetVolumeOutputValue("DISPLACEMENT-Y", iPoint, Node_Struc->GetSolution(iPoint, 1));
-  if (nDim == 3) SetVolumeOutputValue("DISPLACEMENT-Z", iPoint, Node_Struc->GetSolution(iPoint, 2));
+  static const string solutionFields[] = {"DISPLACEMENT-X", "DISPLACEMENT-Y", "DISPLACEMENT-Z"};
+  SetVolumeOutputValue(solutionFields, iPoint, Node_Struc->GetSolution(iPoint), nDim);
 
   if(dynamic){
     SetVolumeOutputValue("VELOCITY-X", iPoint, Node_Struc->GetSolution_Vel(iPoint, 0));
@@ -430,20 +430,12 @@ void CFlowCompOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolv
 
   CPoint*    Node_Geo  = geometry->nodes;
 
-  SetVolumeOutputValue("COORD-X", iPoint,  Node_Geo->GetCoord(iPoint, 0));
-  SetVolumeOutputValue("COORD-Y", iPoint,  Node_Geo->GetCoord(iPoint, 1));
-  if (nDim == 3)
-    SetVolumeOutputValue("COORD-Z", iPoint, Node_Geo->GetCoord(iPoint, 2));
+  static const string coordFields[] = {"COORD-X", "COORD-Y", "COORD-Z"};
+  SetVolumeOutputValue(coordFields, iPoint, Node_Geo->GetCoord(iPoint), nDim);
 
-  SetVolumeOutputValue("DENSITY",    iPoint, Node_Flow->GetSolution(iPoint, 0));
-  SetVolumeOutputValue("MOMENTUM-X", iPoint, Node_Flow->GetSolution(iPoint, 1));
-  SetVolumeOutputValue("MOMENTUM-Y", iPoint, Node_Flow->GetSolution(iPoint, 2));
-  if (nDim == 3){
-    SetVolumeOutputValue("MOMENTUM-Z", iPoint, Node_Flow->GetSolution(iPoint, 3));
-    SetVolumeOutputValue("ENERGY",     iPoint, Node_Flow->GetSolution(iPoint, 4));
-  } else {
-    SetVolumeOutputValue("ENERGY",     iPoint, Node_Flow->GetSolution(iPoint, 3));
-  }
+  static const string solutionFields2D[] = {"DENSITY", "MOMENTUM-X", "MOMENTUM-Y", "ENERGY"};
+  static const string solutionFields3D[] = {"DENSITY", "MOMENTUM-X", "MOMENTUM-Y", "MOMENTUM-Z", "ENERGY"};
+  SetVolumeOutputValue(nDim == 3? solutionFields3D : solutionFields2D, iPoint, Node_Flow->GetSolution(iPoint), nDim+2);
 
   // Turbulent Residuals
   switch(config->GetKind_Turb_Model()){
@@ -63,9 +63,7 @@ void CMeshOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver *
 
   CPoint*    Node_Geo  = geometry->nodes;
 
-  SetVolumeOutputValue("COORD-X", iPoint,  Node_Geo->GetCoord(iPoint, 0));
-  SetVolumeOutputValue("COORD-Y", iPoint,  Node_Geo->GetCoord(iPoint, 1));
-  if (nDim == 3)
-    SetVolumeOutputValue("COORD-Z", iPoint, Node_Geo->GetCoord(iPoint, 2));
+  static const string coordFields[] = {"COORD-X", "COORD-Y", "COORD-Z"};
+  SetVolumeOutputValue(coordFields, iPoint, Node_Geo->GetCoord(iPoint), nDim);
 
 }
@@ -41,10 +41,12 @@
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
+#include "../../include/output/filewriter/CCGNSFileWriter.hpp"
 
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
 #include "../../include/solvers/CSolver.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutput(fem_output) {
 
@@ -55,9 +57,38 @@ COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutp
 
   fieldWidth = 12;
 
+  /*--- The asynchronous output calls MPI from a second thread, which requires MPI_THREAD_MULTIPLE.
+   *  The recording of the AD tape is not thread-safe, the files are then written synchronously. ---*/
+
+  asyncOutput = config->GetOutput_Async();
+  asyncDone = true;
+  asyncComm = MPI_COMM_WORLD;
+  restartBandwidth = 0.0;
+
+  /*--- The CGNS files of an unsteady run can be steps of one time series (per volume and surface). ---*/
+
+  timeSeriesOutput = config->GetOutput_Time_Series() && config->GetTime_Domain();
+  volumeSeriesStart = surfaceSeriesStart = -1;
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  asyncOutput = false;
+#endif
+#ifdef HAVE_MPI
+  if (asyncOutput) {
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE) {
+      if (rank == MASTER_NODE)
+        cout << "WARNING: OUTPUT_ASYNC requires MPI_THREAD_MULTIPLE (--thread_multiple), "
+                "the files are written synchronously." << endl;
+      asyncOutput = false;
+    }
+  }
+#endif
+
   convergenceTable = new PrintingToolbox::CTablePrinter(&std::cout);
   multiZoneHeaderTable = new PrintingToolbox::CTablePrinter(&std::cout);
-  fileWritingTable = new PrintingToolbox::CTablePrinter(&std::cout);
+  fileWritingTable = new PrintingToolbox::CTablePrinter(asyncOutput? &asyncWritingText : &std::cout);
   historyFileTable = new PrintingToolbox::CTablePrinter(&histFile, "");
 
   /*--- Set default filenames ---*/
@@ -161,6 +192,7 @@ COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutp
   convergence        = false;
 
   buildFieldIndexCache = false;
+  cacheCursor.resize(omp_get_max_threads());
 
   curInnerIter = 0;
   curOuterIter = 0;
@@ -174,6 +206,13 @@ COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutp
 }
 
 COutput::~COutput(void) {
+
+  WaitForOutput();
+
+#ifdef HAVE_MPI
+  if (asyncComm != MPI_COMM_WORLD) MPI_Comm_free(&asyncComm);
+#endif
+
   delete convergenceTable;
   delete multiZoneHeaderTable;
   delete fileWritingTable;
@@ -316,6 +355,18 @@ void COutput::AllocateDataSorters(CConfig *config, CGeometry *geometry){
 
 }
 
+void COutput::DeallocateDataSorters(){
+
+  WaitForOutput();
+
+  delete volumeDataSorter;
+  volumeDataSorter = nullptr;
+
+  delete surfaceDataSorter;
+  surfaceDataSorter = nullptr;
+
+}
+
 void COutput::Load_Data(CGeometry *geometry, CConfig *config, CSolver** solver_container){
 
   /*--- Check if the data sorters are allocated, if not, allocate them. --- */
@@ -334,6 +385,28 @@ void COutput::Load_Data(CGeometry *geometry, CConfig *config, CSolver** solver_c
 
 void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short format, string fileName){
 
+  /*--- Files written directly must not overlap with the asynchronous output. ---*/
+
+  WaitForOutput();
+
+  const auto historyValue = [this](const string& field) {
+    return historyOutput_Map.count(field)? historyOutput_Map.at(field).value : su2double(0.0);
+  };
+
+  WriteToFile(config, geometry, format, fileName, curTimeIter,
+              historyValue("TIME_STEP"), historyValue("CUR_TIME"));
+
+  /*--- Print the file writing table. ---*/
+
+  WaitForOutput();
+
+  SetRestartBandwidth(config);
+
+}
+
+void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short format, string fileName,
+                          unsigned long timeIter, su2double timeStep, su2double curTime){
+
   CFileWriter *fileWriter = nullptr;
 
   unsigned short lastindex = fileName.find_last_of(".");
@@ -346,7 +419,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case SURFACE_CSV:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", timeIter);
 
       surfaceDataSorter->SortConnectivity(config, geometry);
       surfaceDataSorter->SortOutputData();
@@ -362,7 +435,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case RESTART_ASCII: case CSV:
 
       if (fileName.empty())
-        fileName = config->GetFilename(restartFilename, "", curTimeIter);
+        fileName = config->GetFilename(restartFilename, "", timeIter);
 
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "SU2 ASCII restart" << fileName + CSU2FileWriter::fileExt;
@@ -375,13 +448,30 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case RESTART_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(restartFilename, "", curTimeIter);
+        fileName = config->GetFilename(restartFilename, "", timeIter);
 
       if (rank == MASTER_NODE) {
           (*fileWritingTable) << "SU2 restart" << fileName + CSU2BinaryFileWriter::fileExt;
       }
 
-      fileWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter);
+      {
+        /*--- Fields that the solvers read back on restart are always stored in double precision. ---*/
+
+        vector<char> singlePrecision;
+
+        if (config->GetWrt_Restart_Single_Prec()) {
+          const set<string> restartGroups = {"COORDINATES", "SOLUTION", "GRID_VELOCITY",
+                                             "VELOCITY", "ACCELERATION", "SENSITIVITY"};
+          singlePrecision.resize(volumeFieldNames.size(), 0);
+          for (const auto& field : volumeOutput_Map)
+            if (field.second.offset >= 0 && restartGroups.count(field.second.outputGroup) == 0)
+              singlePrecision[field.second.offset] = 1;
+        }
+
+        fileWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter, singlePrecision,
+                                              config->GetWrt_Restart_Compression(),
+                                              config->GetWrt_Restart_Partitioned());
+      }
 
       break;
 
@@ -408,7 +498,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case TECPLOT_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -420,14 +510,14 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
       }
 
       fileWriter = new CTecplotBinaryFileWriter(fileName, volumeDataSorter,
-                                                curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+                                                timeIter, timeStep);
 
       break;
 
     case TECPLOT:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -439,14 +529,14 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
       }
 
       fileWriter = new CTecplotFileWriter(fileName, volumeDataSorter,
-                                          curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+                                          timeIter, timeStep);
 
       break;
 
     case PARAVIEW_XML:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -461,10 +551,38 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
       break;
 
+    case CGNS:
+    {
+      /*--- A time series is named after its first step, the mesh (and connectivity) is only needed there. ---*/
+
+      const bool timeSeries = timeSeriesOutput && fileName.empty();
+      const bool newSeries = timeSeries && volumeSeriesStart < 0;
+      if (newSeries) volumeSeriesStart = timeIter;
+
+      if (fileName.empty())
+        fileName = config->GetFilename(volumeFilename, "", timeSeries? volumeSeriesStart : timeIter);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      if (!timeSeries || newSeries)
+        volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      /*--- Write CGNS ---*/
+      if (rank == MASTER_NODE) {
+          (*fileWritingTable) << (timeSeries? "CGNS time series" : "CGNS") << fileName + CCGNSFileWriter::fileExt;
+      }
+
+      auto cgnsWriter = new CCGNSFileWriter(fileName, volumeDataSorter, config->GetOutput_CGNS_Compression());
+      if (timeSeries) cgnsWriter->SetTimeSeries(timeIter, SU2_TYPE::GetValue(curTime), newSeries);
+      fileWriter = cgnsWriter;
+
+      break;
+    }
+
     case PARAVIEW_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -483,7 +601,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
       {
 
         if (fileName.empty())
-          fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+          fileName = config->GetFilename(volumeFilename, "", timeIter);
 
         /*--- Sort volume connectivity ---*/
 
@@ -491,11 +609,11 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
         /*--- The file name of the multiblock file is the case name (i.e. the config file name w/o ext.) ---*/
 
-        fileName = config->GetUnsteady_FileName(config->GetCaseName(), curTimeIter, "");
+        fileName = config->GetUnsteady_FileName(config->GetCaseName(), timeIter, "");
 
         /*--- Allocate the vtm file writer ---*/
 
-        fileWriter = new CParaviewVTMFileWriter(fileName, fileName, GetHistoryFieldValue("CUR_TIME"),
+        fileWriter = new CParaviewVTMFileWriter(fileName, fileName, curTime,
                                                 config->GetiZone(), config->GetnZone());
 
         /*--- We cast the pointer to its true type, to avoid virtual functions ---*/
@@ -549,7 +667,8 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
           /*--- Only sort if there is at least one processor that has this marker ---*/
 
           int globalMarkerSize = 0, localMarkerSize = marker.size();
-          SU2_MPI::Allreduce(&localMarkerSize, &globalMarkerSize, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+          SU2_MPI::Allreduce(&localMarkerSize, &globalMarkerSize, 1, MPI_INT, MPI_SUM,
+                             CParallelDataSorter::GetOutputComm());
 
           if (globalMarkerSize > 0){
 
@@ -576,7 +695,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case PARAVIEW:
 
       if (fileName.empty())
-        fileName = config->GetFilename(volumeFilename, "", curTimeIter);
+        fileName = config->GetFilename(volumeFilename, "", timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -594,7 +713,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case SURFACE_PARAVIEW:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -613,7 +732,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case SURFACE_PARAVIEW_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -632,7 +751,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     case SURFACE_PARAVIEW_XML:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -648,10 +767,37 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
       break;
 
+    case SURFACE_CGNS:
+    {
+      const bool timeSeries = timeSeriesOutput && fileName.empty();
+      const bool newSeries = timeSeries && surfaceSeriesStart < 0;
+      if (newSeries) surfaceSeriesStart = timeIter;
+
+      if (fileName.empty())
+        fileName = config->GetFilename(surfaceFilename, "", timeSeries? surfaceSeriesStart : timeIter);
+
+      /*--- Load and sort the output data and connectivity (the surface data is sorted with it). ---*/
+
+      surfaceDataSorter->SortConnectivity(config, geometry);
+      surfaceDataSorter->SortOutputData();
+
+      /*--- Write CGNS surface ---*/
+      if (rank == MASTER_NODE) {
+          (*fileWritingTable) << (timeSeries? "CGNS surface time series" : "CGNS surface")
+                              << fileName + CCGNSFileWriter::fileExt;
+      }
+
+      auto cgnsWriter = new CCGNSFileWriter(fileName, surfaceDataSorter, config->GetOutput_CGNS_Compression());
+      if (timeSeries) cgnsWriter->SetTimeSeries(timeIter, SU2_TYPE::GetValue(curTime), newSeries);
+      fileWriter = cgnsWriter;
+
+      break;
+    }
+
     case SURFACE_TECPLOT:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -664,14 +810,14 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
       }
 
       fileWriter = new CTecplotFileWriter(fileName, surfaceDataSorter,
-                                          curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+                                          timeIter, timeStep);
 
       break;
 
     case SURFACE_TECPLOT_BINARY:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -684,14 +830,14 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
       }
 
       fileWriter = new CTecplotBinaryFileWriter(fileName, surfaceDataSorter,
-                                                curTimeIter, GetHistoryFieldValue("TIME_STEP"));
+                                                timeIter, timeStep);
 
       break;
 
     case STL:
 
       if (fileName.empty())
-        fileName = config->GetFilename(surfaceFilename, "", curTimeIter);
+        fileName = config->GetFilename(surfaceFilename, "", timeIter);
 
       /*--- Load and sort the output data and connectivity. ---*/
 
@@ -723,7 +869,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
     /*--- Compute and store the bandwidth ---*/
 
     if (format == RESTART_BINARY){
-      config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg()+BandWidth);
+      restartBandwidth += BandWidth;
     }
 
     if (config->GetWrt_Performance() && (rank == MASTER_NODE)){
@@ -739,11 +885,62 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
 
 
+void COutput::WriteVolumeFiles(CConfig *config, CGeometry *geometry, const vector<unsigned short>& formats,
+                               unsigned long timeIter, su2double timeStep, su2double curTime){
+
+  if (rank == MASTER_NODE && !formats.empty()){
+    fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::CENTER);
+    fileWritingTable->PrintHeader();
+    fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  }
+
+  for (auto format : formats)
+    WriteToFile(config, geometry, format, "", timeIter, timeStep, curTime);
+
+  if (rank == MASTER_NODE && !formats.empty())
+    fileWritingTable->PrintFooter();
+
+}
+
+void COutput::WaitForOutput(bool block){
+
+  if (asyncWriter.joinable()) {
+    if (!block && !asyncDone) return;
+    asyncWriter.join();
+  }
+
+  /*--- Print what was written since the last call. ---*/
+
+  if (rank == MASTER_NODE && !asyncWritingText.str().empty()) {
+    cout << asyncWritingText.str() << flush;
+    asyncWritingText.str("");
+    headerNeeded = true;
+  }
+
+}
+
+void COutput::SetRestartBandwidth(CConfig *config){
+
+  /*--- The bandwidth of a restart written in the background is added once the writer finished. ---*/
+
+  if (asyncWriter.joinable()) return;
+
+  config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg()+restartBandwidth);
+  restartBandwidth = 0.0;
+
+}
+
 bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                               unsigned long iter, bool force_writing){
 
   bool writeFiles = WriteVolume_Output(config, iter, force_writing);
 
+  /*--- The sorted data of the previous output may still be in use by the asynchronous writer. ---*/
+
+  if (asyncOutput) WaitForOutput(writeFiles);
+
+  SetRestartBandwidth(config);
+
   /*--- Check if the data sorters are allocated, if not, allocate them. --- */
 
   AllocateDataSorters(config, geometry);
@@ -757,31 +954,51 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
 
   if (writeFiles){
 
-    /*--- Partition and sort the data --- */
-
-    volumeDataSorter->SortOutputData();
-
     unsigned short nVolumeFiles = config->GetnVolumeOutputFiles();
     unsigned short *VolumeFiles = config->GetVolumeOutputFiles();
 
-    if (rank == MASTER_NODE && nVolumeFiles != 0){
-      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::CENTER);
-      fileWritingTable->PrintHeader();
-      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
-    }
+    const vector<unsigned short> files(VolumeFiles, VolumeFiles+nVolumeFiles);
 
-    /*--- Loop through all requested output files and write
-     * the partitioned and sorted data stored in the data sorters. ---*/
+    /*--- Partition and sort the data, partitioned restart files are written from the
+     *  unsorted data and do not need it when they are the only volume output. --- */
 
-    for (unsigned short iFile = 0; iFile < nVolumeFiles; iFile++){
+    const bool onlyPartitionedRestart = config->GetWrt_Restart_Partitioned() &&
+      all_of(files.begin(), files.end(), [](unsigned short format) { return format == RESTART_BINARY; });
 
-      WriteToFile(config, geometry, VolumeFiles[iFile]);
+    if (!onlyPartitionedRestart) volumeDataSorter->SortOutputData();
 
+    const unsigned long timeIter = curTimeIter;
+    const su2double timeStep = historyOutput_Map.count("TIME_STEP")? GetHistoryFieldValue("TIME_STEP") : 0.0;
+    const su2double curTime = historyOutput_Map.count("CUR_TIME")? GetHistoryFieldValue("CUR_TIME") : 0.0;
+
+    if (asyncOutput && nVolumeFiles != 0) {
+
+      /*--- The sorted data is not modified until the next output (the solution is loaded
+       *  into the send buffer of the sorter), the files are written from it on a thread
+       *  that uses its own communicator while the solver continues. The writer only reads
+       *  the config, what it measures is kept in the output until it is joined. ---*/
+
+#ifdef HAVE_MPI
+      if (asyncComm == MPI_COMM_WORLD) MPI_Comm_dup(MPI_COMM_WORLD, &asyncComm);
+#endif
+      asyncDone = false;
+
+      asyncWriter = std::thread([=]() {
+        CParallelDataSorter::SetOutputComm(asyncComm);
+        WriteVolumeFiles(config, geometry, files, timeIter, timeStep, curTime);
+        asyncDone = true;
+      });
     }
+    else {
+
+      /*--- Loop through all requested output files and write
+       * the partitioned and sorted data stored in the data sorters. ---*/
+
+      WriteVolumeFiles(config, geometry, files, timeIter, timeStep, curTime);
+
+      SetRestartBandwidth(config);
 
-    if (rank == MASTER_NODE && nVolumeFiles != 0){
-      fileWritingTable->PrintFooter();
-      headerNeeded = true;
+      if (rank == MASTER_NODE && nVolumeFiles != 0) headerNeeded = true;
     }
 
     /*--- Write any additonal files defined in the child class ----*/
@@ -1540,14 +1757,13 @@ void COutput::PreprocessVolumeOutput(CConfig *config){
 void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver** solver){
 
   unsigned short iMarker = 0;
-  unsigned long iPoint = 0, jPoint = 0;
+  unsigned long iPoint = 0;
   unsigned long iVertex = 0;
 
   /*--- Reset the offset cache and index --- */
-  cachePosition = 0;
   fieldIndexCache.clear();
-  curGetFieldIndex = 0;
   fieldGetIndexCache.clear();
+  cacheCursor.assign(omp_get_max_threads(), CacheCursor());
 
   if (femOutput){
 
@@ -1560,38 +1776,70 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
 
     CVolumeElementFEM *volElem  = DGGeometry->GetVolElem();
 
-    /*--- Access the solution by looping over the owned volume elements. ---*/
+    /*--- Access the solution by looping over the owned volume elements, the index of
+     *  a DOF is the local offset of its element (owned elements come first). As for
+     *  the points below, the first DOF builds the offset caches, the states are
+     *  computed with the fluid model of each thread (CFEM_DG_EulerSolver::GetFluidModel). ---*/
 
-    for(unsigned long l=0; l<nVolElemOwned; ++l) {
-
-      for(unsigned short j=0; j<volElem[l].nDOFsSol; ++j) {
-
-        buildFieldIndexCache = fieldIndexCache.empty();
-
-        LoadVolumeDataFEM(config, geometry, solver, l, jPoint, j);
+    if (nVolElemOwned > 0) {
+      buildFieldIndexCache = true;
+      LoadVolumeDataFEM(config, geometry, solver, 0, 0, 0);
+    }
+    buildFieldIndexCache = fieldIndexCache.empty() && fieldGetIndexCache.empty();
 
-        jPoint++;
+    const auto loadElement = [&](unsigned long l) {
+      for(unsigned short j = (l==0); j<volElem[l].nDOFsSol; ++j) {
+        LoadVolumeDataFEM(config, geometry, solver, l, volElem[l].offsetDOFsSolLocal+j, j);
+      }
+    };
 
+    if (!buildFieldIndexCache) {
+      SU2_OMP_PARALLEL
+      {
+        SU2_OMP_FOR_STAT(computeStaticChunkSize(nVolElemOwned, omp_get_num_threads(), OMP_MAX_SIZE))
+        for(unsigned long l=0; l<nVolElemOwned; ++l) loadElement(l);
       }
     }
+    else {
+      for(unsigned long l=0; l<nVolElemOwned; ++l) loadElement(l);
+    }
 
   } else {
 
-    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    const unsigned long nPointDomain = geometry->GetnPointDomain();
+
+    /*--- The first point builds the offset caches by looking up the fields by name,
+     *  the remaining points are loaded in parallel using only the cached offsets
+     *  (each thread keeps its own position in the caches). ---*/
+
+    if (nPointDomain > 0) {
+      buildFieldIndexCache = true;
+      LoadVolumeData(config, geometry, solver, 0);
+    }
+    buildFieldIndexCache = fieldIndexCache.empty() && fieldGetIndexCache.empty();
 
-      /*--- Load the volume data into the data sorter. --- */
+    if (!buildFieldIndexCache) {
+      SU2_OMP_PARALLEL
+      {
+        SU2_OMP_FOR_STAT(computeStaticChunkSize(nPointDomain, omp_get_num_threads(), OMP_MAX_SIZE))
+        for (iPoint = 1; iPoint < nPointDomain; iPoint++) {
 
-      buildFieldIndexCache = fieldIndexCache.empty();
+          /*--- Load the volume data into the data sorter. --- */
 
-      LoadVolumeData(config, geometry, solver, iPoint);
+          LoadVolumeData(config, geometry, solver, iPoint);
 
+        }
+      }
+    }
+    else {
+      for (iPoint = 1; iPoint < nPointDomain; iPoint++)
+        LoadVolumeData(config, geometry, solver, iPoint);
     }
 
     /*--- Reset the offset cache and index --- */
-    cachePosition = 0;
     fieldIndexCache.clear();
-    curGetFieldIndex = 0;
     fieldGetIndexCache.clear();
+    cacheCursor.assign(omp_get_max_threads(), CacheCursor());
 
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
@@ -1617,7 +1865,7 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
   }
 }
 
-void COutput::SetVolumeOutputValue(string name, unsigned long iPoint, su2double value){
+void COutput::SetVolumeOutputValue(const string& name, unsigned long iPoint, su2double value){
 
   if (buildFieldIndexCache){
 
@@ -1638,6 +1886,8 @@ void COutput::SetVolumeOutputValue(string name, unsigned long iPoint, su2double
 
     /*--- Use the offset cache for the access ---*/
 
+    auto& cachePosition = cacheCursor[omp_get_thread_num()].cachePosition;
+
     const short Offset = fieldIndexCache[cachePosition++];
     if (Offset != -1){
       volumeDataSorter->SetUnsorted_Data(iPoint, Offset, value);
@@ -1649,7 +1899,41 @@ void COutput::SetVolumeOutputValue(string name, unsigned long iPoint, su2double
 
 }
 
-su2double COutput::GetVolumeOutputValue(string name, unsigned long iPoint){
+void COutput::SetVolumeOutputValue(const string* names, unsigned long iPoint,
+                                   const su2double* values, unsigned short nValues){
+
+  if (buildFieldIndexCache){
+    for (unsigned short iValue = 0; iValue < nValues; iValue++)
+      SetVolumeOutputValue(names[iValue], iPoint, values[iValue]);
+    return;
+  }
+
+  /*--- Use the offset cache, if the fields are consecutive copy all values at once. ---*/
+
+  auto& cachePosition = cacheCursor[omp_get_thread_num()].cachePosition;
+
+  const short* Offset = &fieldIndexCache[cachePosition];
+
+  bool consecutive = (Offset[0] != -1);
+  for (unsigned short iValue = 1; iValue < nValues && consecutive; iValue++)
+    consecutive = (Offset[iValue] == Offset[0] + iValue);
+
+  if (consecutive) {
+    volumeDataSorter->SetUnsorted_Data(iPoint, Offset[0], nValues, values);
+  }
+  else {
+    for (unsigned short iValue = 0; iValue < nValues; iValue++)
+      if (Offset[iValue] != -1) volumeDataSorter->SetUnsorted_Data(iPoint, Offset[iValue], values[iValue]);
+  }
+
+  cachePosition += nValues;
+  if (cachePosition == fieldIndexCache.size()){
+    cachePosition = 0;
+  }
+
+}
+
+su2double COutput::GetVolumeOutputValue(const string& name, unsigned long iPoint){
 
   if (buildFieldIndexCache){
 
@@ -1670,6 +1954,8 @@ su2double COutput::GetVolumeOutputValue(string name, unsigned long iPoint){
 
     /*--- Use the offset cache for the access ---*/
 
+    auto& curGetFieldIndex = cacheCursor[omp_get_thread_num()].curGetFieldIndex;
+
     const short Offset = fieldGetIndexCache[curGetFieldIndex++];
 
     if (curGetFieldIndex == fieldGetIndexCache.size()){
@@ -1683,7 +1969,7 @@ su2double COutput::GetVolumeOutputValue(string name, unsigned long iPoint){
   return 0.0;
 }
 
-void COutput::SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2double value){
+void COutput::SetAvgVolumeOutputValue(const string& name, unsigned long iPoint, su2double value){
 
   const su2double scaling = 1.0 / su2double(curAbsTimeIter + 1);
 
@@ -1710,6 +1996,8 @@ void COutput::SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2doub
 
     /*--- Use the offset cache for the access ---*/
 
+    auto& cachePosition = cacheCursor[omp_get_thread_num()].cachePosition;
+
     const short Offset = fieldIndexCache[cachePosition++];
     if (Offset != -1){
 
@@ -0,0 +1,447 @@
+/*!
+ * \file CCGNSFileWriter.cpp
+ * \brief CGNS file writer class.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CCGNSFileWriter.hpp"
+
+#ifdef HAVE_CGNS
+#include "cgnslib.h"
+#if CG_BUILD_PARALLEL && defined(HAVE_MPI)
+#include "pcgnslib.h"
+#define SU2_PARALLEL_CGNS
+#endif
+#endif
+
+#include <algorithm>
+#include <cstdio>
+
+const string CCGNSFileWriter::fileExt = ".cgns";
+
+namespace {
+
+/*--- Element types of the sorters and their number of points. ---*/
+
+const unsigned short nElemTypes = 7;
+const unsigned short elemTypes[nElemTypes] = {LINE, TRIANGLE, QUADRILATERAL, TETRAHEDRON,
+                                              HEXAHEDRON, PRISM, PYRAMID};
+const unsigned short elemNodes[nElemTypes] = {N_POINTS_LINE, N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL,
+                                              N_POINTS_TETRAHEDRON, N_POINTS_HEXAHEDRON, N_POINTS_PRISM,
+                                              N_POINTS_PYRAMID};
+const int elemDims[nElemTypes] = {1, 2, 2, 3, 3, 3, 3};
+
+unsigned short TypeIndex(unsigned short type) {
+  return std::find(elemTypes, elemTypes+nElemTypes, type) - elemTypes;
+}
+
+#ifdef HAVE_CGNS
+/*--- The linear elements of SU2 (VTK) and CGNS have the same node ordering. ---*/
+
+CGNS_ENUMT(ElementType_t) CGNSElemType(unsigned short type) {
+  switch (type) {
+    case LINE:          return CGNS_ENUMV(BAR_2);
+    case TRIANGLE:      return CGNS_ENUMV(TRI_3);
+    case QUADRILATERAL: return CGNS_ENUMV(QUAD_4);
+    case TETRAHEDRON:   return CGNS_ENUMV(TETRA_4);
+    case HEXAHEDRON:    return CGNS_ENUMV(HEXA_8);
+    case PRISM:         return CGNS_ENUMV(PENTA_6);
+    default:            return CGNS_ENUMV(PYRA_5);
+  }
+}
+
+/*--- Names of the CGNS nodes are limited to 32 characters. ---*/
+
+string CGNSName(string name) {
+  name.erase(remove(name.begin(), name.end(), '"'), name.end());
+  return name.substr(0, CGNS_STRING_SIZE-1);
+}
+
+/*--- Name of the FlowSolution node of a step of a time series. ---*/
+
+string SolutionName(unsigned long iter) {
+  char name[CGNS_STRING_SIZE];
+  snprintf(name, CGNS_STRING_SIZE, "FlowSolution_%08lu", iter);
+  return name;
+}
+#endif
+
+}
+
+CCGNSFileWriter::CCGNSFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                 unsigned short valCompression) :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt),
+  compression(valCompression) {}
+
+CCGNSFileWriter::~CCGNSFileWriter(){
+
+}
+
+void CCGNSFileWriter::SetTimeSeries(unsigned long valTimeIter, passivedouble valPhysicalTime, bool valNewSeries){
+  timeSeries = true;
+  newSeries = valNewSeries;
+  timeIter = valTimeIter;
+  physicalTime = valPhysicalTime;
+}
+
+CCGNSFileWriter::CLayout CCGNSFileWriter::ComputeLayout() const {
+
+  /*--- Gather the number of elements of each type of all ranks, the elements of each
+   *  rank follow those of the lower ranks in the section of their type. ---*/
+
+  vector<unsigned long> nElemLocal(nElemTypes), nElem(size_t(size)*nElemTypes);
+
+  for (unsigned short iType = 0; iType < nElemTypes; iType++)
+    nElemLocal[iType] = dataSorter->GetnElem(static_cast<GEO_TYPE>(elemTypes[iType]));
+
+  SU2_MPI::Allgather(nElemLocal.data(), nElemTypes, MPI_UNSIGNED_LONG,
+                     nElem.data(), nElemTypes, MPI_UNSIGNED_LONG, GetOutputComm());
+
+  CLayout layout;
+
+  unsigned long nextElem = 1;
+
+  for (unsigned short iType = 0; iType < nElemTypes; iType++) {
+
+    unsigned long nGlobal = 0, nBefore = 0;
+    for (int iRank = 0; iRank < size; iRank++) {
+      if (iRank == rank) nBefore = nGlobal;
+      nGlobal += nElem[iRank*nElemTypes + iType];
+    }
+    if (nGlobal == 0) continue;
+
+    layout.types.push_back(elemTypes[iType]);
+    layout.sectionStart.push_back(nextElem);
+    layout.sectionEnd.push_back(nextElem + nGlobal - 1);
+    layout.localStart.push_back(nextElem + nBefore);
+    nextElem += nGlobal;
+
+    if (elemDims[iType] > layout.cellDim) {
+      layout.cellDim = elemDims[iType];
+      layout.nCellGlobal = 0;
+    }
+    if (elemDims[iType] == layout.cellDim) layout.nCellGlobal += nGlobal;
+  }
+
+  return layout;
+}
+
+void CCGNSFileWriter::Write_Data(){
+
+#ifndef HAVE_CGNS
+  SU2_MPI::Error("SU2 was built without CGNS support.", CURRENT_FUNCTION);
+#else
+  /*--- The steps appended to a time series only write the fields. ---*/
+
+  CLayout layout;
+
+  if (!timeSeries || newSeries) {
+
+    if (!dataSorter->GetConnectivitySorted()){
+      SU2_MPI::Error("Connectivity must be sorted.", CURRENT_FUNCTION);
+    }
+
+    layout = ComputeLayout();
+
+    if (layout.types.empty()) {
+      SU2_MPI::Error("The CGNS file needs at least one element.", CURRENT_FUNCTION);
+    }
+  }
+
+  SU2_MPI::Barrier(GetOutputComm());
+  startTime = SU2_MPI::Wtime();
+
+#ifdef SU2_PARALLEL_CGNS
+
+  /*--- All ranks write at the same time. ---*/
+
+  WritePartition(layout, true);
+
+#else
+
+  /*--- The ranks take turns, the first one creates the file (or the solution of the step). ---*/
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank == rank) WritePartition(layout, iRank == 0);
+    SU2_MPI::Barrier(GetOutputComm());
+  }
+
+#endif
+
+  stopTime = SU2_MPI::Wtime();
+  usedTime = stopTime - startTime;
+
+  /*--- Compute and store the bandwidth ---*/
+
+  fileSize = (rank == MASTER_NODE)? Determine_Filesize(fileName) : 0.0;
+  bandwidth = fileSize/(1.0e6)/usedTime;
+
+#endif
+}
+
+void CCGNSFileWriter::WritePartition(const CLayout& layout, bool master){
+
+#ifdef HAVE_CGNS
+
+  const bool writeMesh = !timeSeries || newSeries;
+  const string solName = timeSeries? SolutionName(timeIter) : string("FlowSolution");
+
+  const unsigned short nDim = dataSorter->GetnDim();
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  const cgsize_t pointRange[] = {cgsize_t(dataSorter->GetnPointCumulative(rank) + 1),
+                                 cgsize_t(dataSorter->GetnPointCumulative(rank) + nPoint)};
+
+  int fn = 0, B = 1, Z = 1, Sol = 1, index = 0;
+
+#ifdef SU2_PARALLEL_CGNS
+  if (cgp_mpi_comm(GetOutputComm())) cgp_error_exit();
+  if (compression > 0) cg_configure(CG_CONFIG_HDF5_COMPRESS, reinterpret_cast<void*>(size_t(compression)));
+
+  if (cgp_open(fileName.c_str(), writeMesh? CG_MODE_WRITE : CG_MODE_MODIFY, &fn)) cgp_error_exit();
+#else
+  if (master && writeMesh) {
+#if CG_BUILD_HDF5
+    if (compression > 0) cg_configure(CG_CONFIG_HDF5_COMPRESS, reinterpret_cast<void*>(size_t(compression)));
+#endif
+    if (cg_open(fileName.c_str(), CG_MODE_WRITE, &fn)) cg_error_exit();
+  }
+  else {
+    if (cg_open(fileName.c_str(), CG_MODE_MODIFY, &fn)) cg_error_exit();
+  }
+#endif
+
+  /*--- Structure of the file, base, unstructured zone, and solution at the vertices. ---*/
+
+  if (master) {
+    if (writeMesh) {
+      cgsize_t zoneSize[] = {cgsize_t(dataSorter->GetnPointsGlobal()), cgsize_t(layout.nCellGlobal), 0};
+
+      if (cg_base_write(fn, "Base", layout.cellDim, nDim, &B)) cg_error_exit();
+      if (cg_zone_write(fn, B, "Zone", zoneSize, CGNS_ENUMV(Unstructured), &Z)) cg_error_exit();
+      if (timeSeries && cg_simulation_type_write(fn, B, CGNS_ENUMV(TimeAccurate))) cg_error_exit();
+    }
+    else {
+      /*--- The step must have the points of the mesh of the series. ---*/
+      char zoneName[CGNS_STRING_SIZE];
+      cgsize_t zoneSize[3];
+      if (cg_zone_read(fn, B, Z, zoneName, zoneSize)) cg_error_exit();
+      if (zoneSize[0] != cgsize_t(dataSorter->GetnPointsGlobal()))
+        SU2_MPI::Error("The number of points does not match the mesh of the time series in " + fileName,
+                       CURRENT_FUNCTION);
+    }
+    /*--- The iterative data first, it deletes the solutions of the steps that are replaced. ---*/
+    if (timeSeries) WriteIterativeData(fn);
+    if (cg_sol_write(fn, B, Z, solName.c_str(), CGNS_ENUMV(Vertex), &Sol)) cg_error_exit();
+  }
+  else {
+    /*--- Find the solution created by the first rank. ---*/
+    int nSols = 0;
+    if (cg_nsols(fn, B, Z, &nSols)) cg_error_exit();
+    for (int S = 1; S <= nSols; S++) {
+      char name[CGNS_STRING_SIZE];
+      CGNS_ENUMT(GridLocation_t) location;
+      if (cg_sol_info(fn, B, Z, S, name, &location)) cg_error_exit();
+      if (solName == name) Sol = S;
+    }
+  }
+
+  /*--- Coordinates and fields, the first nDim fields of the sorter are the coordinates. ---*/
+
+  const char* coordNames[] = {"CoordinateX", "CoordinateY", "CoordinateZ"};
+
+  vector<passivedouble> buffer(nPoint);
+
+  for (unsigned short iField = writeMesh? 0 : nDim; iField < fieldNames.size(); iField++) {
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+      buffer[iPoint] = dataSorter->GetData(iField, iPoint);
+
+    const bool isCoord = (iField < nDim);
+    const string name = isCoord? string(coordNames[iField]) : CGNSName(fieldNames[iField]);
+
+#ifdef SU2_PARALLEL_CGNS
+    const void* data = nPoint? buffer.data() : nullptr;
+    if (isCoord) {
+      if (cgp_coord_write(fn, B, Z, CGNS_ENUMV(RealDouble), name.c_str(), &index)) cgp_error_exit();
+      if (cgp_coord_write_data(fn, B, Z, index, &pointRange[0], &pointRange[1], data)) cgp_error_exit();
+    }
+    else {
+      if (cgp_field_write(fn, B, Z, Sol, CGNS_ENUMV(RealDouble), name.c_str(), &index)) cgp_error_exit();
+      if (cgp_field_write_data(fn, B, Z, Sol, index, &pointRange[0], &pointRange[1], data)) cgp_error_exit();
+    }
+#else
+    if (nPoint == 0) continue;
+    if (isCoord) {
+      if (cg_coord_partial_write(fn, B, Z, CGNS_ENUMV(RealDouble), name.c_str(),
+                                 &pointRange[0], &pointRange[1], buffer.data(), &index)) cg_error_exit();
+    }
+    else {
+      if (cg_field_partial_write(fn, B, Z, Sol, CGNS_ENUMV(RealDouble), name.c_str(),
+                                 &pointRange[0], &pointRange[1], buffer.data(), &index)) cg_error_exit();
+    }
+#endif
+  }
+
+  /*--- Element sections, the connectivity of the sorters is already 1-based (the layout of
+   *  the steps appended to a time series has no sections). ---*/
+
+  for (unsigned short iSec = 0; iSec < layout.types.size(); iSec++) {
+
+    const auto type = static_cast<GEO_TYPE>(layout.types[iSec]);
+    const unsigned short nNode = elemNodes[TypeIndex(type)];
+    const unsigned long nElem = dataSorter->GetnElem(type);
+    const string name = "Elem_" + string(cg_ElementTypeName(CGNSElemType(type)));
+
+    vector<cgsize_t> conn(nElem*nNode);
+    for (unsigned long iElem = 0; iElem < nElem; iElem++)
+      for (unsigned short iNode = 0; iNode < nNode; iNode++)
+        conn[iElem*nNode + iNode] = dataSorter->GetElem_Connectivity(type, iElem, iNode);
+
+    const cgsize_t start = layout.localStart[iSec], end = start + cgsize_t(nElem) - 1;
+
+#ifdef SU2_PARALLEL_CGNS
+    if (cgp_section_write(fn, B, Z, name.c_str(), CGNSElemType(type), layout.sectionStart[iSec],
+                          layout.sectionEnd[iSec], 0, &index)) cgp_error_exit();
+    if (cgp_elements_write_data(fn, B, Z, index, start, end, nElem? conn.data() : nullptr)) cgp_error_exit();
+#else
+    if (master) {
+      if (cg_section_partial_write(fn, B, Z, name.c_str(), CGNSElemType(type), layout.sectionStart[iSec],
+                                   layout.sectionEnd[iSec], 0, &index)) cg_error_exit();
+    }
+    else {
+      /*--- Find the section created by the first rank. ---*/
+      int nSections = 0;
+      if (cg_nsections(fn, B, Z, &nSections)) cg_error_exit();
+      for (int S = 1; S <= nSections; S++) {
+        char secName[CGNS_STRING_SIZE];
+        CGNS_ENUMT(ElementType_t) secType;
+        cgsize_t secStart, secEnd;
+        int nBndry, parentFlag;
+        if (cg_section_read(fn, B, Z, S, secName, &secType, &secStart, &secEnd, &nBndry, &parentFlag))
+          cg_error_exit();
+        if (name == secName) index = S;
+      }
+    }
+    if (nElem > 0 && cg_elements_partial_write(fn, B, Z, index, start, end, conn.data())) cg_error_exit();
+#endif
+  }
+
+#ifdef SU2_PARALLEL_CGNS
+  if (cgp_close(fn)) cgp_error_exit();
+#else
+  if (cg_close(fn)) cg_error_exit();
+#endif
+
+#endif
+}
+
+void CCGNSFileWriter::WriteIterativeData(int fn) const {
+
+#ifdef HAVE_CGNS
+
+  const int B = 1, Z = 1;
+
+  /*--- Steps already in the series, those from this iteration on are replaced
+   *  (they were written by a run that is being repeated from an earlier step). ---*/
+
+  vector<double> times;
+  vector<int> iters;
+  char name[CGNS_STRING_SIZE];
+  int nSteps = 0;
+
+  if (!newSeries && cg_biter_read(fn, B, name, &nSteps) == CG_OK) {
+    times.resize(nSteps);
+    iters.resize(nSteps);
+
+    if (cg_goto(fn, B, "BaseIterativeData_t", 1, "end")) cg_error_exit();
+
+    int nArrays = 0;
+    if (cg_narrays(&nArrays)) cg_error_exit();
+
+    for (int A = 1; A <= nArrays; A++) {
+      CGNS_ENUMT(DataType_t) type;
+      int nDims = 0;
+      cgsize_t dims[12];
+      if (cg_array_info(A, name, &type, &nDims, dims)) cg_error_exit();
+      if (string(name) == "TimeValues" &&
+          cg_array_read_as(A, CGNS_ENUMV(RealDouble), times.data())) cg_error_exit();
+      if (string(name) == "IterationValues" &&
+          cg_array_read_as(A, CGNS_ENUMV(Integer), iters.data())) cg_error_exit();
+    }
+  }
+
+  vector<string> removed;
+  while (!iters.empty() && iters.back() >= int(timeIter)) {
+    removed.push_back(SolutionName(iters.back()));
+    iters.pop_back();
+    times.pop_back();
+  }
+
+  /*--- Delete their solutions (those that were written), the file only keeps the steps of the series. ---*/
+
+  if (!removed.empty()) {
+    int nSols = 0;
+    if (cg_nsols(fn, B, Z, &nSols)) cg_error_exit();
+
+    vector<string> existing;
+    for (int S = 1; S <= nSols; S++) {
+      CGNS_ENUMT(GridLocation_t) location;
+      if (cg_sol_info(fn, B, Z, S, name, &location)) cg_error_exit();
+      if (find(removed.begin(), removed.end(), string(name)) != removed.end()) existing.push_back(name);
+    }
+    for (const auto& solName : existing) {
+      if (cg_goto(fn, B, "Zone_t", Z, "end")) cg_error_exit();
+      if (cg_delete_node(solName.c_str())) cg_error_exit();
+    }
+  }
+  iters.push_back(timeIter);
+  times.push_back(physicalTime);
+  nSteps = iters.size();
+
+  /*--- Time and iteration of the steps. ---*/
+
+  const cgsize_t stepDims[] = {nSteps};
+
+  if (cg_biter_write(fn, B, "TimeIterValues", nSteps)) cg_error_exit();
+  if (cg_goto(fn, B, "BaseIterativeData_t", 1, "end")) cg_error_exit();
+  if (cg_array_write("TimeValues", CGNS_ENUMV(RealDouble), 1, stepDims, times.data())) cg_error_exit();
+  if (cg_array_write("IterationValues", CGNS_ENUMV(Integer), 1, stepDims, iters.data())) cg_error_exit();
+
+  /*--- Solution of each step, the names are blank padded to 32 characters. ---*/
+
+  vector<char> pointers(32*nSteps, ' ');
+  for (int iStep = 0; iStep < nSteps; iStep++) {
+    const string solName = SolutionName(iters[iStep]);
+    copy(solName.begin(), solName.end(), pointers.begin() + 32*iStep);
+  }
+  const cgsize_t pointerDims[] = {32, nSteps};
+
+  if (cg_ziter_write(fn, B, Z, "ZoneIterativeData")) cg_error_exit();
+  if (cg_goto(fn, B, "Zone_t", Z, "ZoneIterativeData_t", 1, "end")) cg_error_exit();
+  if (cg_array_write("FlowSolutionPointers", CGNS_ENUMV(Character), 2, pointerDims, pointers.data()))
+    cg_error_exit();
+
+#endif
+}
@@ -40,6 +40,8 @@ const map<unsigned short, unsigned short> CParallelDataSorter::TypeMap = {
   {PYRAMID, 6}
 };
 
+thread_local SU2_MPI::Comm CParallelDataSorter::outputComm = MPI_COMM_WORLD;
+
 CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &valFieldNames) :
   fieldNames(std::move(valFieldNames)){
 
@@ -142,7 +144,7 @@ void CParallelDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(doubleBuffer[ll]), count, MPI_DOUBLE, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     GetOutputComm(), &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -158,7 +160,7 @@ void CParallelDataSorter::SortOutputData() {
       int dest = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(connSend[ll]), count, MPI_DOUBLE, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+                     GetOutputComm(), &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -174,7 +176,7 @@ void CParallelDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(idRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage+nRecvs]));
+                     GetOutputComm(), &(recv_req[iMessage+nRecvs]));
       iMessage++;
     }
   }
@@ -190,7 +192,7 @@ void CParallelDataSorter::SortOutputData() {
       int dest   = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(idSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage+nSends]));
+                     GetOutputComm(), &(send_req[iMessage+nSends]));
       iMessage++;
     }
   }
@@ -262,7 +264,7 @@ void CParallelDataSorter::SortOutputData() {
   /*--- Reduce the total number of points we will write in the output files. ---*/
 
   SU2_MPI::Allreduce(&nPoints, &nPointsGlobal, 1,
-                     MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+                     MPI_UNSIGNED_LONG, MPI_SUM, GetOutputComm());
 
   /*--- Free temporary memory from communications ---*/
 
@@ -298,7 +300,7 @@ void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalI
    many cells it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nPoint_Send[1]), 1, MPI_INT,
-                    &(nPoint_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nPoint_Recv[1]), 1, MPI_INT, GetOutputComm());
 
   /*--- Prepare to send coordinates. First check how many
    messages we will be sending and receiving. Here we also put
@@ -346,6 +348,8 @@ void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalI
 
   Index = new unsigned long[nLocalPointsBeforeSort]();
 
+  globalIDBeforeSort.assign(globalID.begin(), globalID.begin()+nLocalPointsBeforeSort);
+
   /*--- Loop through our elements and load the elems and their
    additional data that we will send to the other procs. ---*/
 
@@ -414,7 +418,7 @@ void CParallelDataSorter::SetTotalElements(){
   
   /*--- Reduce the total number of cells we will be writing in the output files. ---*/
 
-  SU2_MPI::Allreduce(nElemPerType.data(), nElemPerTypeGlobal.data(), N_ELEM_TYPES, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(nElemPerType.data(), nElemPerTypeGlobal.data(), N_ELEM_TYPES, MPI_UNSIGNED_LONG, MPI_SUM, GetOutputComm());
   
   nElemGlobal = std::accumulate(nElemPerTypeGlobal.begin(), nElemPerTypeGlobal.end(), 0); 
   nElem  = std::accumulate(nElemPerType.begin(), nElemPerType.end(), 0);
@@ -451,10 +455,10 @@ void CParallelDataSorter::SetTotalElements(){
   /*--- Communicate the local counts to all ranks for building offsets. ---*/
 
   SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
-                    &(nElem_Cum[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElem_Cum[1]), 1, MPI_INT, GetOutputComm());
 
   SU2_MPI::Alltoall(&(nElemConn_Send[1]), 1, MPI_INT,
-                    &(nElemConn_Cum[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElemConn_Cum[1]), 1, MPI_INT, GetOutputComm());
 
   /*--- Put the counters into cumulative storage format. ---*/
 
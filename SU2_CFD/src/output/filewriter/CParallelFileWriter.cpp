@@ -116,6 +116,65 @@ bool CFileWriter::WriteMPIBinaryDataAll(const void *data, unsigned long sizeInBy
 
 }
 
+bool CFileWriter::WriteMPIBinaryDataAll(const void *data, const vector<int>& chunkSizes,
+                                        const vector<unsigned long>& chunkOffsets, unsigned long totalSizeInBytes){
+
+  startTime = SU2_MPI::Wtime();
+
+  unsigned long sizeInBytes = 0;
+  for (auto size : chunkSizes) sizeInBytes += size;
+
+#ifdef HAVE_MPI
+
+  MPI_Datatype filetype;
+
+  /*--- Describe the chunks of this rank within the global array. ---*/
+
+  vector<MPI_Aint> displace(chunkOffsets.begin(), chunkOffsets.end());
+  MPI_Type_create_hindexed(chunkSizes.size(), chunkSizes.data(), displace.data(), MPI_BYTE, &filetype);
+  MPI_Type_commit(&filetype);
+
+  MPI_File_set_view(fhw, disp, MPI_BYTE, filetype, (char*)"native", MPI_INFO_NULL);
+
+  /*--- Collective call for all ranks to write simultaneously. ---*/
+
+  int ierr = MPI_File_write_all(fhw, data, int(sizeInBytes), MPI_BYTE, MPI_STATUS_IGNORE);
+
+  MPI_Type_free(&filetype);
+
+  disp      += totalSizeInBytes;
+  fileSize  += sizeInBytes;
+
+  stopTime = SU2_MPI::Wtime();
+
+  usedTime += stopTime - startTime;
+
+  return (ierr == MPI_SUCCESS);
+#else
+
+  /*--- Position the chunks relative to the current end of the file. ---*/
+
+  const long start = ftell(fhw);
+  const char* chunk = static_cast<const char*>(data);
+  unsigned long bytesWritten = 0;
+
+  for (unsigned long iChunk = 0; iChunk < chunkSizes.size(); iChunk++) {
+    fseek(fhw, start + chunkOffsets[iChunk], SEEK_SET);
+    bytesWritten += fwrite(chunk, sizeof(char), chunkSizes[iChunk], fhw);
+    chunk += chunkSizes[iChunk];
+  }
+  fseek(fhw, start + totalSizeInBytes, SEEK_SET);
+  fileSize += bytesWritten;
+
+  stopTime = SU2_MPI::Wtime();
+
+  usedTime += stopTime - startTime;
+
+  return (bytesWritten == sizeInBytes);
+#endif
+
+}
+
 bool CFileWriter::WriteMPIBinaryData(const void *data, unsigned long sizeInBytes, unsigned short processor){
   
 #ifdef HAVE_MPI
@@ -216,14 +275,14 @@ bool CFileWriter::OpenMPIFile(){
    to write a fresh output file, so we delete any existing files and create
    a new one. ---*/
 
-  ierr = MPI_File_open(MPI_COMM_WORLD, fileName.c_str(),
+  ierr = MPI_File_open(GetOutputComm(), fileName.c_str(),
                        MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                        MPI_INFO_NULL, &fhw);
   if (ierr != MPI_SUCCESS)  {
     MPI_File_close(&fhw);
     if (rank == 0)
       MPI_File_delete(fileName.c_str(), MPI_INFO_NULL);
-    ierr = MPI_File_open(MPI_COMM_WORLD, fileName.c_str(),
+    ierr = MPI_File_open(GetOutputComm(), fileName.c_str(),
                          MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                          MPI_INFO_NULL, &fhw);
   }
@@ -264,7 +323,7 @@ bool CFileWriter::CloseMPIFile(){
 
   su2double my_fileSize = fileSize;
   SU2_MPI::Allreduce(&my_fileSize, &fileSize, 1,
-                     MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+                     MPI_DOUBLE, MPI_SUM, GetOutputComm());
 
   /*--- Compute and store the bandwidth ---*/
 
@@ -26,11 +26,25 @@
  */
 
 #include "../../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
+#include "../../../../Common/include/toolboxes/CRestartDataCodec.hpp"
+
+#include <algorithm>
 
 const string CSU2BinaryFileWriter::fileExt = ".dat";
 
-CSU2BinaryFileWriter::CSU2BinaryFileWriter(string valFileName, CParallelDataSorter *valDataSorter)  :
-  CFileWriter(std::move(valFileName), valDataSorter, fileExt){}
+CSU2BinaryFileWriter::CSU2BinaryFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                           vector<char> valSinglePrecision, unsigned short valCompression,
+                                           bool valPartitioned)  :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt),
+  singlePrecision(std::move(valSinglePrecision)),
+  compression(valCompression),
+  partitioned(valPartitioned) {
+
+  /*--- Storing everything in double precision does not need the table. ---*/
+
+  if (find(singlePrecision.begin(), singlePrecision.end(), 1) == singlePrecision.end())
+    singlePrecision.clear();
+}
 
 
 CSU2BinaryFileWriter::~CSU2BinaryFileWriter(){
@@ -46,7 +60,7 @@ void CSU2BinaryFileWriter::Write_Data(){
   const vector<string>& fieldNames = dataSorter->GetFieldNames();
   unsigned short nVar = fieldNames.size();
   unsigned long nParallel_Poin = dataSorter->GetnPoints();
-  unsigned long nPoint_Global = dataSorter->GetnPointsGlobal();
+  unsigned long nPoint_Global = partitioned? dataSorter->GetnGlobalPointsBeforeSort() : dataSorter->GetnPointsGlobal();
 
   char str_buf[CGNS_STRING_SIZE];
 
@@ -58,6 +72,18 @@ void CSU2BinaryFileWriter::Write_Data(){
   int var_buf_size = 5;
   int var_buf[5] = {535532, nVar, (int)nPoint_Global, 0, 0};
 
+  /*--- Encoded data is identified by the last two values, the format version and the flags. ---*/
+
+  int flags = 0;
+  if (!singlePrecision.empty()) flags |= CRestartDataCodec::MIXED_PRECISION;
+  if (compression > 0) flags |= CRestartDataCodec::COMPRESSED;
+  if (partitioned) flags |= CRestartDataCodec::PARTITIONED;
+
+  if (flags) {
+    var_buf[3] = CRestartDataCodec::FORMAT_VERSION;
+    var_buf[4] = flags;
+  }
+
   /*--- Open the file using MPI I/O ---*/
   
   OpenMPIFile();
@@ -76,20 +102,135 @@ void CSU2BinaryFileWriter::Write_Data(){
     strncpy(str_buf, fieldNames[iVar].c_str(), CGNS_STRING_SIZE);
     WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
   }
-    
-  /*--- Compute various data sizes --- */
-  
-  unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVar;
-  unsigned long sizeInBytesLocal    = sizeInBytesPerPoint*nParallel_Poin;
-  unsigned long sizeInBytesGlobal   = sizeInBytesPerPoint*nPoint_Global;
-  unsigned long offsetInBytes       = sizeInBytesPerPoint*dataSorter->GetnPointCumulative(rank);
-  
-  /*--- Collectively write the actual data to file ---*/
-  
-  WriteMPIBinaryDataAll(dataSorter->GetData(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+
+  if (flags) {
+
+    /*--- Collectively write the encoded data to file ---*/
+
+    WriteEncodedData(flags);
+  }
+  else {
+
+    /*--- Compute various data sizes --- */
+
+    unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVar;
+    unsigned long sizeInBytesLocal    = sizeInBytesPerPoint*nParallel_Poin;
+    unsigned long sizeInBytesGlobal   = sizeInBytesPerPoint*nPoint_Global;
+    unsigned long offsetInBytes       = sizeInBytesPerPoint*dataSorter->GetnPointCumulative(rank);
+
+    /*--- Collectively write the actual data to file ---*/
+
+    WriteMPIBinaryDataAll(dataSorter->GetData(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+  }
 
   /*--- Close the file ---*/
   
   CloseMPIFile();
 
 }
+
+void CSU2BinaryFileWriter::WriteEncodedData(int flags){
+
+  const unsigned long nVar = dataSorter->GetFieldNames().size();
+
+  const CRestartDataCodec codec(singlePrecision.empty()? vector<char>(nVar, 0) : singlePrecision);
+
+  if (flags & CRestartDataCodec::MIXED_PRECISION)
+    WriteMPIBinaryData(codec.GetPrecisionTable().data(), nVar*sizeof(char), MASTER_NODE);
+
+  /*--- Convert the points of this rank to records. The partitioned layout takes the data
+   of the points owned by this rank before the sort, in their local order. ---*/
+
+  const unsigned long recordSize = codec.GetRecordSize();
+  unsigned long nPoint_Local, nPoint_Global, recordOffset;
+  vector<char> records;
+
+  if (partitioned) {
+    nPoint_Local = dataSorter->GetnLocalPointsBeforeSort();
+    nPoint_Global = dataSorter->GetnGlobalPointsBeforeSort();
+
+    vector<unsigned long> allPoints(size);
+    SU2_MPI::Allgather(&nPoint_Local, 1, MPI_UNSIGNED_LONG, allPoints.data(), 1, MPI_UNSIGNED_LONG, GetOutputComm());
+    recordOffset = 0;
+    for (int iRank = 0; iRank < rank; iRank++) recordOffset += allPoints[iRank];
+
+    vector<passivedouble> values(nVar*nPoint_Local);
+    for (unsigned long iPoint = 0; iPoint < nPoint_Local; iPoint++)
+      for (unsigned long iVar = 0; iVar < nVar; iVar++)
+        values[iPoint*nVar+iVar] = SU2_TYPE::GetValue(dataSorter->GetUnsorted_Data(iPoint, iVar));
+
+    records.resize(recordSize*nPoint_Local);
+    codec.Encode(values.data(), nPoint_Local, records.data());
+  }
+  else {
+    nPoint_Local = dataSorter->GetnPoints();
+    nPoint_Global = dataSorter->GetnPointsGlobal();
+    recordOffset = dataSorter->GetnPointCumulative(rank);
+
+    records.resize(recordSize*nPoint_Local);
+    codec.Encode(dataSorter->GetData(), nPoint_Local, records.data());
+  }
+
+  if (!(flags & CRestartDataCodec::COMPRESSED)) {
+    WriteMPIBinaryDataAll(records.data(), recordSize*nPoint_Local, recordSize*nPoint_Global,
+                          recordSize*recordOffset);
+  }
+  else {
+
+    /*--- Compress the records in blocks, the position of the blocks of this rank in the
+     block table and in the data follows from the sizes of the ranks before it. ---*/
+
+    vector<unsigned long> blockTable;
+    vector<char> blocks;
+    codec.Compress(records.data(), nPoint_Local, compression, blockTable, blocks);
+    vector<char>().swap(records);
+
+    unsigned long localSize[2] = {blockTable.size()/2, blocks.size()};
+    vector<unsigned long> allSizes(2*size);
+    SU2_MPI::Allgather(localSize, 2, MPI_UNSIGNED_LONG, allSizes.data(), 2, MPI_UNSIGNED_LONG, GetOutputComm());
+
+    unsigned long nBlock = 0, blockOffset = 0, dataSize = 0, dataOffset = 0;
+    for (int iRank = 0; iRank < size; iRank++) {
+      if (iRank == rank) {
+        blockOffset = nBlock;
+        dataOffset = dataSize;
+      }
+      nBlock += allSizes[2*iRank];
+      dataSize += allSizes[2*iRank+1];
+    }
+
+    const unsigned long entrySize = 2*sizeof(unsigned long);
+
+    WriteMPIBinaryData(&nBlock, sizeof(unsigned long), MASTER_NODE);
+    WriteMPIBinaryDataAll(blockTable.data(), entrySize*localSize[0], entrySize*nBlock, entrySize*blockOffset);
+    WriteMPIBinaryDataAll(blocks.data(), blocks.size(), dataSize, dataOffset);
+  }
+
+  if (!partitioned) return;
+
+  /*--- Write the index map, the entry of each global point is the position of its record.
+   The entries of this rank are scattered over the map, they are written in increasing
+   order of global index, merging consecutive ones. ---*/
+
+  vector<pair<unsigned long, unsigned long> > entries(nPoint_Local);
+  for (unsigned long iPoint = 0; iPoint < nPoint_Local; iPoint++)
+    entries[iPoint] = make_pair(dataSorter->GetUnsorted_GlobalIndex(iPoint), recordOffset + iPoint);
+  sort(entries.begin(), entries.end());
+
+  vector<unsigned long> indexMap(nPoint_Local), chunkOffsets;
+  vector<int> chunkSizes;
+
+  for (unsigned long iPoint = 0; iPoint < nPoint_Local; iPoint++) {
+    indexMap[iPoint] = entries[iPoint].second;
+    if (iPoint > 0 && entries[iPoint].first == entries[iPoint-1].first+1) {
+      chunkSizes.back() += sizeof(unsigned long);
+    }
+    else {
+      chunkOffsets.push_back(entries[iPoint].first*sizeof(unsigned long));
+      chunkSizes.push_back(sizeof(unsigned long));
+    }
+  }
+
+  WriteMPIBinaryDataAll(indexMap.data(), chunkSizes, chunkOffsets, nPoint_Global*sizeof(unsigned long));
+
+}
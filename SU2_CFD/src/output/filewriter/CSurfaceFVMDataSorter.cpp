@@ -175,7 +175,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
    many nodes it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
-                    &(nElem_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElem_Recv[1]), 1, MPI_INT, GetOutputComm());
 
   /*--- Prepare to send. First check how many
    messages we will be sending and receiving. Here we also put
@@ -331,7 +331,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(idRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     GetOutputComm(), &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -347,7 +347,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int dest = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(idSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+                     GetOutputComm(), &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -425,7 +425,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   for (int ii=1; ii < size+1; ii++) nPoint_Send[ii]= (int)nPoints;
 
   SU2_MPI::Alltoall(&(nPoint_Send[1]), 1, MPI_INT,
-                    &(nPoint_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nPoint_Recv[1]), 1, MPI_INT, GetOutputComm());
 
   /*--- Go to cumulative storage format to compute the offsets. ---*/
 
@@ -457,7 +457,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
    needed for writing the surface solution files later. ---*/
 
   SU2_MPI::Allreduce(&nPoints, &nPointsGlobal, 1,
-                     MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+                     MPI_UNSIGNED_LONG, MPI_SUM, GetOutputComm());
 
   /*--- Now that we know every proc's global offset for the number of
    surface points, we can create the new global numbering. Here, we
@@ -524,7 +524,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
    many cells it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
-                    &(nElem_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElem_Recv[1]), 1, MPI_INT, GetOutputComm());
 
   /*--- Prepare to send. First check how many
    messages we will be sending and receiving. Here we also put
@@ -619,7 +619,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(globalRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     GetOutputComm(), &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -635,7 +635,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int dest = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(globalSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+                     GetOutputComm(), &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -651,7 +651,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(renumbRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage+nRecvs]));
+                     GetOutputComm(), &(recv_req[iMessage+nRecvs]));
       iMessage++;
     }
   }
@@ -667,7 +667,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int dest = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(renumbSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage+nSends]));
+                     GetOutputComm(), &(send_req[iMessage+nSends]));
       iMessage++;
     }
   }
@@ -825,7 +825,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
    many cells it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
-                    &(nElem_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElem_Recv[1]), 1, MPI_INT, GetOutputComm());
   
   /*--- Prepare to send connectivities. First check how many
    messages we will be sending and receiving. Here we also put
@@ -907,7 +907,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(idRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     GetOutputComm(), &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -923,7 +923,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int dest = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(idSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+                     GetOutputComm(), &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -984,7 +984,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int dest = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(idSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     GetOutputComm(), &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -1000,7 +1000,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
       int source = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(idRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+                     GetOutputComm(), &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -1226,7 +1226,7 @@ void CSurfaceFVMDataSorter::SortSurfaceConnectivity(CConfig *config, CGeometry *
    many cells it will receive from each other processor. ---*/
 
   SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
-                    &(nElem_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+                    &(nElem_Recv[1]), 1, MPI_INT, GetOutputComm());
 
   /*--- Prepare to send connectivities. First check how many
    messages we will be sending and receiving. Here we also put
@@ -1373,7 +1373,7 @@ void CSurfaceFVMDataSorter::SortSurfaceConnectivity(CConfig *config, CGeometry *
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(connRecv[ll]), count, MPI_UNSIGNED_LONG, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage]));
+                     GetOutputComm(), &(recv_req[iMessage]));
       iMessage++;
     }
   }
@@ -1389,7 +1389,7 @@ void CSurfaceFVMDataSorter::SortSurfaceConnectivity(CConfig *config, CGeometry *
       int dest = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(connSend[ll]), count, MPI_UNSIGNED_LONG, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage]));
+                     GetOutputComm(), &(send_req[iMessage]));
       iMessage++;
     }
   }
@@ -1405,7 +1405,7 @@ void CSurfaceFVMDataSorter::SortSurfaceConnectivity(CConfig *config, CGeometry *
       int source = ii;
       int tag    = ii + 1;
       SU2_MPI::Irecv(&(haloRecv[ll]), count, MPI_UNSIGNED_SHORT, source, tag,
-                     MPI_COMM_WORLD, &(recv_req[iMessage+nRecvs]));
+                     GetOutputComm(), &(recv_req[iMessage+nRecvs]));
       iMessage++;
     }
   }
@@ -1421,7 +1421,7 @@ void CSurfaceFVMDataSorter::SortSurfaceConnectivity(CConfig *config, CGeometry *
       int dest   = ii;
       int tag    = rank + 1;
       SU2_MPI::Isend(&(haloSend[ll]), count, MPI_UNSIGNED_SHORT, dest, tag,
-                     MPI_COMM_WORLD, &(send_req[iMessage+nSends]));
+                     GetOutputComm(), &(send_req[iMessage+nSends]));
       iMessage++;
     }
   }
@@ -125,33 +125,30 @@ CAdjTurbSolver::CAdjTurbSolver(CGeometry *geometry, CConfig *config, unsigned sh
     }
 
     /*--- Read all lines in the restart file ---*/
-    long iPoint_Local; unsigned long iPoint_Global = 0; unsigned long iPoint_Global_Local = 0;
+    unsigned long iPoint_Global = 0; unsigned long iPoint_Global_Local = 0;
     unsigned short rbuf_NotMatching = 0, sbuf_NotMatching = 0;
 
     /*--- The first line is the header ---*/
 
     getline (restart_file, text_line);
 
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+    for (auto iPoint_Local : geometry->GetDomainPointsInGlobalOrder()) {
 
-      getline (restart_file, text_line);
+      /*--- Skip the lines of the points of other ranks without parsing them. ---*/
 
-      istringstream point_line(text_line);
-
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
+      for (; iPoint_Global < geometry->nodes->GetGlobalIndex(iPoint_Local); iPoint_Global++)
+        restart_file.ignore(numeric_limits<streamsize>::max(), '\n');
 
-      iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+      if (!getline(restart_file, text_line)) break;
+      iPoint_Global++;
 
-      if (iPoint_Local > -1) {
-
-        if (nDim == 2) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
-        if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
-        nodes->SetSolution(iPoint_Local,0,Solution[0]);
-        nodes->SetSolution_Old(iPoint_Local,0,Solution[0]);
-        iPoint_Global_Local++;
-      }
+      istringstream point_line(text_line);
 
+      if (nDim == 2) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
+      if (nDim == 3) point_line >> index >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> dull_val >> Solution[0];
+      nodes->SetSolution(iPoint_Local,0,Solution[0]);
+      nodes->SetSolution_Old(iPoint_Local,0,Solution[0]);
+      iPoint_Global_Local++;
     }
 
     /*--- Detect a wrong solution file ---*/
@@ -393,66 +393,57 @@ void CBaselineSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConf
   }
 
   int counter = 0;
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
 
-  /*--- Load data from the restart into correct containers. ---*/
+  /*--- Load data from the restart into correct containers, looping over the points
+   of this rank in the order of their data in the restart buffer. ---*/
 
-  for (iPoint_Global = 0; iPoint_Global < geometry[iInst]->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+  for (auto iPoint_Local : geometry[iInst]->GetDomainPointsInGlobalOrder()) {
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-    iPoint_Local = geometry[iInst]->GetGlobal_to_Local_Point(iPoint_Global);
+    index = counter*Restart_Vars[1];
+    for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
+    nodes->SetSolution(iPoint_Local,Solution);
 
-    if (iPoint_Local > -1) {
+    /*--- For dynamic meshes, read in and store the
+     grid coordinates and grid velocities for each node. ---*/
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    if (dynamic_grid && val_update_geo) {
 
-      index = counter*Restart_Vars[1];
-      for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = Restart_Data[index+iVar];
-      nodes->SetSolution(iPoint_Local,Solution);
+      /*--- First, remove any variables for the turbulence model that
+       appear in the restart file before the grid velocities. ---*/
 
-      /*--- For dynamic meshes, read in and store the
-       grid coordinates and grid velocities for each node. ---*/
-
-      if (dynamic_grid && val_update_geo) {
-
-        /*--- First, remove any variables for the turbulence model that
-         appear in the restart file before the grid velocities. ---*/
-
-        if (turb_model == SA || turb_model == SA_NEG) {
-          index++;
-        } else if (turb_model == SST) {
-          index+=2;
-        }
-
-        /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
-        /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
-        /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
+      if (turb_model == SA || turb_model == SA_NEG) {
+        index++;
+      } else if (turb_model == SST) {
+        index+=2;
+      }
 
-        su2double GridVel[3] = {0.0,0.0,0.0};
-        if (!steady_restart) {
+      /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
+      /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
+      /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
 
-          /*--- Rewind the index to retrieve the Coords. ---*/
-          index = counter*Restart_Vars[1];
-          for (iDim = 0; iDim < nDim; iDim++) { Coord[iDim] = Restart_Data[index+iDim]; }
+      su2double GridVel[3] = {0.0,0.0,0.0};
+      if (!steady_restart) {
 
-          /*--- Move the index forward to get the grid velocities. ---*/
-          index = counter*Restart_Vars[1] + skipVars + nVar;
-          for (iDim = 0; iDim < nDim; iDim++) { GridVel[iDim] = Restart_Data[index+iDim]; }
-        }
+        /*--- Rewind the index to retrieve the Coords. ---*/
+        index = counter*Restart_Vars[1];
+        for (iDim = 0; iDim < nDim; iDim++) { Coord[iDim] = Restart_Data[index+iDim]; }
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          geometry[iInst]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
-          geometry[iInst]->nodes->SetGridVel(iPoint_Local, iDim, GridVel[iDim]);
-        }
+        /*--- Move the index forward to get the grid velocities. ---*/
+        index = counter*Restart_Vars[1] + skipVars + nVar;
+        for (iDim = 0; iDim < nDim; iDim++) { GridVel[iDim] = Restart_Data[index+iDim]; }
       }
 
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        geometry[iInst]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
+        geometry[iInst]->nodes->SetGridVel(iPoint_Local, iDim, GridVel[iDim]);
+      }
     }
 
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
   }
 
   /*--- MPI solution ---*/
@@ -522,32 +513,22 @@ void CBaselineSolver::LoadRestart_FSI(CGeometry *geometry, CConfig *config, int
   su2double *Solution_Local = new su2double[nVar_Local];
 
   int counter = 0;
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
 
-  /*--- Load data from the restart into correct containers. ---*/
+  /*--- Load data from the restart into correct containers, looping over the points
+   of this rank in the order of their data in the restart buffer. ---*/
 
-  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+  for (auto iPoint_Local : geometry->GetDomainPointsInGlobalOrder()) {
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-    iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+    index = counter*Restart_Vars[1];
+    for (iVar = 0; iVar < nVar_Local; iVar++) Solution[iVar] = Restart_Data[index+iVar];
+    nodes->SetSolution(iPoint_Local,Solution);
 
-    if (iPoint_Local > -1) {
-
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
-
-      index = counter*Restart_Vars[1];
-      for (iVar = 0; iVar < nVar_Local; iVar++) Solution[iVar] = Restart_Data[index+iVar];
-      nodes->SetSolution(iPoint_Local,Solution);
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-
-      counter++;
-
-    }
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
 
+    counter++;
   }
 
   delete [] Solution_Local;
@@ -2672,7 +2672,7 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 
   /*--- Loop domain points. ---*/
 
-  SU2_OMP_FOR_DYN(omp_chunk_size)
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (iPoint = 0; iPoint < nPointDomain; ++iPoint) {
 
     /*--- Set maximum eigenvalues to zero. ---*/
@@ -3355,7 +3355,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     SetRotatingFrame_GCL(geometry, config);
 
     /*--- Loop over all points ---*/
-    SU2_OMP_FOR_DYN(omp_chunk_size)
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /*--- Load the conservative variables ---*/
@@ -3380,7 +3380,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   if (axisymmetric) {
 
     /*--- loop over points ---*/
-    SU2_OMP_FOR_DYN(omp_chunk_size)
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /*--- Set solution  ---*/
@@ -3407,7 +3407,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   if (gravity) {
 
     /*--- loop over points ---*/
-    SU2_OMP_FOR_DYN(omp_chunk_size)
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /*--- Set solution  ---*/
@@ -3445,7 +3445,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   if (windgust) {
 
     /*--- Loop over all points ---*/
-    SU2_OMP_FOR_DYN(omp_chunk_size)
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
       /*--- Load the wind gust ---*/
@@ -3482,7 +3482,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       if (config->GetTime_Marching()) time = config->GetPhysicalTime();
 
       /*--- Loop over points ---*/
-      SU2_OMP_FOR_DYN(omp_chunk_size)
+      SU2_OMP_FOR_STAT(omp_chunk_size)
       for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
         /*--- Get control volume size. ---*/
@@ -3523,7 +3523,7 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
 
   /*--- Loop domain points. ---*/
 
-  SU2_OMP_FOR_DYN(omp_chunk_size)
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
 
     /*--- Set eigenvalues to zero. ---*/
@@ -3626,7 +3626,7 @@ void CEulerSolver::SetUndivided_Laplacian_And_Centered_Dissipation_Sensor(CGeome
 
   /*--- Loop domain points. ---*/
 
-  SU2_OMP_FOR_DYN(omp_chunk_size)
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
 
     const bool boundary_i = geometry->nodes->GetPhysicalBoundary(iPoint);
@@ -11504,66 +11504,60 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
 
   /*--- Load data from the restart into correct containers. ---*/
 
-  unsigned long counter = 0, iPoint_Global = 0;
-  for (; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
-
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+  unsigned long counter = 0;
 
-    auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+  /*--- Loop over the points of this rank, in the order of their data in the restart buffer. ---*/
 
-    if (iPoint_Local > -1) {
+  for (auto iPoint_Local : geometry[MESH_0]->GetDomainPointsInGlobalOrder()) {
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      index = counter*Restart_Vars[1] + skipVars;
-      for (iVar = 0; iVar < nVar; ++iVar)
-        nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index+iVar]);
+    index = counter*Restart_Vars[1] + skipVars;
+    for (iVar = 0; iVar < nVar; ++iVar)
+      nodes->SetSolution(iPoint_Local, iVar, Restart_Data[index+iVar]);
 
-      /*--- For dynamic meshes, read in and store the
-       grid coordinates and grid velocities for each node. ---*/
+    /*--- For dynamic meshes, read in and store the
+     grid coordinates and grid velocities for each node. ---*/
 
-      if (dynamic_grid && val_update_geo) {
+    if (dynamic_grid && val_update_geo) {
 
-        /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
-        /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
-        /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
+      /*--- Read in the next 2 or 3 variables which are the grid velocities ---*/
+      /*--- If we are restarting the solution from a previously computed static calculation (no grid movement) ---*/
+      /*--- the grid velocities are set to 0. This is useful for FSI computations ---*/
 
-        /*--- Rewind the index to retrieve the Coords. ---*/
-        index = counter*Restart_Vars[1];
-        Coord = &Restart_Data[index];
+      /*--- Rewind the index to retrieve the Coords. ---*/
+      index = counter*Restart_Vars[1];
+      Coord = &Restart_Data[index];
 
-        su2double GridVel[MAXNDIM] = {0.0};
-        if (!steady_restart) {
-          /*--- Move the index forward to get the grid velocities. ---*/
-          index += skipVars + nVar + turbVars;
-          for (iDim = 0; iDim < nDim; iDim++) { GridVel[iDim] = Restart_Data[index+iDim]; }
-        }
+      su2double GridVel[MAXNDIM] = {0.0};
+      if (!steady_restart) {
+        /*--- Move the index forward to get the grid velocities. ---*/
+        index += skipVars + nVar + turbVars;
+        for (iDim = 0; iDim < nDim; iDim++) { GridVel[iDim] = Restart_Data[index+iDim]; }
+      }
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
-          geometry[MESH_0]->nodes->SetGridVel(iPoint_Local, iDim, GridVel[iDim]);
-        }
+      for (iDim = 0; iDim < nDim; iDim++) {
+        geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
+        geometry[MESH_0]->nodes->SetGridVel(iPoint_Local, iDim, GridVel[iDim]);
       }
+    }
 
-      /*--- For static FSI problems, grid_movement is 0 but we need to read in and store the
-       grid coordinates for each node (but not the grid velocities, as there are none). ---*/
+    /*--- For static FSI problems, grid_movement is 0 but we need to read in and store the
+     grid coordinates for each node (but not the grid velocities, as there are none). ---*/
 
-      if (static_fsi && val_update_geo) {
-       /*--- Rewind the index to retrieve the Coords. ---*/
-        index = counter*Restart_Vars[1];
-        Coord = &Restart_Data[index];
+    if (static_fsi && val_update_geo) {
+     /*--- Rewind the index to retrieve the Coords. ---*/
+      index = counter*Restart_Vars[1];
+      Coord = &Restart_Data[index];
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
-        }
+      for (iDim = 0; iDim < nDim; iDim++) {
+        geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, Coord[iDim]);
       }
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
     }
 
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
   }
 
   /*--- Detect a wrong solution file ---*/
@@ -12549,181 +12543,113 @@ void CEulerSolver::MixedOut_Average (CConfig *config, su2double val_init_pressur
 void CEulerSolver::GatherInOutAverageValues(CConfig *config, CGeometry *geometry){
 
   unsigned short iMarker, iMarkerTP;
-  unsigned short iSpan;
+  unsigned short iSpan, iVar;
   int markerTP;
-  su2double     densityIn, pressureIn, normalVelocityIn, tangVelocityIn, radialVelocityIn;
-  su2double     densityOut, pressureOut, normalVelocityOut, tangVelocityOut, radialVelocityOut;
-  su2double     kineIn, omegaIn, nuIn, kineOut, omegaOut, nuOut;
   //TODO (turbo) implement interpolation so that Inflow and Outflow spanwise section can be different
 
-  for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
+  /*--- Density, pressure, normal, tangential and radial velocity, k, omega and nu, at the inflow
+   *    and outflow of each span. All spans are gathered on the master in a single message, behind
+   *    the turbomachinery marker of the rank (a negative density marks missing values). ---*/
 
-#ifdef HAVE_MPI
-    unsigned short i, n1, n2, n1t,n2t;
-    su2double *TurbPerfIn= NULL,*TurbPerfOut= NULL;
-    su2double *TotTurbPerfIn = NULL,*TotTurbPerfOut = NULL;
-    int *TotMarkerTP = NULL;
-
-    n1          = 8;
-    n2          = 8;
-    n1t         = n1*size;
-    n2t         = n2*size;
-    TurbPerfIn  = new su2double[n1];
-    TurbPerfOut = new su2double[n2];
-
-    for (i=0;i<n1;i++)
-      TurbPerfIn[i]    = -1.0;
-    for (i=0;i<n2;i++)
-      TurbPerfOut[i]   = -1.0;
-#endif
+  const unsigned short nPerf = 8;
+  const unsigned long nValues = 1 + 2*nPerf*(nSpanWiseSections+1);
 
-    densityIn            = -1.0;
-    pressureIn           = -1.0;
-    normalVelocityIn     = -1.0;
-    tangVelocityIn       = -1.0;
-    radialVelocityIn     = -1.0;
-    densityOut           = -1.0;
-    pressureOut          = -1.0;
-    normalVelocityOut    = -1.0;
-    tangVelocityOut      = -1.0;
-    radialVelocityOut    = -1.0;
-    kineIn               = -1.0;
-    omegaIn              = -1.0;
-    nuIn                 = -1.0;
-    kineOut              = -1.0;
-    omegaOut             = -1.0;
-    nuOut                = -1.0;
-
-    markerTP             = -1;
+  vector<su2double> turbPerf(nValues, -1.0);
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+    for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
+      if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
+        for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
+          su2double* perfIn  = &turbPerf[1 + 2*nPerf*iSpan];
+          su2double* perfOut = perfIn + nPerf;
 
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
           if (config->GetMarker_All_TurbomachineryFlag(iMarker) == INFLOW){
-            markerTP            = iMarkerTP;
-            densityIn           = DensityIn[iMarkerTP -1][iSpan];
-            pressureIn          = PressureIn[iMarkerTP -1][iSpan];
-            normalVelocityIn    = TurboVelocityIn[iMarkerTP -1][iSpan][0];
-            tangVelocityIn      = TurboVelocityIn[iMarkerTP -1][iSpan][1];
+            turbPerf[0] = iMarkerTP;
+            perfIn[0]   = DensityIn[iMarkerTP -1][iSpan];
+            perfIn[1]   = PressureIn[iMarkerTP -1][iSpan];
+            perfIn[2]   = TurboVelocityIn[iMarkerTP -1][iSpan][0];
+            perfIn[3]   = TurboVelocityIn[iMarkerTP -1][iSpan][1];
             if (nDim ==3){
-              radialVelocityIn  = TurboVelocityIn[iMarkerTP -1][iSpan][2];
+              perfIn[4] = TurboVelocityIn[iMarkerTP -1][iSpan][2];
             }
-            kineIn              = KineIn[iMarkerTP -1][iSpan];
-            omegaIn             = OmegaIn[iMarkerTP -1][iSpan];
-            nuIn                = NuIn[iMarkerTP -1][iSpan];
-
-#ifdef HAVE_MPI
-            TurbPerfIn[0]  = densityIn;
-            TurbPerfIn[1]  = pressureIn;
-            TurbPerfIn[2]  = normalVelocityIn;
-            TurbPerfIn[3]  = tangVelocityIn;
-            TurbPerfIn[4]  = radialVelocityIn;
-            TurbPerfIn[5]  = kineIn;
-            TurbPerfIn[6]  = omegaIn;
-            TurbPerfIn[7]  = nuIn;
-#endif
+            perfIn[5]   = KineIn[iMarkerTP -1][iSpan];
+            perfIn[6]   = OmegaIn[iMarkerTP -1][iSpan];
+            perfIn[7]   = NuIn[iMarkerTP -1][iSpan];
           }
 
           /*--- retrieve outlet information ---*/
           if (config->GetMarker_All_TurbomachineryFlag(iMarker) == OUTFLOW){
-            densityOut           = DensityOut[iMarkerTP -1][iSpan];
-            pressureOut          = PressureOut[iMarkerTP -1][iSpan];
-            normalVelocityOut    = TurboVelocityOut[iMarkerTP -1][iSpan][0];
-            tangVelocityOut      = TurboVelocityOut[iMarkerTP -1][iSpan][1];
+            perfOut[0]   = DensityOut[iMarkerTP -1][iSpan];
+            perfOut[1]   = PressureOut[iMarkerTP -1][iSpan];
+            perfOut[2]   = TurboVelocityOut[iMarkerTP -1][iSpan][0];
+            perfOut[3]   = TurboVelocityOut[iMarkerTP -1][iSpan][1];
             if (nDim ==3){
-              radialVelocityOut  = TurboVelocityOut[iMarkerTP -1][iSpan][2];
+              perfOut[4] = TurboVelocityOut[iMarkerTP -1][iSpan][2];
             }
-            kineOut              = KineOut[iMarkerTP -1][iSpan];
-            omegaOut             = OmegaOut[iMarkerTP -1][iSpan];
-            nuOut                = NuOut[iMarkerTP -1][iSpan];
-
-#ifdef HAVE_MPI
-            TurbPerfOut[0]  = densityOut;
-            TurbPerfOut[1]  = pressureOut;
-            TurbPerfOut[2]  = normalVelocityOut;
-            TurbPerfOut[3]  = tangVelocityOut;
-            TurbPerfOut[4]  = radialVelocityOut;
-            TurbPerfOut[5]  = kineOut;
-            TurbPerfOut[6]  = omegaOut;
-            TurbPerfOut[7]  = nuOut;
-#endif
+            perfOut[5]   = KineOut[iMarkerTP -1][iSpan];
+            perfOut[6]   = OmegaOut[iMarkerTP -1][iSpan];
+            perfOut[7]   = NuOut[iMarkerTP -1][iSpan];
           }
         }
       }
     }
+  }
 
 #ifdef HAVE_MPI
-    if (rank == MASTER_NODE){
-      TotTurbPerfIn       = new su2double[n1t];
-      TotTurbPerfOut      = new su2double[n2t];
-      for (i=0;i<n1t;i++)
-        TotTurbPerfIn[i]  = -1.0;
-      for (i=0;i<n2t;i++)
-        TotTurbPerfOut[i] = -1.0;
-      TotMarkerTP = new int[size];
-      for(i=0; i<size; i++){
-        TotMarkerTP[i]    = -1;
-      }
-    }
-    SU2_MPI::Gather(TurbPerfIn, n1, MPI_DOUBLE, TotTurbPerfIn, n1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(TurbPerfOut, n2, MPI_DOUBLE,TotTurbPerfOut, n2, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(&markerTP, 1, MPI_INT,TotMarkerTP, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
-    if (rank == MASTER_NODE){
-      delete [] TurbPerfIn, delete [] TurbPerfOut;
-    }
-
-    if (rank == MASTER_NODE){
-      for (i=0;i<size;i++){
-        if(TotTurbPerfIn[n1*i] > 0.0){
-          densityIn        = TotTurbPerfIn[n1*i];
-          pressureIn       = TotTurbPerfIn[n1*i+1];
-          normalVelocityIn = TotTurbPerfIn[n1*i+2];
-          tangVelocityIn   = TotTurbPerfIn[n1*i+3];
-          radialVelocityIn = TotTurbPerfIn[n1*i+4];
-          kineIn           = TotTurbPerfIn[n1*i+5];
-          omegaIn          = TotTurbPerfIn[n1*i+6];
-          nuIn             = TotTurbPerfIn[n1*i+7];
-          markerTP         = TotMarkerTP[i];
-        }
+  vector<su2double> totTurbPerf;
+  if (rank == MASTER_NODE) totTurbPerf.resize(nValues*size);
 
-        if(TotTurbPerfOut[n2*i] > 0.0){
-          densityOut        = TotTurbPerfOut[n1*i];
-          pressureOut       = TotTurbPerfOut[n1*i+1];
-          normalVelocityOut = TotTurbPerfOut[n1*i+2];
-          tangVelocityOut   = TotTurbPerfOut[n1*i+3];
-          radialVelocityOut = TotTurbPerfOut[n1*i+4];
-          kineOut           = TotTurbPerfOut[n1*i+5];
-          omegaOut          = TotTurbPerfOut[n1*i+6];
-          nuOut             = TotTurbPerfOut[n1*i+7];
-        }
-      }
+  SU2_MPI::Gather(turbPerf.data(), nValues, MPI_DOUBLE, totTurbPerf.data(), nValues, MPI_DOUBLE,
+                  MASTER_NODE, MPI_COMM_WORLD);
+#else
+  const vector<su2double>& totTurbPerf = turbPerf;
+#endif
 
-      delete [] TotTurbPerfIn, delete [] TotTurbPerfOut; delete [] TotMarkerTP;
-    }
+  if (rank != MASTER_NODE) return;
 
-#endif
+  /*--- Take the values from the (last) rank that has them, the marker comes with the inflow values. ---*/
 
-    if (rank == MASTER_NODE && markerTP > -1){
-      /*----Quantities needed for computing the turbomachinery performance -----*/
-      DensityIn[markerTP -1][iSpan]              = densityIn;
-      PressureIn[markerTP -1][iSpan]             = pressureIn;
-      TurboVelocityIn[markerTP -1][iSpan][0]     = normalVelocityIn;
-      TurboVelocityIn[markerTP -1][iSpan][1]     = tangVelocityIn;
-      if (nDim == 3)
-        TurboVelocityIn[markerTP -1][iSpan][2]   = radialVelocityIn;
-      KineIn[markerTP -1][iSpan]                 = kineIn;
-      OmegaIn[markerTP -1][iSpan]                = omegaIn;
-      NuIn[markerTP -1][iSpan]                   = nuIn;
-
-      DensityOut[markerTP -1][iSpan]             = densityOut;
-      PressureOut[markerTP -1][iSpan]            = pressureOut;
-      TurboVelocityOut[markerTP -1][iSpan][0]    = normalVelocityOut;
-      TurboVelocityOut[markerTP -1][iSpan][1]    = tangVelocityOut;
-      if (nDim == 3)
-        TurboVelocityOut[markerTP -1][iSpan][2]  = radialVelocityOut;
-      KineOut[markerTP -1][iSpan]                = kineOut;
-      OmegaOut[markerTP -1][iSpan]               = omegaOut;
-      NuOut[markerTP -1][iSpan]                  = nuOut;
-    }
+  for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
+    markerTP = -1;
+    const su2double *valIn = nullptr, *valOut = nullptr;
+
+    for (unsigned long iRank = 0; iRank < totTurbPerf.size()/nValues; iRank++){
+      const su2double* rankPerf = &totTurbPerf[iRank*nValues];
+      if (rankPerf[1 + 2*nPerf*iSpan] > 0.0){
+        valIn = &rankPerf[1 + 2*nPerf*iSpan];
+        markerTP = SU2_TYPE::Int(rankPerf[0]);
+      }
+      if (rankPerf[1 + 2*nPerf*iSpan + nPerf] > 0.0){
+        valOut = &rankPerf[1 + 2*nPerf*iSpan + nPerf];
+      }
+    }
+
+    if (markerTP < 0) continue;
+
+    /*--- Outflow values that were not found by any rank are stored as missing. ---*/
+    su2double missing[nPerf];
+    for (iVar = 0; iVar < nPerf; iVar++) missing[iVar] = -1.0;
+    if (valOut == nullptr) valOut = missing;
+
+    /*----Quantities needed for computing the turbomachinery performance -----*/
+    DensityIn[markerTP -1][iSpan]              = valIn[0];
+    PressureIn[markerTP -1][iSpan]             = valIn[1];
+    TurboVelocityIn[markerTP -1][iSpan][0]     = valIn[2];
+    TurboVelocityIn[markerTP -1][iSpan][1]     = valIn[3];
+    if (nDim == 3)
+      TurboVelocityIn[markerTP -1][iSpan][2]   = valIn[4];
+    KineIn[markerTP -1][iSpan]                 = valIn[5];
+    OmegaIn[markerTP -1][iSpan]                = valIn[6];
+    NuIn[markerTP -1][iSpan]                   = valIn[7];
+
+    DensityOut[markerTP -1][iSpan]             = valOut[0];
+    PressureOut[markerTP -1][iSpan]            = valOut[1];
+    TurboVelocityOut[markerTP -1][iSpan][0]    = valOut[2];
+    TurboVelocityOut[markerTP -1][iSpan][1]    = valOut[3];
+    if (nDim == 3)
+      TurboVelocityOut[markerTP -1][iSpan][2]  = valOut[4];
+    KineOut[markerTP -1][iSpan]                = valOut[5];
+    OmegaOut[markerTP -1][iSpan]               = valOut[6];
+    NuOut[markerTP -1][iSpan]                  = valOut[7];
   }
 }
@@ -2874,6 +2874,15 @@ void CFEASolver::ComputeAitken_Coefficient(CGeometry *geometry, CConfig *config,
 
     SetWAitken_Dyn(config->GetAitkenStatRelax());
 
+  }
+  else if (RelaxMethod_FSI == IQN_ILS) {
+
+    /*--- The step is computed by SetAitken_Relaxation, the first one after discarding the
+     *    history (see QUASI_NEWTON_REUSE_STEPS) is relaxed by the static factor. ---*/
+    const bool resetHistory = (iOuterIter == 0) &&
+                              (config->GetTimeIter() % (config->GetnQuasiNewtonReuseSteps()+1ul) == 0);
+    SetWAitken_Dyn(resetHistory? config->GetAitkenStatRelax() : 1.0);
+
   }
   else if (RelaxMethod_FSI == AITKEN_DYNAMIC) {
 
@@ -2942,6 +2951,49 @@ void CFEASolver::SetAitken_Relaxation(CGeometry *geometry, CConfig *config) {
 
   const su2double WAitken = GetWAitken_Dyn();
 
+  if (config->GetRelaxation_Method_FSI() == IQN_ILS) {
+
+    /*--- The fixed point maps the predicted displacements, seen by the fluid, to the calculated ones.
+     *    The history is discarded at the start of the coupling loop of every (QUASI_NEWTON_REUSE_STEPS+1)
+     *    time steps, in between the samples of previous steps are reused until they are shifted out. ---*/
+    if (fsiCorrector.size() == 0)
+      fsiCorrector.resize(config->GetnQuasiNewtonSamples(), nPoint, nDim, nPointDomain);
+
+    if ((config->GetOuterIter() == 0) &&
+        (config->GetTimeIter() % (config->GetnQuasiNewtonReuseSteps()+1ul) == 0)) fsiCorrector.reset();
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        fsiCorrector(iPoint,iDim) = SU2_TYPE::GetValue(nodes->GetSolution_Pred(iPoint, iDim));
+        fsiCorrector.FPresult(iPoint,iDim) = SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iDim));
+      }
+    }
+
+    fsiCorrector.compute();
+
+    /*--- The first step after a reset has no history, it is relaxed like the static Aitken relaxation. ---*/
+    SU2_OMP_PARALLEL_(for schedule(static,omp_chunk_size))
+    for (unsigned long iPoint=0; iPoint < nPoint; iPoint++) {
+
+      su2double* dispPred = nodes->GetSolution_Pred(iPoint);
+      const su2double* dispCalc = nodes->GetSolution(iPoint);
+
+      nodes->SetSolution_Pred_Old(iPoint);
+      nodes->SetSolution_Old(iPoint, dispCalc);
+
+      for (unsigned short iDim=0; iDim < nDim; iDim++) {
+        if (WAitken < 1.0) {
+          dispPred[iDim] = (1.0 - WAitken)*dispPred[iDim] + WAitken*dispCalc[iDim];
+          fsiCorrector(iPoint,iDim) = SU2_TYPE::GetValue(dispPred[iDim]);
+        }
+        else {
+          dispPred[iDim] = fsiCorrector(iPoint,iDim);
+        }
+      }
+    }
+    return;
+  }
+
   // To nPointDomain; we need to communicate the solutions (predicted, old and old predicted) after this routine
   SU2_OMP_PARALLEL_(for schedule(static,omp_chunk_size))
   for (unsigned long iPoint=0; iPoint < nPointDomain; iPoint++) {
@@ -3340,45 +3392,38 @@ void CFEASolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *c
 
   /*--- Load data from the restart into correct containers. ---*/
 
-  unsigned long iPoint_Global, counter = 0;
-
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
-
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+  unsigned long counter = 0;
 
-    auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+  /*--- Loop over the points of this rank, in the order of their data in the restart buffer. ---*/
 
-    if (iPoint_Local >= 0) {
+  for (auto iPoint_Local : geometry[MESH_0]->GetDomainPointsInGlobalOrder()) {
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-      const auto index = counter*Restart_Vars[1] + skipVars;
-      const passivedouble* Sol = &Restart_Data[index];
+    const auto index = counter*Restart_Vars[1] + skipVars;
+    const passivedouble* Sol = &Restart_Data[index];
 
-      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        nodes->SetSolution(iPoint_Local, iVar, Sol[iVar]);
-        if (dynamic) {
-          nodes->Set_Solution_time_n(iPoint_Local, iVar, Sol[iVar]);
-          nodes->SetSolution_Vel(iPoint_Local, iVar, Sol[iVar+nVar]);
-          nodes->SetSolution_Vel_time_n(iPoint_Local, iVar, Sol[iVar+nVar]);
-          nodes->SetSolution_Accel(iPoint_Local, iVar, Sol[iVar+2*nVar]);
-          nodes->SetSolution_Accel_time_n(iPoint_Local, iVar, Sol[iVar+2*nVar]);
-        }
-        if (fluid_structure && !dynamic) {
-          nodes->SetSolution_Pred(iPoint_Local, iVar, Sol[iVar]);
-          nodes->SetSolution_Pred_Old(iPoint_Local, iVar, Sol[iVar]);
-        }
-        if (fluid_structure && discrete_adjoint){
-          nodes->SetSolution_Old(iPoint_Local, iVar, Sol[iVar]);
-        }
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      nodes->SetSolution(iPoint_Local, iVar, Sol[iVar]);
+      if (dynamic) {
+        nodes->Set_Solution_time_n(iPoint_Local, iVar, Sol[iVar]);
+        nodes->SetSolution_Vel(iPoint_Local, iVar, Sol[iVar+nVar]);
+        nodes->SetSolution_Vel_time_n(iPoint_Local, iVar, Sol[iVar+nVar]);
+        nodes->SetSolution_Accel(iPoint_Local, iVar, Sol[iVar+2*nVar]);
+        nodes->SetSolution_Accel_time_n(iPoint_Local, iVar, Sol[iVar+2*nVar]);
+      }
+      if (fluid_structure && !dynamic) {
+        nodes->SetSolution_Pred(iPoint_Local, iVar, Sol[iVar]);
+        nodes->SetSolution_Pred_Old(iPoint_Local, iVar, Sol[iVar]);
+      }
+      if (fluid_structure && discrete_adjoint){
+        nodes->SetSolution_Old(iPoint_Local, iVar, Sol[iVar]);
       }
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
     }
 
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
   }
 
   /*--- Detect a wrong solution file. ---*/
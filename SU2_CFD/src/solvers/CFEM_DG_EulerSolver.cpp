@@ -32,14 +32,15 @@
 #include "../../include/fluid/CVanDerWaalsGas.hpp"
 #include "../../include/fluid/CPengRobinson.hpp"
 
+#include <mutex>
+#include <condition_variable>
+
 #define SIZE_ARR_NORM 8
 
 CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(void) : CSolver() {
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -72,8 +73,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = nullptr;
-
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr;  CEff_Inv = nullptr;
   CMx_Inv = nullptr; CMy_Inv = nullptr; CMz_Inv = nullptr;
   CFx_Inv = nullptr; CFy_Inv = nullptr; CFz_Inv = nullptr;
@@ -117,7 +116,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CSolver() {
 
   /*--- Array initialization ---*/
-  FluidModel = nullptr;
 
   CD_Inv = nullptr; CL_Inv = nullptr; CSF_Inv = nullptr; CEff_Inv = nullptr;
   CMx_Inv = nullptr;   CMy_Inv = nullptr;   CMz_Inv = nullptr;
@@ -733,7 +731,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver(void) {
 
-  delete FluidModel;
+  for (auto fluidModel : FluidModel) delete fluidModel;
   delete blasFunctions;
 
   /*--- Array deallocation ---*/
@@ -809,6 +807,8 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
   Density_FreeStream  = config->GetDensity_FreeStream();
   Temperature_FreeStream  = config->GetTemperature_FreeStream();
 
+  CFluidModel* auxFluidModel = nullptr;
+
   switch (config->GetKind_FluidModel()) {
 
     case STANDARD_AIR:
@@ -816,69 +816,69 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
       if (config->GetSystemMeasurements() == SI) config->SetGas_Constant(287.058);
       else if (config->GetSystemMeasurements() == US) config->SetGas_Constant(1716.49);
 
-      FluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case IDEAL_GAS:
 
-      FluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case VW_GAS:
 
-      FluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
+      auxFluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
                                        config->GetPressure_Critical(), config->GetTemperature_Critical());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case PR_GAS:
 
-      FluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
+      auxFluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
                                      config->GetTemperature_Critical(), config->GetAcentric_Factor());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
   }
 
-  Mach2Vel_FreeStream = FluidModel->GetSoundSpeed();
+  Mach2Vel_FreeStream = auxFluidModel->GetSoundSpeed();
 
   /*--- Compute the Free Stream velocity, using the Mach number ---*/
 
@@ -927,17 +927,17 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
             from the dimensional version of Sutherland's law or the constant
             viscosity, depending on the input option.---*/
 
-      FluidModel->SetLaminarViscosityModel(config);
+      auxFluidModel->SetLaminarViscosityModel(config);
 
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
 
       Density_FreeStream = Reynolds*Viscosity_FreeStream/(Velocity_Reynolds*config->GetLength_Reynolds());
       config->SetDensity_FreeStream(Density_FreeStream);
-      FluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
-      Pressure_FreeStream = FluidModel->GetPressure();
+      auxFluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
+      Pressure_FreeStream = auxFluidModel->GetPressure();
       config->SetPressure_FreeStream(Pressure_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -945,10 +945,10 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
     else {
 
-      FluidModel->SetLaminarViscosityModel(config);
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      auxFluidModel->SetLaminarViscosityModel(config);
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -962,7 +962,7 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
     /*--- For inviscid flow, energy is calculated from the specified
      FreeStream quantities using the proper gas law. ---*/
 
-    Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+    Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
   }
 
@@ -1043,35 +1043,41 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   /*--- Delete the original (dimensional) FluidModel object before replacing. ---*/
 
-  delete FluidModel;
+  delete auxFluidModel;
 
-  switch (config->GetKind_FluidModel()) {
+  /*--- Create one fluid model object per OpenMP thread, the tasks of ProcessTaskList_DG
+   *    may run concurrently. GetFluidModel() returns the object of the calling thread. ---*/
 
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+  for (auto fluidModel : FluidModel) delete fluidModel;
+  FluidModel.assign(omp_get_max_threads(), nullptr);
 
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+  for (auto& fluidModel : FluidModel) {
 
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+    switch (config->GetKind_FluidModel()) {
 
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case STANDARD_AIR:
+        fluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
 
+      case IDEAL_GAS:
+        fluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
+
+      case VW_GAS:
+        fluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                         config->GetTemperature_Critical()/config->GetTemperature_Ref());
+        break;
+
+      case PR_GAS:
+        fluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                       config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+        break;
+
+    }
+    fluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
   }
 
-  Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
+  Energy_FreeStreamND = FluidModel[0]->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
   if (viscous) {
 
@@ -1087,8 +1093,10 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
     /* constant thermal conductivity model */
     config->SetKt_ConstantND(config->GetKt_Constant()/Conductivity_Ref);
 
-    FluidModel->SetLaminarViscosityModel(config);
-    FluidModel->SetThermalConductivityModel(config);
+    for (auto fluidModel : FluidModel) {
+      fluidModel->SetLaminarViscosityModel(config);
+      fluidModel->SetThermalConductivityModel(config);
+    }
 
   }
 
@@ -2200,10 +2208,16 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
             prevInd[0] = indexInList[CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS][level];
             prevInd[1] = indexInList[CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS][level];
 
-            /* Create the task for the boundary conditions that involve halo elements. */
+            /* Create the task for the boundary conditions that involve halo elements.
+               For all but the first integration point, the face residuals of the
+               previous one must have been accumulated for the owned elements,
+               because this task overwrites them. */
             indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level] = (int)tasksList.size();
             tasksList.push_back(CTaskDefinition(CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO,
                                                 level, prevInd[0], prevInd[1]));
+            if(intPoint > 0)
+              tasksList.back().AddIndMustBeCompleted(
+                indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS][level]);
           }
 
           /* Compute the surface residuals for this time level that involve
@@ -2224,17 +2238,31 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
             else
               prevInd[2] = indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS][level];
 
-            /* Create the task for the surface residual. */
+            /* Create the task for the surface residual. The owned elements also
+               accumulate the residuals of these faces. */
             indexInList[CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS][level] = (int)tasksList.size();
             tasksList.push_back(CTaskDefinition(CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS,
                                                 level, prevInd[0], prevInd[1], prevInd[2]));
+            if(intPoint > 0)
+              tasksList.back().AddIndMustBeCompleted(
+                indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS][level]);
 
             /* Create the task to accumulate the surface residuals of the halo
-               elements. Make sure to set the integration point for this task. */
+               elements. Make sure to set the integration point for this task.
+               The accumulations of adjacent time levels update the residuals of
+               the same elements (those adjacent to a lower time level), hence
+               they must be carried out one after the other. */
             prevInd[0] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS][level];
+
+            prevInd[1] = prevInd[2] = -1;
+            if((level > 0) && haloElemAdjLowTimeLevel[level].size())
+              prevInd[1] = indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS][level-1];
+            if((level < (nTimeLevels-1)) && haloElemAdjLowTimeLevel[level+1].size())
+              prevInd[2] = indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS][level+1];
+
             indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS][level] = (int)tasksList.size();
             tasksList.push_back(CTaskDefinition(CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS,
-                                                level, prevInd[0]));
+                                                level, prevInd[0], prevInd[1], prevInd[2]));
             tasksList.back().intPointADER = intPoint;
           }
 
@@ -2310,7 +2338,7 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
             /* Create the dependencies for this task. */
             prevInd[0] = indexInList[CTaskDefinition::VOLUME_RESIDUAL][level];
             prevInd[1] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED][level];
-            prevInd[1] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level];
+            prevInd[2] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level];
             prevInd[3] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS][level];
             prevInd[4] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS][level];
 
@@ -2319,6 +2347,16 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
             tasksList.push_back(CTaskDefinition(CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS,
                                                 level, prevInd[0], prevInd[1], prevInd[2], prevInd[3], prevInd[4]));
             tasksList.back().intPointADER = intPoint;
+
+            /* The accumulations of adjacent time levels update the residuals of
+               the same elements (those adjacent to a lower time level), hence
+               they must be carried out one after the other. */
+            if((level > 0) && ownedElemAdjLowTimeLevel[level].size())
+              tasksList.back().AddIndMustBeCompleted(
+                indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS][level-1]);
+            if( nAdjOwnedElem )
+              tasksList.back().AddIndMustBeCompleted(
+                indexInList[CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS][level+1]);
           }
 
           /* If this is the last integration point, complete the reverse
@@ -3158,9 +3196,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
           const su2double Mom2         = solDOF[1]*solDOF[1] + solDOF[2]*solDOF[2];
           const su2double StaticEnergy = DensityInv*(solDOF[3] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3184,9 +3222,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
                                        + solDOF[3]*solDOF[3];
           const su2double StaticEnergy = DensityInv*(solDOF[4] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3642,8 +3680,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3674,8 +3712,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3783,314 +3821,362 @@ void CFEM_DG_EulerSolver::CheckTimeSynchronization(CConfig         *config,
 void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **solver_container,
                                              CNumerics **numerics, CConfig *config,
                                              unsigned short iMesh) {
-  /* Easier storage of the number of time levels.. */
-  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
-  /* Define and initialize the bool vector, that indicates whether or
-     not the tasks from the list have been completed. */
-  vector<bool> taskCompleted(tasksList.size(), false);
+  /* Possible states of the tasks in the list. */
+  enum TaskState : unsigned short {NOT_STARTED = 0, IN_PROGRESS = 1, COMPLETED = 2};
 
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
-  su2double *workArray = workArrayVec.data();
-
-  /* While loop to carry out all the tasks in tasksList. */
+  /* Define and initialize the vector, that indicates the state of the tasks
+     from the list. It is shared by all threads and only accessed while holding
+     taskMutex, together with lowestIndexInList and nCompletions. */
+  const unsigned long nTasks = tasksList.size();
+  vector<TaskState> taskState(nTasks, NOT_STARTED);
   unsigned long lowestIndexInList = 0;
-  while(lowestIndexInList < tasksList.size()) {
-
-    /* Find the next task that can be carried out. The outer loop is there
-       to make sure that a communication is completed in case there are no
-       other tasks */
-    for(unsigned short j=0; j<2; ++j) {
-      bool taskCarriedOut = false;
-      for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
-
-        /* Determine whether or not it can be attempted to carry out
-           this task. */
-        bool taskCanBeCarriedOut = !taskCompleted[i];
-        for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
-          if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
-            taskCanBeCarriedOut = false;
+
+  /* Threads without work wait on taskCompleted, which is notified whenever a
+     task is completed, as that may release new tasks. nCompletions is used to
+     detect completions that occur between searching the list and waiting. */
+  std::mutex taskMutex;
+  std::condition_variable taskCompleted;
+  unsigned long nCompletions = 0;
+
+  /*--- The tasks whose dependencies are completed are carried out concurrently
+        by the available threads, e.g. the volume residual can be computed while
+        the halo data is being communicated. MPI is only called by the master
+        thread, hence it is responsible for the communication tasks. While a
+        communication is in progress the master thread keeps testing it in
+        between other tasks, it only blocks when there is nothing else to do.
+        With a single thread this is identical to the serial algorithm. ---*/
+
+  SU2_OMP_PARALLEL
+  {
+    /* Allocate the memory for the work array of this thread and initialize it
+       to zero to avoid warnings in debug mode about uninitialized memory when
+       padding is applied. */
+    vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+    su2double *workArray = workArrayVec.data();
+
+    const bool commThread = (omp_get_thread_num() == 0);
+
+    /* Communication task that could not be completed without blocking. It is
+       attempted again when no other task is available. Only used by the master. */
+    long pendingComm = -1;
+
+    while( true ) {
+
+      long iTask = -1;
+      bool waitComm = false;
+      {
+        std::unique_lock<std::mutex> lock(taskMutex);
+
+        while( true ) {
+
+          /* Update the value of lowestIndexInList. */
+          for(; lowestIndexInList < nTasks; ++lowestIndexInList)
+            if(taskState[lowestIndexInList] != COMPLETED) break;
+          if(lowestIndexInList == nTasks) break;
+
+          /* Find the first task that can be carried out by this thread. */
+          bool tasksInProgress = false;
+          for(unsigned long i=lowestIndexInList; i<nTasks; ++i) {
+
+            if(taskState[i] == IN_PROGRESS) tasksInProgress = true;
+            if((taskState[i] != NOT_STARTED) || (long(i) == pendingComm)) continue;
+            if(!commThread && IsCommunicationTask(tasksList[i].task)) continue;
+
+            bool taskCanBeCarriedOut = true;
+            for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
+              if(taskState[tasksList[i].indMustBeCompleted[ind]] != COMPLETED)
+                taskCanBeCarriedOut = false;
+            }
+
+            if( taskCanBeCarriedOut ) {
+              iTask = i;
+              break;
+            }
+          }
+
+          /* If nothing else can be done, attempt the pending communication again.
+             Only block if no other thread is working, since the tasks in progress
+             may release new work for the master thread. */
+          if((iTask < 0) && (pendingComm >= 0)) {
+            iTask    = pendingComm;
+            waitComm = !tasksInProgress;
+          }
+
+          if(iTask >= 0) {
+            taskState[iTask] = IN_PROGRESS;
+            break;
+          }
+
+          /* Nothing to do for this thread, sleep until another task is completed. */
+          const unsigned long nCompletionsSeen = nCompletions;
+          taskCompleted.wait(lock, [&]() { return nCompletions != nCompletionsSeen; });
         }
+      }
 
-        if( taskCanBeCarriedOut ) {
+      /* All tasks are completed. */
+      if(iTask < 0) break;
 
-          /*--- Determine the actual task to be carried out and do so. The
-                only tasks that may fail are the completion of the non-blocking
-                communication. If that is the case the next task needs to be
-                found. ---*/
-          switch( tasksList[i].task ) {
+      /* Carry out the task and update its state. */
+      const bool taskWasCompleted = ProcessTask_DG(iTask, waitComm, numerics, config, workArray);
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
+      {
+        std::lock_guard<std::mutex> lock(taskMutex);
+        taskState[iTask] = taskWasCompleted? COMPLETED : NOT_STARTED;
+        if( taskWasCompleted ) ++nCompletions;
+      }
+      if( taskWasCompleted ) taskCompleted.notify_all();
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+      if( !taskWasCompleted ) pendingComm = iTask;
+      else if(iTask == pendingComm) pendingComm = -1;
+    }
+  }
+}
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+bool CFEM_DG_EulerSolver::ProcessTask_DG(const unsigned long iTask,
+                                         const bool          waitComm,
+                                         CNumerics           **numerics,
+                                         CConfig             *config,
+                                         su2double           *workArray) {
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
+  /* Easier storage of the number of time levels.. */
+  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must not be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /*--- Determine the actual task to be carried out and do so. The only tasks
+        that may fail are the completion of the non-blocking communication. ---*/
+  switch( tasksList[iTask].task ) {
 
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
 
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Carry out the ADER predictor step for the elements whose
+         solution must be communicated for this time level. */
+      const unsigned short level   = tasksList[iTask].timeLevel;
+      const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
+                                   + nVolElemInternalPerTimeLevel[level];
+      const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
 
-            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the solution data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+      return true;
+    }
 
-            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Carry out the ADER predictor step for the elements whose
+         solution must not be communicated for this time level. */
+      const unsigned short level   = tasksList[iTask].timeLevel;
+      const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
+      const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
+                                   + nVolElemInternalPerTimeLevel[level];
+      ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+      return true;
+    }
 
-            case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
+      /* Start the MPI communication of the solution in the halo elements. */
+      Initiate_MPI_Communication(config, tasksList[iTask].timeLevel);
+      return true;
+    }
 
-              /* Interpolate the predictor solution of the owned elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
-                adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
-              }
+    case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Attempt to complete the MPI communication of the solution data.
+         If waitComm is false, SU2_MPI::Testall will be used, which returns
+         false if not all requests can be completed. In that case the task
+         is attempted again later. Otherwise no other work is available and
+         MPI_Waitall is used. */
+      return Complete_MPI_Communication(config, tasksList[iTask].timeLevel, waitComm);
+    }
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+    case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
 
-              /* Interpolate the predictor solution of the halo elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
-                adjElem  = haloElemAdjLowTimeLevel[level+1].data();
-              }
+      /* Start the communication of the residuals, for which the
+         reverse communication must be used. */
+      Initiate_MPI_ReverseCommunication(config, tasksList[iTask].timeLevel);
+      return true;
+    }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemHaloPerTimeLevel[level],
-                                                  nVolElemHaloPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+      /* Attempt to complete the MPI communication of the residual data.
+         If waitComm is false, SU2_MPI::Testall will be used, which returns
+         false if not all requests can be completed. In that case the task
+         is attempted again later. Otherwise no other work is available and
+         MPI_Waitall is used. */
+      return Complete_MPI_ReverseCommunication(config, tasksList[iTask].timeLevel, waitComm);
+    }
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+      /* Interpolate the predictor solution of the owned elements
+         in time to the given time integration point for the
+         given time level. */
+      const unsigned short level = tasksList[iTask].timeLevel;
+      unsigned long nAdjElem = 0, *adjElem = nullptr;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
+        adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
+      }
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      ADER_DG_TimeInterpolatePredictorSol(config, tasksList[iTask].intPointADER,
+                                          nVolElemOwnedPerTimeLevel[level],
+                                          nVolElemOwnedPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          tasksList[iTask].secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      return true;
+    }
+
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+
+      /* Interpolate the predictor solution of the halo elements
+         in time to the given time integration point for the
+         given time level. */
+      const unsigned short level = tasksList[iTask].timeLevel;
+      unsigned long nAdjElem = 0, *adjElem = nullptr;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
+        adjElem  = haloElemAdjLowTimeLevel[level+1].data();
+      }
 
-            case CTaskDefinition::VOLUME_RESIDUAL: {
+      ADER_DG_TimeInterpolatePredictorSol(config, tasksList[iTask].intPointADER,
+                                          nVolElemHaloPerTimeLevel[level],
+                                          nVolElemHaloPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          tasksList[iTask].secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      return true;
+    }
 
-              /*--- Compute the volume portion of the residual. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      const unsigned short level = tasksList[iTask].timeLevel;
+      Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
+                         nVolElemOwnedPerTimeLevel[level+1], workArray);
+      return true;
+    }
 
-              /* Compute the residual of the faces that only involve owned elements. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
 
-            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      const unsigned short level = tasksList[iTask].timeLevel;
+      Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
+                         nVolElemHaloPerTimeLevel[level+1], workArray);
+      return true;
+    }
 
-              /* Compute the residual of the faces that involve a halo element. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::VOLUME_RESIDUAL: {
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+      /*--- Compute the volume portion of the residual. ---*/
+      const unsigned short level = tasksList[iTask].timeLevel;
+      Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
+                      nVolElemOwnedPerTimeLevel[level+1], workArray);
+      return true;
+    }
 
-              /*--- Apply the boundary conditions that only depend on data
-                    of owned elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+      /* Compute the residual of the faces that only involve owned elements. */
+      const unsigned short level = tasksList[iTask].timeLevel;
+      unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
+      ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
+                    nMatchingInternalFacesLocalElem[level+1],
+                    indResFaces, numerics[CONV_TERM], workArray);
+      return true;
+    }
 
-              /*--- Apply the boundary conditions that also depend on data
-                    of halo elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+      /* Compute the residual of the faces that involve a halo element. */
+      const unsigned short level = tasksList[iTask].timeLevel;
+      unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
+      ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
+                    nMatchingInternalFacesWithHaloElem[level+1],
+                    indResFaces, numerics[CONV_TERM], workArray);
+      return true;
+    }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, true);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+      /*--- Apply the boundary conditions that only depend on data
+            of owned elements. ---*/
+      Boundary_Conditions(tasksList[iTask].timeLevel, config, numerics, false,
+                          workArray);
+      return true;
+    }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, false);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+      /*--- Apply the boundary conditions that also depend on data
+            of halo elements. ---*/
+      Boundary_Conditions(tasksList[iTask].timeLevel, config, numerics, true,
+                          workArray);
+      return true;
+    }
 
-              /* Accumulate the space time residuals for the owned elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
-                                                       tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(tasksList[iTask].timeLevel, true);
+      return true;
+    }
 
-              /* Accumulate the space time residuals for the halo elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
-                                                      tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
 
-            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(tasksList[iTask].timeLevel, false);
+      return true;
+    }
 
-              /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+      /* Accumulate the space time residuals for the owned elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[iTask].timeLevel,
+                                               tasksList[iTask].intPointADER);
+      return true;
+    }
 
-              /*--- Perform the update step for ADER-DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+
+      /* Accumulate the space time residuals for the halo elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[iTask].timeLevel,
+                                              tasksList[iTask].intPointADER);
+      return true;
+    }
 
-            default: {
+    case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
-            }
-          }
-        }
+      /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
+      const unsigned short level = tasksList[iTask].timeLevel;
+      const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+      MultiplyResidualByInverseMassMatrix(config, useADER,
+                                          nVolElemOwnedPerTimeLevel[level],
+                                          nVolElemOwnedPerTimeLevel[level+1],
+                                          workArray);
+      return true;
+    }
 
-        /* Break the inner loop if a task has been carried out. */
-        if( taskCarriedOut ) break;
-      }
+    case CTaskDefinition::ADER_UPDATE_SOLUTION: {
 
-      /* Break the outer loop if a task has been carried out. */
-      if( taskCarriedOut ) break;
+      /*--- Perform the update step for ADER-DG. ---*/
+      const unsigned short level = tasksList[iTask].timeLevel;
+      ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
+                        nVolElemOwnedPerTimeLevel[level+1]);
+      return true;
     }
 
-    /* Update the value of lowestIndexInList. */
-    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
-      if( !taskCompleted[lowestIndexInList] ) break;
+    default: {
+
+      cout << "Task not defined. This should not happen." << endl;
+      exit(1);
+    }
   }
+
+  return false;
+
 }
 
 void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolver **solver_container,
@@ -4746,8 +4832,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -4995,8 +5081,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5285,8 +5371,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5500,8 +5586,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5885,8 +5971,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -5980,8 +6066,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6889,8 +6975,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config)
                   const su2double v            = sol[2]*DensityInv;
                   const su2double StaticEnergy = sol[3]*DensityInv - 0.5*(u*u + v*v);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -6942,8 +7028,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config)
                   const su2double w            = sol[3]*DensityInv;
                   const su2double StaticEnergy = sol[4]*DensityInv - 0.5*(u*u + v*v + w*w);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7557,9 +7643,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Inlet(CConfig                  *config,
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Compute the Riemann invariant to be extrapolated. ---*/
       const su2double Riemann = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One + VelocityNormal;
@@ -7665,9 +7751,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Outlet(CConfig                  *config
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Subsonic exit flow: there is one incoming characteristic,
             therefore one variable can be specified (back pressure) and is used
@@ -7729,10 +7815,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
       T_Total /= config->GetTemperature_Ref();
 
       /* Compute the total enthalpy and entropy from these values. */
-      FluidModel->SetTDState_PT(P_Total, T_Total);
-      const su2double Enthalpy_e = FluidModel->GetStaticEnergy()
-                                 + FluidModel->GetPressure()/FluidModel->GetDensity();
-      const su2double Entropy_e  = FluidModel->GetEntropy();
+      GetFluidModel()->SetTDState_PT(P_Total, T_Total);
+      const su2double Enthalpy_e = GetFluidModel()->GetStaticEnergy()
+                                 + GetFluidModel()->GetPressure()/GetFluidModel()->GetDensity();
+      const su2double Entropy_e  = GetFluidModel()->GetEntropy();
 
       /* Loop over the faces that are treated simultaneously. */
       for(unsigned short l=0; l<nFaceSimul; ++l) {
@@ -7759,9 +7845,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
              and total energy per unit mass for the right state. */
           const su2double StaticEnthalpy_e = Enthalpy_e - 0.5*Velocity2_e;
 
-          FluidModel->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
-          const su2double Density_e = FluidModel->GetDensity();
-          const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
+          GetFluidModel()->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
+          const su2double Density_e = GetFluidModel()->GetDensity();
+          const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
           const su2double Energy_e       = StaticEnergy_e + 0.5*Velocity2_e;
 
           /* Set the conservative variables of the right state. */
@@ -7791,10 +7877,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed density, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_PT(P_static, T_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_PT(P_static, T_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7842,10 +7928,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed pressure, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_Prho(P_static, Rho_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_Prho(P_static, Rho_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7939,7 +8025,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
           /* Extrapolate the density and set the thermodynamic state. */
           UR[0] = UL[0];
-          FluidModel->SetTDState_Prho(Pressure_e, UR[0]);
+          GetFluidModel()->SetTDState_Prho(Pressure_e, UR[0]);
 
           /* Extrapolate the velocity. As the density is also extrapolated,
              this means that the momentum variables are identical for UL and UR.
@@ -7954,7 +8040,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           }
 
           /* Compute the total energy per unit volume. */
-          UR[nDim+1] = UR[0]*(FluidModel->GetStaticEnergy() + 0.5*Velocity2_e);
+          UR[nDim+1] = UR[0]*(GetFluidModel()->GetStaticEnergy() + 0.5*Velocity2_e);
         }
       }
 
@@ -8005,11 +8091,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double ny  = normals[1];
           const su2double vnL = vxL*nx + vyL*ny;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[3] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -8084,11 +8170,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double nz  = normals[2];
           const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[4] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -9298,99 +9384,104 @@ void CFEM_DG_EulerSolver::ComputeInviscidFluxesFace(CConfig              *config
     default: {
 
       /* Riemann solver not explicitly implemented. Fall back to the
-         implementation via numerics. This is not efficient. */
-
-      /*--- Data for loading into the CNumerics Riemann solvers.
-       This is temporary and not efficient.. just replicating exactly
-       the arrays we typically have in order to avoid bugs. We can
-       probably be more clever with pointers, etc. ---*/
-      su2double Normal[3];
-      su2double Prim_L[8];
-      su2double Prim_R[8];
-
-      Jacobian_i = new su2double*[nVar];
-      Jacobian_j = new su2double*[nVar];
-      for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
-        Jacobian_i[iVar] = new su2double[nVar];
-        Jacobian_j[iVar] = new su2double[nVar];
-      }
-
-      /* Loop over the number of faces treated simultaneously. */
-      for(unsigned short l=0; l<nFaceSimul; ++l) {
-
-        /* Easier storage for some variables of this face. */
-        const su2double *normals   = normalsFace[l];
-        const su2double *gridVels  = gridVelsFace[l];
-        const unsigned short lNVar = l*nVar;
-
-        /* Loop over the number of points for this face. */
-        for(unsigned long i=0; i<nPoints; ++i) {
-
-          /* Easier storage of the left and right solution, the face normals,
-             the grid velocities and the flux vector for this point. */
-          const unsigned long offPointer = i*NPad + lNVar;
+         implementation via numerics. This is not efficient. The numerics
+         object and the Jacobians are shared, hence the tasks of
+         ProcessTaskList_DG may not execute this part concurrently. */
+      SU2_OMP_CRITICAL
+      {
+
+        /*--- Data for loading into the CNumerics Riemann solvers.
+         This is temporary and not efficient.. just replicating exactly
+         the arrays we typically have in order to avoid bugs. We can
+         probably be more clever with pointers, etc. ---*/
+        su2double Normal[3];
+        su2double Prim_L[8];
+        su2double Prim_R[8];
+
+        Jacobian_i = new su2double*[nVar];
+        Jacobian_j = new su2double*[nVar];
+        for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+          Jacobian_i[iVar] = new su2double[nVar];
+          Jacobian_j[iVar] = new su2double[nVar];
+        }
 
-          const su2double *UL      = solL + offPointer;
-          const su2double *UR      = solR + offPointer;
-          const su2double *norm    = normals + i*(nDim+1);
-          const su2double *gridVel = gridVels + i*nDim;
-                su2double *flux    = fluxes + offPointer;
+        /* Loop over the number of faces treated simultaneously. */
+        for(unsigned short l=0; l<nFaceSimul; ++l) {
+
+          /* Easier storage for some variables of this face. */
+          const su2double *normals   = normalsFace[l];
+          const su2double *gridVels  = gridVelsFace[l];
+          const unsigned short lNVar = l*nVar;
+
+          /* Loop over the number of points for this face. */
+          for(unsigned long i=0; i<nPoints; ++i) {
+
+            /* Easier storage of the left and right solution, the face normals,
+               the grid velocities and the flux vector for this point. */
+            const unsigned long offPointer = i*NPad + lNVar;
+
+            const su2double *UL      = solL + offPointer;
+            const su2double *UR      = solR + offPointer;
+            const su2double *norm    = normals + i*(nDim+1);
+            const su2double *gridVel = gridVels + i*nDim;
+                  su2double *flux    = fluxes + offPointer;
+
+            /*--- Store and load the normal into numerics. ---*/
+            for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+              Normal[iDim] = norm[iDim]*norm[nDim];
+            numerics->SetNormal(Normal);
+
+            /*--- Load the grid velocities into numerics. ---*/
+            su2double vGrid[] = {0.0, 0.0, 0.0};
+            for(unsigned short iDim=0; iDim<nDim; ++iDim)
+              vGrid[iDim] = gridVel[iDim];
+            numerics->SetGridVel(vGrid, vGrid);
+
+            /*--- Prepare the primitive states for the numerics class. Note
+             that for the FV solver, we have the following primitive
+             variable ordering: Compressible flow, primitive variables nDim+5,
+             (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+
+            /*--- Left primitive state ---*/
+            Prim_L[0] = 0.0;                                        // Temperature (unused)
+            Prim_L[nDim+1] = gm1*UL[nVar-1];
+            for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+              Prim_L[iDim+1]  = UL[iDim+1]/UL[0];                   // Velocities
+              Prim_L[nDim+1] -= gm1*0.5*Prim_L[iDim+1]*UL[iDim+1];  // Pressure
+            }
+            Prim_L[nDim+2] = UL[0];                                 // Density
+            Prim_L[nDim+3] = (UL[nVar-1] + Prim_L[nDim+1]) / UL[0]; // Enthalpy
+
+            /*--- Right primitive state ---*/
+            Prim_R[0] = 0.0;                                        // Temperature (unused)
+            Prim_R[nDim+1] = gm1*UR[nVar-1];
+            for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+              Prim_R[iDim+1]  = UR[iDim+1]/UR[0];                   // Velocities
+              Prim_R[nDim+1] -= gm1*0.5*Prim_R[iDim+1]*UR[iDim+1];  // Pressure
+            }
+            Prim_R[nDim+2] = UR[0];                                 // Density
+            Prim_R[nDim+3] = (UR[nVar-1] + Prim_R[nDim+1]) / UR[0]; // Enthalpy
 
-          /*--- Store and load the normal into numerics. ---*/
-          for (unsigned short iDim = 0; iDim < nDim; ++iDim)
-            Normal[iDim] = norm[iDim]*norm[nDim];
-          numerics->SetNormal(Normal);
+            /*--- Load the primitive states into the numerics class. ---*/
+            numerics->SetPrimitive(Prim_L, Prim_R);
 
-          /*--- Load the grid velocities into numerics. ---*/
-          su2double vGrid[] = {0.0, 0.0, 0.0};
-          for(unsigned short iDim=0; iDim<nDim; ++iDim)
-            vGrid[iDim] = gridVel[iDim];
-          numerics->SetGridVel(vGrid, vGrid);
-
-          /*--- Prepare the primitive states for the numerics class. Note
-           that for the FV solver, we have the following primitive
-           variable ordering: Compressible flow, primitive variables nDim+5,
-           (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
-
-          /*--- Left primitive state ---*/
-          Prim_L[0] = 0.0;                                        // Temperature (unused)
-          Prim_L[nDim+1] = gm1*UL[nVar-1];
-          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-            Prim_L[iDim+1]  = UL[iDim+1]/UL[0];                   // Velocities
-            Prim_L[nDim+1] -= gm1*0.5*Prim_L[iDim+1]*UL[iDim+1];  // Pressure
+            /*--- Now simply call the ComputeResidual() function to calculate
+             the flux using the chosen approximate Riemann solver. Note that
+             the Jacobian arrays here are just dummies for now (no implicit). ---*/
+            numerics->ComputeResidual(flux, Jacobian_i, Jacobian_j, config);
           }
-          Prim_L[nDim+2] = UL[0];                                 // Density
-          Prim_L[nDim+3] = (UL[nVar-1] + Prim_L[nDim+1]) / UL[0]; // Enthalpy
-
-          /*--- Right primitive state ---*/
-          Prim_R[0] = 0.0;                                        // Temperature (unused)
-          Prim_R[nDim+1] = gm1*UR[nVar-1];
-          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-            Prim_R[iDim+1]  = UR[iDim+1]/UR[0];                   // Velocities
-            Prim_R[nDim+1] -= gm1*0.5*Prim_R[iDim+1]*UR[iDim+1];  // Pressure
-          }
-          Prim_R[nDim+2] = UR[0];                                 // Density
-          Prim_R[nDim+3] = (UR[nVar-1] + Prim_R[nDim+1]) / UR[0]; // Enthalpy
-
-          /*--- Load the primitive states into the numerics class. ---*/
-          numerics->SetPrimitive(Prim_L, Prim_R);
+        }
 
-          /*--- Now simply call the ComputeResidual() function to calculate
-           the flux using the chosen approximate Riemann solver. Note that
-           the Jacobian arrays here are just dummies for now (no implicit). ---*/
-          numerics->ComputeResidual(flux, Jacobian_i, Jacobian_j, config);
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          delete [] Jacobian_i[iVar];
+          delete [] Jacobian_j[iVar];
         }
-      }
+        delete [] Jacobian_i;
+        delete [] Jacobian_j;
 
-      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        delete [] Jacobian_i[iVar];
-        delete [] Jacobian_j[iVar];
+        Jacobian_i = nullptr;
+        Jacobian_j = nullptr;
       }
-      delete [] Jacobian_i;
-      delete [] Jacobian_j;
-
-      Jacobian_i = nullptr;
-      Jacobian_j = nullptr;
     }
   }
 }
@@ -9483,9 +9574,9 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
       su2double StaticEnergy = VecSolDOFs[ii+nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
-      su2double Pressure = FluidModel->GetPressure();
-      su2double Temperature = FluidModel->GetTemperature();
+      GetFluidModel()->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
+      su2double Pressure = GetFluidModel()->GetPressure();
+      su2double Temperature = GetFluidModel()->GetTemperature();
 
       /*--- Use the values at the infinity if the state is not physical. ---*/
       if((Pressure < 0.0) || (VecSolDOFs[ii] < 0.0) || (Temperature < 0.0)) {
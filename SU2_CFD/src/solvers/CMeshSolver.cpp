@@ -716,39 +716,32 @@ void CMeshSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
 
   /*--- Load data from the restart into correct containers. ---*/
 
-  unsigned long iPoint_Global, counter = 0;
+  unsigned long counter = 0;
 
-  for (iPoint_Global = 0; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+  /*--- Loop over the points of this rank, in the order of their data in the restart buffer. ---*/
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+  for (auto iPoint_Local : geometry[MESH_0]->GetDomainPointsInGlobalOrder()) {
 
-    auto iPoint_Local = geometry[MESH_0]->GetGlobal_to_Local_Point(iPoint_Global);
+    /*--- We need to store this point's data, so jump to the correct
+     offset in the buffer of data from the restart file and load it. ---*/
 
-    if (iPoint_Local >= 0) {
+    auto index = counter*Restart_Vars[1];
 
-      /*--- We need to store this point's data, so jump to the correct
-       offset in the buffer of data from the restart file and load it. ---*/
+    for (unsigned short iDim = 0; iDim < nDim; iDim++){
+      /*--- Update the coordinates of the mesh ---*/
+      su2double curr_coord = Restart_Data[index+iDim];
+      /// TODO: "Double deformation" in multizone adjoint if this is set here?
+      ///       In any case it should not be needed as deformation is called before other solvers
+      ///geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, curr_coord);
 
-      auto index = counter*Restart_Vars[1];
-
-      for (unsigned short iDim = 0; iDim < nDim; iDim++){
-        /*--- Update the coordinates of the mesh ---*/
-        su2double curr_coord = Restart_Data[index+iDim];
-        /// TODO: "Double deformation" in multizone adjoint if this is set here?
-        ///       In any case it should not be needed as deformation is called before other solvers
-        ///geometry[MESH_0]->nodes->SetCoord(iPoint_Local, iDim, curr_coord);
-
-        /*--- Store the displacements computed as the current coordinates
-         minus the coordinates of the reference mesh file ---*/
-        su2double displ = curr_coord - nodes->GetMesh_Coord(iPoint_Local, iDim);
-        nodes->SetSolution(iPoint_Local, iDim, displ);
-      }
-
-      /*--- Increment the overall counter for how many points have been loaded. ---*/
-      counter++;
+      /*--- Store the displacements computed as the current coordinates
+       minus the coordinates of the reference mesh file ---*/
+      su2double displ = curr_coord - nodes->GetMesh_Coord(iPoint_Local, iDim);
+      nodes->SetSolution(iPoint_Local, iDim, displ);
     }
 
+    /*--- Increment the overall counter for how many points have been loaded. ---*/
+    counter++;
   }
 
   /*--- Detect a wrong solution file ---*/
@@ -863,35 +856,29 @@ void CMeshSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 
       /*--- Load data from the restart into correct containers. ---*/
 
-      unsigned long iPoint_Global, counter = 0;
+      unsigned long counter = 0;
 
-      for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++) {
+      /*--- Loop over the points of this rank, in the order of their data in the restart buffer. ---*/
 
-        /*--- Retrieve local index. If this node from the restart file lives
-         on the current processor, we will load and instantiate the vars. ---*/
+      for (auto iPoint_Local : geometry->GetDomainPointsInGlobalOrder()) {
 
-        auto iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+        /*--- We need to store this point's data, so jump to the correct
+         offset in the buffer of data from the restart file and load it. ---*/
 
-        if (iPoint_Local >= 0) {
+        auto index = counter*Restart_Vars[1];
 
-          /*--- We need to store this point's data, so jump to the correct
-           offset in the buffer of data from the restart file and load it. ---*/
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          su2double curr_coord = Restart_Data[index+iDim];
+          su2double displ = curr_coord - nodes->GetMesh_Coord(iPoint_Local,iDim);
 
-          auto index = counter*Restart_Vars[1];
-
-          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-            su2double curr_coord = Restart_Data[index+iDim];
-            su2double displ = curr_coord - nodes->GetMesh_Coord(iPoint_Local,iDim);
-
-            if(iStep==1)
-              nodes->Set_Solution_time_n(iPoint_Local, iDim, displ);
-            else
-              nodes->Set_Solution_time_n1(iPoint_Local, iDim, displ);
-          }
-
-          /*--- Increment the overall counter for how many points have been loaded. ---*/
-          counter++;
+          if(iStep==1)
+            nodes->Set_Solution_time_n(iPoint_Local, iDim, displ);
+          else
+            nodes->Set_Solution_time_n1(iPoint_Local, iDim, displ);
         }
+
+        /*--- Increment the overall counter for how many points have been loaded. ---*/
+        counter++;
       }
 
 
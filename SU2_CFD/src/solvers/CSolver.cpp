@@ -45,6 +45,7 @@
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CRestartDataCodec.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
 
 
@@ -1854,10 +1855,7 @@ void CSolver::CompleteComms(CGeometry *geometry,
   unsigned short COUNT_PER_POINT = 0;
   unsigned short MPI_TYPE = 0;
 
-  int ind, source, iMessage, jRecv;
-
-  /*--- Global status so all threads can see the result of Waitany. ---*/
-  static SU2_MPI::Status status;
+  int source, iMessage, jRecv;
 
   /*--- Set the size of the data packet and type depending on quantity. ---*/
 
@@ -1877,13 +1875,7 @@ void CSolver::CompleteComms(CGeometry *geometry,
       /*--- For efficiency, recv the messages dynamically based on
        the order they arrive. ---*/
 
-      SU2_OMP_MASTER
-      SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);
-      SU2_OMP_BARRIER
-
-      /*--- Once we have recv'd a message, get the source rank. ---*/
-
-      source = status.MPI_SOURCE;
+      source = geometry->WaitAnyP2PRecv(MPI_TYPE, COUNT_PER_POINT, false);
 
       /*--- We know the offsets based on the source rank. ---*/
 
@@ -2010,15 +2002,9 @@ void CSolver::CompleteComms(CGeometry *geometry,
       }
     }
 
-    /*--- Verify that all non-blocking point-to-point sends have finished.
-     Note that this should be satisfied, as we have received all of the
-     data in the loop above at this point. ---*/
+    /*--- Verify that all non-blocking point-to-point sends have finished. ---*/
 
-#ifdef HAVE_MPI
-    SU2_OMP_MASTER
-    SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);
-#endif
-    SU2_OMP_BARRIER
+    geometry->WaitAllP2PSends(MPI_TYPE);
   }
 
 }
@@ -3055,7 +3041,6 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 
   /*--- Variables for reading the restart files ---*/
   string text_line;
-  long iPoint_Local;
   unsigned long iPoint_Global_Local = 0, iPoint_Global = 0;
 
   /*--- First, we load the restart file for time n ---*/
@@ -3082,28 +3067,26 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 
   getline (restart_file_n, text_line);
 
-  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+  for (auto iPoint_Local : geometry->GetDomainPointsInGlobalOrder()) {
 
-    getline (restart_file_n, text_line);
+    /*--- Skip the lines of the points of other ranks without parsing them. ---*/
 
-    vector<string> point_line = PrintingToolbox::split(text_line, ',');
-
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    for (; iPoint_Global < geometry->nodes->GetGlobalIndex(iPoint_Local); iPoint_Global++)
+      restart_file_n.ignore(numeric_limits<streamsize>::max(), '\n');
 
-    iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+    if (!getline(restart_file_n, text_line)) break;
+    iPoint_Global++;
 
-    if (iPoint_Local > -1) {
-
-      Coord[0] = PrintingToolbox::stod(point_line[1]);
-      Coord[1] = PrintingToolbox::stod(point_line[2]);
-      if (nDim == 3){
-        Coord[2] = PrintingToolbox::stod(point_line[3]);
-      }
-      geometry->nodes->SetCoord_n(iPoint_Local, Coord);
+    vector<string> point_line = PrintingToolbox::split(text_line, ',');
 
-      iPoint_Global_Local++;
+    Coord[0] = PrintingToolbox::stod(point_line[1]);
+    Coord[1] = PrintingToolbox::stod(point_line[2]);
+    if (nDim == 3){
+      Coord[2] = PrintingToolbox::stod(point_line[3]);
     }
+    geometry->nodes->SetCoord_n(iPoint_Local, Coord);
+
+    iPoint_Global_Local++;
   }
 
   /*--- Detect a wrong solution file ---*/
@@ -3148,30 +3131,27 @@ void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
 
     getline (restart_file_n1, text_line);
 
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+    for (auto iPoint_Local : geometry->GetDomainPointsInGlobalOrder()) {
 
-      getline (restart_file_n1, text_line);
+      /*--- Skip the lines of the points of other ranks without parsing them. ---*/
 
-      vector<string> point_line = PrintingToolbox::split(text_line, ',');
+      for (; iPoint_Global < geometry->nodes->GetGlobalIndex(iPoint_Local); iPoint_Global++)
+        restart_file_n1.ignore(numeric_limits<streamsize>::max(), '\n');
 
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
+      if (!getline(restart_file_n1, text_line)) break;
+      iPoint_Global++;
 
-      iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
-
-      if (iPoint_Local > -1) {
-
-        Coord[0] = PrintingToolbox::stod(point_line[1]);
-        Coord[1] = PrintingToolbox::stod(point_line[2]);
-        if (nDim == 3){
-          Coord[2] = PrintingToolbox::stod(point_line[3]);
-        }
-
-        geometry->nodes->SetCoord_n1(iPoint_Local, Coord);
+      vector<string> point_line = PrintingToolbox::split(text_line, ',');
 
-        iPoint_Global_Local++;
+      Coord[0] = PrintingToolbox::stod(point_line[1]);
+      Coord[1] = PrintingToolbox::stod(point_line[2]);
+      if (nDim == 3){
+        Coord[2] = PrintingToolbox::stod(point_line[3]);
       }
 
+      geometry->nodes->SetCoord_n1(iPoint_Local, Coord);
+
+      iPoint_Global_Local++;
     }
 
     /*--- Detect a wrong solution file ---*/
@@ -3201,7 +3181,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
   ifstream restart_file;
   string text_line, Tag;
   unsigned short iVar;
-  long iPoint_Local = 0; unsigned long iPoint_Global = 0;
+  unsigned long iPoint_Global = 0;
   int counter = 0;
   fields.clear();
 
@@ -3328,29 +3308,26 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
 
   /*--- Read all lines in the restart file and extract data. ---*/
 
-  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+  for (auto iPoint_Local : geometry->GetDomainPointsInGlobalOrder()) {
 
-    getline (restart_file, text_line);
+    /*--- Skip the lines of the points of other ranks without parsing them. ---*/
 
-    vector<string> point_line = PrintingToolbox::split(text_line, delimiter);
-
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+    for (; iPoint_Global < geometry->nodes->GetGlobalIndex(iPoint_Local); iPoint_Global++)
+      restart_file.ignore(numeric_limits<streamsize>::max(), '\n');
 
-    iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+    if (!getline(restart_file, text_line)) break;
+    iPoint_Global++;
 
-    if (iPoint_Local > -1) {
-
-      /*--- Store the solution (starting with node coordinates) --*/
+    vector<string> point_line = PrintingToolbox::split(text_line, delimiter);
 
-      for (iVar = 0; iVar < Restart_Vars[1]; iVar++)
-        Restart_Data[counter*Restart_Vars[1] + iVar] = SU2_TYPE::GetValue(PrintingToolbox::stod(point_line[iVar+1]));
+    /*--- Store the solution (starting with node coordinates) --*/
 
-      /*--- Increment our local point counter. ---*/
+    for (iVar = 0; iVar < Restart_Vars[1]; iVar++)
+      Restart_Data[counter*Restart_Vars[1] + iVar] = SU2_TYPE::GetValue(PrintingToolbox::stod(point_line[iVar+1]));
 
-      counter++;
+    /*--- Increment our local point counter. ---*/
 
-    }
+    counter++;
   }
 
 }
@@ -3418,11 +3395,24 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
   Restart_Data = new passivedouble[nFields*geometry->GetnPointDomain()];
 
-  /*--- Read in the data for the restart at all local points. ---*/
+  if (Restart_Vars[3] == CRestartDataCodec::FORMAT_VERSION) {
 
-  ret = fread(Restart_Data, sizeof(passivedouble), nFields*geometry->GetnPointDomain(), fhw);
-  if (ret != (unsigned long)nFields*geometry->GetnPointDomain()) {
-    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    /*--- Decode the data of all points (mixed precision and/or compressed). ---*/
+
+    vector<unsigned long> points(geometry->GetnPointDomain());
+    for (unsigned long iPoint = 0; iPoint < points.size(); iPoint++) points[iPoint] = iPoint;
+
+    CRestartDataCodec::Read(fhw, nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char),
+                            Restart_Vars[4], nFields, Restart_Vars[2], points, Restart_Data);
+  }
+  else {
+
+    /*--- Read in the data for the restart at all local points. ---*/
+
+    ret = fread(Restart_Data, sizeof(passivedouble), nFields*geometry->GetnPointDomain(), fhw);
+    if (ret != (unsigned long)nFields*geometry->GetnPointDomain()) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
   }
 
   /*--- Close the file. ---*/
@@ -3437,7 +3427,7 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
   SU2_MPI::Status status;
   MPI_Datatype etype, filetype;
   MPI_Offset disp;
-  unsigned long iPoint_Global, index, iChar;
+  unsigned long index, iChar;
   string field_buf;
 
   int ierr;
@@ -3513,6 +3503,22 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
   delete [] mpi_str_buf;
 
+  if (Restart_Vars[3] == CRestartDataCodec::FORMAT_VERSION) {
+
+    /*--- Encoded data (mixed precision and/or compressed), every rank
+     decodes the records or blocks that contain its points. ---*/
+
+    const auto points = geometry->GetDomainGlobalIndices();
+
+    Restart_Data = new passivedouble[nFields*geometry->GetnPointDomain()];
+
+    CRestartDataCodec::Read(fhw, nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char),
+                            Restart_Vars[4], nFields, Restart_Vars[2], points, Restart_Data);
+
+    MPI_File_close(&fhw);
+    return;
+  }
+
   /*--- We're writing only su2doubles in the data portion of the file. ---*/
 
   etype = MPI_DOUBLE;
@@ -3529,12 +3535,10 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
   int *blocklen = new int[geometry->GetnPointDomain()];
   MPI_Aint *displace = new MPI_Aint[geometry->GetnPointDomain()];
   int counter = 0;
-  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-    if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-      blocklen[counter] = nFields;
-      displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
-      counter++;
-    }
+  for (auto iPoint_Global : geometry->GetDomainGlobalIndices()) {
+    blocklen[counter] = nFields;
+    displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
+    counter++;
   }
   MPI_Type_create_hindexed(geometry->GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
   MPI_Type_commit(&filetype);
@@ -40,6 +40,7 @@
 #include "../../SU2_CFD/include/solvers/CSolver.hpp"
 #include "../../SU2_CFD/include/output/CMeshOutput.hpp"
 #include "../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../Common/include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 #include "../../Common/include/CConfig.hpp"
 #include "../../Common/include/grid_movement_structure.hpp"
 
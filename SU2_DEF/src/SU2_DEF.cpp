@@ -130,6 +130,35 @@ int main(int argc, char *argv[]) {
       config_container[iZone]->SetMultizone(driver_config, config_container);
     }
   }
+
+  /*--- Conversion of the input grid to the SU2 binary format, directly from the
+   linear partitions of the mesh readers, no geometry is built in this mode. ---*/
+
+  if (config_container[ZONE_0]->GetMesh_Out_FileFormat() == SU2_BINARY) {
+
+    for (iZone = 0; iZone < nZone; iZone++) {
+      const string mesh_out = config_container[iZone]->GetMultizone_FileName(
+                                config_container[iZone]->GetMesh_Out_FileName(), iZone, ".su2b");
+      CSU2BinaryMeshReaderFVM::ConvertMesh(config_container[iZone], iZone, nZone, mesh_out);
+    }
+
+    for (iZone = 0; iZone < nZone; iZone++) delete config_container[iZone];
+    delete [] config_container;
+    delete [] geometry_container;
+    delete [] surface_movement;
+    delete [] grid_movement;
+    delete [] output;
+    delete driver_config;
+    delete config;
+
+    if (rank == MASTER_NODE)
+      cout << endl << "------------------------- Exit Success (SU2_DEF) ------------------------" << endl << endl;
+
+#ifdef HAVE_MPI
+    SU2_MPI::Finalize();
+#endif
+    return EXIT_SUCCESS;
+  }
   
   for (iZone = 0; iZone < nZone; iZone++) {
     
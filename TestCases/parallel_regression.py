@@ -1083,6 +1083,19 @@ def main():
     dyn_fsi.tol       = 0.00001
     test_list.append(dyn_fsi)
 
+    # FSI, Dynamic, 2D, IQN-ILS relaxation reusing the history of the previous time step
+    dyn_fsi_iqn           = TestCase('dyn_fsi_iqn')
+    dyn_fsi_iqn.cfg_dir   = "fea_fsi/dyn_fsi"
+    dyn_fsi_iqn.cfg_file  = "configIQN.cfg"
+    dyn_fsi_iqn.test_iter = 4
+    dyn_fsi_iqn.test_vals = [-4.379832, -4.005999, 0.000000, 0.000000] #last 4 columns
+    dyn_fsi_iqn.multizone = True
+    dyn_fsi_iqn.unsteady  = True
+    dyn_fsi_iqn.su2_exec  = "mpirun -n 2 SU2_CFD"
+    dyn_fsi_iqn.timeout   = 1600
+    dyn_fsi_iqn.tol       = 0.00001
+    test_list.append(dyn_fsi_iqn)
+
     # FSI, Static, 2D, new mesh solver, restart
     stat_fsi_restart           = TestCase('stat_fsi_restart')
     stat_fsi_restart.cfg_dir   = "fea_fsi/stat_fsi"
@@ -1286,6 +1286,19 @@ def main():
     dyn_fsi.tol       = 0.00001
     test_list.append(dyn_fsi)
 
+    # FSI, Dynamic, 2D, IQN-ILS relaxation reusing the history of the previous time step
+    dyn_fsi_iqn           = TestCase('dyn_fsi_iqn')
+    dyn_fsi_iqn.cfg_dir   = "fea_fsi/dyn_fsi"
+    dyn_fsi_iqn.cfg_file  = "configIQN.cfg"
+    dyn_fsi_iqn.test_iter = 4
+    dyn_fsi_iqn.test_vals = [-4.379829, -4.005994, 0.000000, 0.000000] #last 5 columns
+    dyn_fsi_iqn.multizone = True
+    dyn_fsi_iqn.unsteady  = True
+    dyn_fsi_iqn.su2_exec  = "SU2_CFD"
+    dyn_fsi_iqn.timeout   = 1600
+    dyn_fsi_iqn.tol       = 0.00001
+    test_list.append(dyn_fsi_iqn)
+
     # FSI, 2D airfoil with RBF interpolation
     airfoilRBF           = TestCase('airfoil_fsi_rbf')
     airfoilRBF.cfg_dir   = "fea_fsi/Airfoil_RBF"
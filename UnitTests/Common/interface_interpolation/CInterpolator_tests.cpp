@@ -0,0 +1,171 @@
+/*!
+ * \file CInterpolator_tests.cpp
+ * \brief Unit tests for the collection of donor vertices of the interpolators.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <vector>
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/interface_interpolation/CInterpolator.hpp"
+
+namespace {
+
+/*--- Partitioned box mesh, the marker x_minus is the interface. ---*/
+struct BoxMesh {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+  int marker = -1;
+
+  BoxMesh(const std::string& size, const std::string& offset) {
+    std::stringstream options;
+    options << "SOLVER= EULER\n"
+               "MESH_FORMAT= BOX\n"
+               "MARKER_EULER= ( x_minus, x_plus, y_minus, y_plus, z_minus, z_plus )\n"
+               "MESH_BOX_LENGTH= 1,1,1\n"
+               "MESH_BOX_SIZE= " << size << "\n"
+               "MESH_BOX_OFFSET= " << offset << "\n";
+
+    auto orig_buf = cout.rdbuf(nullptr);
+
+    config = std::unique_ptr<CConfig>(new CConfig(options, SU2_CFD, false));
+
+    CPhysicalGeometry aux_geometry(config.get(), 0, 1);
+    aux_geometry.SetColorGrid_Parallel(config.get());
+
+    geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(&aux_geometry, config.get()));
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetVertex(config.get());
+
+    cout.rdbuf(orig_buf);
+
+    for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++)
+      if (config->GetMarker_All_TagBound(iMarker) == "x_minus") marker = iMarker;
+  }
+};
+
+/*--- Exposes the collection of donor vertices. ---*/
+class CTestInterpolator final : public CInterpolator {
+public:
+  CTestInterpolator(CGeometry**** geometry_container, const CConfig* const* config) :
+    CInterpolator(geometry_container, config, 0, 1) {}
+
+  void SetTransferCoeff(const CConfig* const*) override {}
+
+  using CInterpolator::Collect_OverlappingVertexInfo;
+};
+
+/*--- Coordinates of the owned vertices of a marker. ---*/
+std::vector<su2double> OwnedCoord(const CGeometry* geometry, int marker) {
+  std::vector<su2double> coord;
+  if (marker < 0) return coord;
+  for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(marker); iVertex++) {
+    const auto iPoint = geometry->vertex[marker][iVertex]->GetNode();
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
+    for (auto iDim = 0u; iDim < geometry->GetnDim(); iDim++)
+      coord.push_back(geometry->nodes->GetCoord(iPoint, iDim));
+  }
+  return coord;
+}
+
+/*--- Sorted squared distances from a point to a set of points. ---*/
+std::vector<passivedouble> SortedDist2(const su2double* x, const std::vector<su2double>& coord, unsigned short nDim) {
+  std::vector<passivedouble> dist2(coord.size()/nDim, 0.0);
+  for (auto i = 0ul; i < dist2.size(); i++)
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      dist2[i] += SU2_TYPE::GetValue(pow(x[iDim] - coord[i*nDim+iDim], 2));
+  std::sort(dist2.begin(), dist2.end());
+  return dist2;
+}
+
+}
+
+TEST_CASE("Overlapping donor vertices contain the closest donors", "[Interpolation]") {
+
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+  const unsigned short nDim = 3;
+
+  /*--- The target boundary is finer than the donor and away from it, the halo must grow. ---*/
+  BoxMesh donor("5,5,5", "0,0,0"), target("7,7,7", "0.3,0.1,-0.2");
+
+  CGeometry* donorMesh[] = {donor.geometry.get()};
+  CGeometry* targetMesh[] = {target.geometry.get()};
+  CGeometry** donorInst[] = {donorMesh};
+  CGeometry** targetInst[] = {targetMesh};
+  CGeometry*** geometry[] = {donorInst, targetInst};
+  const CConfig* config[] = {donor.config.get(), target.config.get()};
+
+  CTestInterpolator interpolator(geometry, config);
+
+  /*--- Reference, the entire donor boundary. ---*/
+  auto myDonors = OwnedCoord(donor.geometry.get(), donor.marker);
+  int nMyCoord = myDonors.size();
+  std::vector<int> nCoord(size), displ(size+1, 0);
+  SU2_MPI::Allgather(&nMyCoord, 1, MPI_INT, nCoord.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  for (int iRank = 0; iRank < size; iRank++) displ[iRank+1] = displ[iRank] + nCoord[iRank];
+
+  std::vector<su2double> allDonors(displ[size]);
+  SU2_MPI::Allgatherv(myDonors.data(), nMyCoord, MPI_DOUBLE, allDonors.data(), nCoord.data(), displ.data(),
+                      MPI_DOUBLE, MPI_COMM_WORLD);
+  REQUIRE(allDonors.size() == 25*nDim);
+
+  const auto targets = OwnedCoord(target.geometry.get(), target.marker);
+
+  for (const unsigned long nNeighbor : {1ul, 4ul, 9ul}) {
+    std::vector<su2double> coord;
+    std::vector<long> globalPoint;
+    std::vector<int> proc;
+    interpolator.Collect_OverlappingVertexInfo(donor.marker, target.marker, nDim, nNeighbor,
+                                               coord, globalPoint, proc);
+
+    REQUIRE(coord.size() == globalPoint.size()*nDim);
+    REQUIRE(proc.size() == globalPoint.size());
+    CHECK(std::adjacent_find(globalPoint.begin(), globalPoint.end(),
+                             [](long a, long b) { return a >= b; }) == globalPoint.end());
+    for (const auto iProc : proc) CHECK((iProc >= 0 && iProc < size));
+
+    /*--- The donors this rank owns are reported with its rank. ---*/
+    for (auto i = 0ul; i < globalPoint.size(); i++) {
+      if (proc[i] != rank) continue;
+      const auto iPoint = donor.geometry->GetGlobal_to_Local_Point(globalPoint[i]);
+      REQUIRE(iPoint >= 0);
+      CHECK(donor.geometry->nodes->GetDomain(iPoint));
+    }
+
+    /*--- The closest nNeighbor donors of each target are among the collected ones. ---*/
+    for (auto iTarget = 0ul; iTarget < targets.size()/nDim; iTarget++) {
+      const auto ref = SortedDist2(&targets[iTarget*nDim], allDonors, nDim);
+      const auto found = SortedDist2(&targets[iTarget*nDim], coord, nDim);
+      REQUIRE(found.size() >= nNeighbor);
+      for (auto k = 0ul; k < nNeighbor; k++)
+        CHECK(found[k] == Approx(ref[k]));
+    }
+  }
+}
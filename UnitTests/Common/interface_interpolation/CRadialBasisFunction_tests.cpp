@@ -0,0 +1,81 @@
+/*!
+ * \file CRadialBasisFunction_tests.cpp
+ * \brief Unit tests for the local-stencil RBF interpolation coefficients.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <vector>
+#include "../../../Common/include/interface_interpolation/CRadialBasisFunction.hpp"
+
+namespace {
+
+/*--- Stencil of 10 scattered points around the origin, optionally on the plane z = 0.2. ---*/
+su2activematrix Stencil(bool planar) {
+  const passivedouble x[][3] = {{0.0, 0.0, 0.0}, {0.3, 0.1,-0.2}, {-0.2, 0.4, 0.1}, {0.1,-0.3, 0.3},
+                                {0.4, 0.3, 0.2}, {-0.3,-0.1,-0.3}, {0.2,-0.2,-0.1}, {-0.1, 0.2, 0.4},
+                                {0.35,-0.35, 0.05}, {-0.4, 0.05, 0.25}};
+  su2activematrix coords(10, 3);
+  for (auto i = 0ul; i < 10; ++i)
+    for (auto iDim = 0ul; iDim < 3; ++iDim)
+      coords(i,iDim) = (planar && iDim == 2)? 0.2 : x[i][iDim];
+  return coords;
+}
+
+passivedouble Linear(const su2double* x) {
+  return SU2_TYPE::GetValue(1.0 + 2.0*x[0] - 3.0*x[1] + 0.5*x[2]);
+}
+
+}
+
+TEST_CASE("Local RBF stencil coefficients", "[Interpolation]") {
+
+  const passivedouble radius = 2.0;
+  std::vector<passivedouble> coeffs;
+
+  for (const bool planar : {false, true}) {
+    const auto coords = Stencil(planar);
+    const su2double target[] = {0.05, 0.12, planar? 0.2 : -0.07};
+
+    /*--- With the polynomial term, constants and linear fields are reproduced. ---*/
+    for (const auto type : {WENDLAND_C2, INV_MULTI_QUADRIC, GAUSSIAN, THIN_PLATE_SPLINE, MULTI_QUADRIC}) {
+      CRadialBasisFunction::ComputeStencilCoefficients(type, true, radius, coords, target, coeffs);
+      REQUIRE(coeffs.size() == coords.rows());
+
+      passivedouble sum = 0.0, value = 0.0;
+      for (auto i = 0ul; i < coeffs.size(); ++i) {
+        sum += coeffs[i];
+        value += coeffs[i] * Linear(coords[i]);
+      }
+      CHECK(sum == Approx(1.0));
+      CHECK(value == Approx(Linear(target)));
+    }
+
+    /*--- The interpolant matches the donor values, with or without the polynomial term. ---*/
+    for (const bool usePolynomial : {false, true}) {
+      CRadialBasisFunction::ComputeStencilCoefficients(WENDLAND_C2, usePolynomial, radius, coords, coords[4], coeffs);
+      for (auto i = 0ul; i < coeffs.size(); ++i)
+        CHECK(coeffs[i] == Approx(i == 4? 1.0 : 0.0).margin(1e-9));
+    }
+  }
+}
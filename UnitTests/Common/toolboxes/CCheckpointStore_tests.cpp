@@ -0,0 +1,159 @@
+/*!
+ * \file CCheckpointStore_tests.cpp
+ * \brief Unit tests for the in-memory store of solution snapshots.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <vector>
+#include <algorithm>
+#include "../../../Common/include/toolboxes/CCheckpointStore.hpp"
+
+TEST_CASE("Binomial coefficients of the checkpoint schedule", "[Toolboxes]") {
+  CHECK(CCheckpointStore::Beta(1, 4) == 5);
+  CHECK(CCheckpointStore::Beta(2, 3) == 10);
+  CHECK(CCheckpointStore::Beta(5, 4) == 126);
+}
+
+TEST_CASE("Reversal of a sequence of steps with limited snapshots", "[Toolboxes]") {
+
+  /*--- Reverse N steps from an initial state that is always available (e.g. on disk),
+   *    each state must be delivered in reverse order and no step may be recomputed more
+   *    often than the binomial bound allows. ---*/
+
+  const int N = 100;
+
+  for (unsigned long capacity : {1ul, 2ul, 3ul, 10ul}) {
+    CCheckpointStore store(capacity);
+    std::vector<unsigned long> nEval(N+1, 0);
+
+    for (int n = N; n >= 1; --n) {
+      store.ReleaseAfter(n);
+
+      if (!store.Has(n)) {
+        int base = store.GetLatestBefore(n);
+        if (base == n) base = 0;
+
+        unsigned long nSnap = capacity - store.GetnSnapshots();
+        int next = base + CCheckpointStore::GetCheckpointOffset(n-base, nSnap);
+
+        for (int k = base+1; k <= n; ++k) {
+          ++nEval[k];
+          if (k == next && k < n) {
+            store.Store(k, {passivedouble(k)});
+            --nSnap;
+            next = k + CCheckpointStore::GetCheckpointOffset(n-k, nSnap);
+          }
+        }
+        store.Store(n, {passivedouble(n)});
+      }
+      REQUIRE(store.GetnSnapshots() <= capacity);
+
+      std::vector<passivedouble> values;
+      store.Load(n, values);
+      REQUIRE(values.size() == 1);
+      CHECK(values[0] == n);
+    }
+
+    unsigned long nRep = 0;
+    while (CCheckpointStore::Beta(capacity, nRep) < N) ++nRep;
+
+    CHECK(*std::max_element(nEval.begin(), nEval.end()) <= nRep+1);
+  }
+}
+
+TEST_CASE("Recomputation of steps that use several time levels", "[Toolboxes]") {
+
+  /*--- A base needs nLevels-1 consecutive states, the initial state (-1) is always available. ---*/
+
+  CCheckpointStore store(4);
+  for (int iter : {4, 5, 7}) store.Store(iter, {passivedouble(iter)});
+
+  const auto stored = [&store](int iter) { return iter < 0 || store.Has(iter); };
+
+  CHECK(CCheckpointStore::GetBase(10, 2, stored) == 5);
+  CHECK(CCheckpointStore::GetBase(10, 1, stored) == 7);
+  CHECK(CCheckpointStore::GetBase(4, 2, stored) == -1);
+
+  /*--- Reverse N steps of 2nd order (3 time levels) as the unsteady discrete adjoint does, the
+   *    checkpoints hold 2 states, the ones that are left after keeping the 3 states of a step
+   *    bound the number of times each step is computed like in the binomial schedule. ---*/
+
+  const int N = 100;
+  const unsigned short nLevels = 3;
+
+  for (unsigned long capacity : {5ul, 7ul, 12ul}) {
+    CCheckpointStore reverse(capacity);
+    const auto available = [&reverse](int iter) { return iter < 0 || reverse.Has(iter); };
+    std::vector<unsigned long> nEval(N+1, 0);
+
+    for (int n = N; n >= 1; --n) {
+      reverse.ReleaseAfter(n);
+
+      if (!(available(n) && available(n-1) && available(n-2))) {
+        const int base = CCheckpointStore::GetBase(n, nLevels-1, available);
+        const auto schedule = reverse.GetRecomputeSchedule(base, n, nLevels);
+
+        for (int k = base+1; k <= n; ++k) {
+          if (k > 0) ++nEval[k];
+          if (std::binary_search(schedule.begin(), schedule.end(), k)) reverse.Store(k, {passivedouble(k)});
+        }
+      }
+      REQUIRE(reverse.GetnSnapshots() <= capacity);
+      REQUIRE((available(n) && available(n-1) && available(n-2)));
+    }
+
+    const unsigned long nSnap = 1 + (capacity-nLevels)/(nLevels-1);
+    unsigned long nRep = 0;
+    while (CCheckpointStore::Beta(nSnap, nRep) < N) ++nRep;
+
+    CHECK(*std::max_element(nEval.begin(), nEval.end()) <= nRep+1);
+  }
+}
+
+TEST_CASE("Snapshots are stored without loss", "[Toolboxes]") {
+
+  std::vector<passivedouble> values(1000), loaded;
+  for (size_t i = 0; i < values.size(); ++i) values[i] = 1.0/(i+1);
+
+#ifdef HAVE_ZLIB
+  const std::vector<int> levels = {0, 1, 9};
+#else
+  const std::vector<int> levels = {0};
+#endif
+
+  for (int compression : levels) {
+    CCheckpointStore store(2, compression);
+    store.Store(3, values);
+    store.Store(7, values);
+    CHECK(store.GetLatestBefore(7) == 3);
+    CHECK(store.GetLatestBefore(3) == 3);
+
+    store.Load(7, loaded);
+    CHECK(loaded == values);
+
+    store.ReleaseAfter(3);
+    CHECK(!store.Has(7));
+    CHECK(store.GetnSnapshots() == 1);
+  }
+}
@@ -0,0 +1,76 @@
+/*!
+ * \file CGeometricPartitioner_tests.cpp
+ * \brief Unit tests for the Hilbert space-filling curve partitioner.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <vector>
+#include <algorithm>
+#include "../../../Common/include/toolboxes/CGeometricPartitioner.hpp"
+
+TEST_CASE("Hilbert curve is continuous", "[Toolboxes]") {
+
+  /*--- Consecutive keys on a 2D grid must be neighbors. ---*/
+  const uint32_t n = 16;
+  std::vector<std::pair<uint64_t, std::pair<uint32_t,uint32_t> > > cells;
+
+  for (uint32_t i = 0; i < n; ++i) {
+    for (uint32_t j = 0; j < n; ++j) {
+      const uint32_t c[] = {i, j};
+      cells.push_back({CGeometricPartitioner::HilbertKey(2, 4, c), {i, j}});
+    }
+  }
+  std::sort(cells.begin(), cells.end());
+
+  for (size_t k = 0; k < cells.size(); ++k) CHECK(cells[k].first == k);
+
+  for (size_t k = 1; k < cells.size(); ++k) {
+    const int di = int(cells[k].second.first) - int(cells[k-1].second.first);
+    const int dj = int(cells[k].second.second) - int(cells[k-1].second.second);
+    CHECK(std::abs(di) + std::abs(dj) == 1);
+  }
+}
+
+TEST_CASE("Balanced space-filling curve partitions", "[Toolboxes]") {
+
+  /*--- Partition a 3D lattice (on one rank) into a number of parts that does not divide it. ---*/
+  const int n = 10, nParts = 7;
+  std::vector<passivedouble> coord;
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      for (int k = 0; k < n; ++k)
+        coord.insert(coord.end(), {0.1*i, 0.2*j, 0.3*k});
+
+  const unsigned long nPoint = n*n*n;
+  CGeometricPartitioner partitioner(3, nParts);
+  const auto part = partitioner.Partition(nPoint, coord.data());
+
+  std::vector<unsigned long> count(nParts, 0);
+  for (auto p : part) {
+    REQUIRE(p >= 0);
+    REQUIRE(p < nParts);
+    ++count[p];
+  }
+  for (auto c : count) CHECK(std::abs(long(c) - long(nPoint/nParts)) <= 1);
+}
@@ -0,0 +1,119 @@
+/*!
+ * \file CNodeHaloExchange_tests.cpp
+ * \brief Unit tests for the node-aware halo exchange.
+ * \version 7.0.6 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <set>
+#include <vector>
+#include "../../../Common/include/toolboxes/CNodeHaloExchange.hpp"
+
+#ifdef HAVE_NODE_HALO_EXCHANGE
+TEST_CASE("Node-aware halo exchange matches point-to-point messages", "[Toolboxes]") {
+
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+  const unsigned short nVar = 3;
+
+  /*--- Ring of ranks (each also sends to itself). With enough ranks the last one has no
+   *    neighbors, it must fall back to point-to-point comms without disabling the others. ---*/
+
+  const int nRing = (size >= 3)? size-1 : size;
+  std::set<int> peerSet;
+  if (rank < nRing) peerSet = {(rank+nRing-1)%nRing, rank, (rank+1)%nRing};
+  const std::vector<int> peers(peerSet.begin(), peerSet.end());
+  const int nPeer = peers.size();
+
+  const auto nPointMsg = [](int from, int to) { return 1 + (from+to)%3; };
+  const auto value = [](int from, int to, int iPoint, int iVar) {
+    return passivedouble(1000*from + 100*to + 10*iPoint + iVar);
+  };
+
+  std::vector<int> sendOffset(nPeer+1, 0), recvOffset(nPeer+1, 0);
+  for (int iPeer = 0; iPeer < nPeer; ++iPeer) {
+    sendOffset[iPeer+1] = sendOffset[iPeer] + nPointMsg(rank, peers[iPeer]);
+    recvOffset[iPeer+1] = recvOffset[iPeer] + nPointMsg(peers[iPeer], rank);
+  }
+
+  CNodeHaloExchange exchange(nPeer, peers.data(), sendOffset.data(), nPeer, peers.data(), recvOffset.data());
+  REQUIRE(exchange.IsActive() == (nPeer > 0));
+  if (!exchange.IsActive()) return;
+
+  su2double *bufSend = nullptr, *bufRecv = nullptr;
+  exchange.Allocate(nVar, bufSend, bufRecv);
+
+  for (int iPeer = 0; iPeer < nPeer; ++iPeer)
+    for (int iPoint = 0; iPoint < nPointMsg(rank, peers[iPeer]); ++iPoint)
+      for (int iVar = 0; iVar < nVar; ++iVar)
+        bufSend[(sendOffset[iPeer]+iPoint)*nVar+iVar] = value(rank, peers[iPeer], iPoint, iVar);
+
+  /*--- Reference, the regular point-to-point messages. ---*/
+
+  std::vector<su2double> refRecv(recvOffset[nPeer]*nVar);
+  std::vector<SU2_MPI::Request> req(2*nPeer);
+
+  for (int iPeer = 0; iPeer < nPeer; ++iPeer) {
+    SU2_MPI::Irecv(&refRecv[recvOffset[iPeer]*nVar], (recvOffset[iPeer+1]-recvOffset[iPeer])*nVar,
+                   MPI_DOUBLE, peers[iPeer], 0, MPI_COMM_WORLD, &req[iPeer]);
+    SU2_MPI::Isend(&bufSend[sendOffset[iPeer]*nVar], (sendOffset[iPeer+1]-sendOffset[iPeer])*nVar,
+                   MPI_DOUBLE, peers[iPeer], 0, MPI_COMM_WORLD, &req[nPeer+iPeer]);
+  }
+  SU2_MPI::Waitall(2*nPeer, req.data(), MPI_STATUSES_IGNORE);
+
+  /*--- Forward exchange, every neighbor is returned once and the data matches. ---*/
+
+  std::set<int> sources;
+  for (int iPeer = 0; iPeer < nPeer; ++iPeer) sources.insert(exchange.WaitAny(nVar, false));
+  exchange.Finish();
+  CHECK(sources == peerSet);
+
+  int nWrong = 0;
+  for (int iPeer = 0; iPeer < nPeer; ++iPeer)
+    for (int iPoint = 0; iPoint < nPointMsg(peers[iPeer], rank); ++iPoint)
+      for (int iVar = 0; iVar < nVar; ++iVar) {
+        const auto k = (recvOffset[iPeer]+iPoint)*nVar+iVar;
+        nWrong += (bufRecv[k] != refRecv[k]) || (bufRecv[k] != value(peers[iPeer], rank, iPoint, iVar));
+      }
+  CHECK(nWrong == 0);
+
+  /*--- Reverse exchange, the receive buffers are sent back to the sources. ---*/
+
+  for (int iPeer = 0; iPeer < nPeer; ++iPeer)
+    for (int iPoint = 0; iPoint < nPointMsg(peers[iPeer], rank); ++iPoint)
+      for (int iVar = 0; iVar < nVar; ++iVar)
+        bufRecv[(recvOffset[iPeer]+iPoint)*nVar+iVar] = 0.5 + value(peers[iPeer], rank, iPoint, iVar);
+
+  sources.clear();
+  for (int iPeer = 0; iPeer < nPeer; ++iPeer) sources.insert(exchange.WaitAny(nVar, true));
+  exchange.Finish();
+  CHECK(sources == peerSet);
+
+  nWrong = 0;
+  for (int iPeer = 0; iPeer < nPeer; ++iPeer)
+    for (int iPoint = 0; iPoint < nPointMsg(rank, peers[iPeer]); ++iPoint)
+      for (int iVar = 0; iVar < nVar; ++iVar)
+        nWrong += (bufSend[(sendOffset[iPeer]+iPoint)*nVar+iVar] != 0.5 + value(rank, peers[iPeer], iPoint, iVar));
+  CHECK(nWrong == 0);
+}
+#endif